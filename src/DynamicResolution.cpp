@@ -0,0 +1,245 @@
+#include "DynamicResolution.h"
+#include "shader.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Tuning for the scale controller. Scaling down reacts faster than scaling up so that a
+// sudden spike is handled within a few frames, while recovering headroom is gradual and
+// cannot oscillate around the target on GPUs with noisy timings (integrated parts especially).
+static const float MIN_SCALE = 0.5f;
+static const float MAX_SCALE = 1.0f;
+static const float MAX_STEP_DOWN = 0.1f;
+static const float MAX_STEP_UP = 0.05f;
+static const float OVER_BUDGET_RATIO = 1.0f;   // shrink once the smoothed time exceeds the target
+static const float HEADROOM_RATIO = 0.8f;      // only grow again with 20% headroom left
+static const float AIM_RATIO = 0.9f;           // aim slightly under the target when resizing
+static const float SMOOTHING = 0.1f;           // exponential moving average weight of new samples
+static const int ADJUST_INTERVAL_FRAMES = 15;
+
+DynamicResolution::DynamicResolution(unsigned int windowWidth, unsigned int windowHeight, float targetFrameMs)
+    : windowWidth(windowWidth), windowHeight(windowHeight),
+      renderWidth(windowWidth), renderHeight(windowHeight),
+      targetFrameMs(targetFrameMs), scale(MAX_SCALE), smoothedFrameMs(0.0f),
+      enabled(true), timerQueriesSupported(false), frameTimed(false), framesSinceAdjust(0),
+      sceneFBO(0), sceneColorTexture(0), sceneDepthRBO(0),
+      upscaleShaderProgram(0), fullscreenVAO(0),
+      sourceSizeLoc(-1), uvScaleLoc(-1), sharpnessLoc(-1), sceneTextureLoc(-1),
+      queryIndex(0) {
+    for (int i = 0; i < QUERY_COUNT; i++) {
+        timerQueries[i] = 0;
+        queryPending[i] = false;
+    }
+}
+
+DynamicResolution::~DynamicResolution() {
+    destroyTargets();
+    if (timerQueries[0] != 0) glDeleteQueries(QUERY_COUNT, timerQueries);
+    if (fullscreenVAO != 0) glDeleteVertexArrays(1, &fullscreenVAO);
+    if (upscaleShaderProgram != 0) glDeleteProgram(upscaleShaderProgram);
+}
+
+bool DynamicResolution::init() {
+    upscaleShaderProgram = LoadShaders("upscale_vertex.glsl", "upscale_fragment.glsl");
+    if (upscaleShaderProgram == 0) {
+        std::cerr << "ERROR::DYNAMIC_RESOLUTION:: Failed to load upscale shaders!" << std::endl;
+        return false;
+    }
+    sceneTextureLoc = glGetUniformLocation(upscaleShaderProgram, "sceneTexture");
+    sourceSizeLoc = glGetUniformLocation(upscaleShaderProgram, "sourceSize");
+    uvScaleLoc = glGetUniformLocation(upscaleShaderProgram, "uvScale");
+    sharpnessLoc = glGetUniformLocation(upscaleShaderProgram, "sharpness");
+
+    // The fullscreen triangle is generated from gl_VertexID, but core profile still needs a VAO bound
+    glGenVertexArrays(1, &fullscreenVAO);
+
+    timerQueriesSupported = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+    if (timerQueriesSupported) {
+        glGenQueries(QUERY_COUNT, timerQueries);
+    } else {
+        std::cerr << "Warning: GPU timer queries unavailable, dynamic resolution stays at native scale." << std::endl;
+    }
+
+    createTargets();
+    return sceneFBO != 0;
+}
+
+void DynamicResolution::createTargets() {
+    glGenFramebuffers(1, &sceneFBO);
+    glGenTextures(1, &sceneColorTexture);
+    glBindTexture(GL_TEXTURE_2D, sceneColorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, windowWidth, windowHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glGenRenderbuffers(1, &sceneDepthRBO);
+    glBindRenderbuffer(GL_RENDERBUFFER, sceneDepthRBO);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, windowWidth, windowHeight);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, sceneFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, sceneColorTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, sceneDepthRBO);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "ERROR::FRAMEBUFFER:: Scene Framebuffer is not complete!" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        destroyTargets();
+        return;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    updateRenderSize();
+}
+
+void DynamicResolution::destroyTargets() {
+    if (sceneFBO != 0) glDeleteFramebuffers(1, &sceneFBO);
+    if (sceneColorTexture != 0) glDeleteTextures(1, &sceneColorTexture);
+    if (sceneDepthRBO != 0) glDeleteRenderbuffers(1, &sceneDepthRBO);
+    sceneFBO = 0;
+    sceneColorTexture = 0;
+    sceneDepthRBO = 0;
+}
+
+void DynamicResolution::resize(unsigned int width, unsigned int height) {
+    // Minimised windows report a 0x0 framebuffer; keep the old targets until we are visible again
+    if (width == 0 || height == 0) return;
+    if (width == windowWidth && height == windowHeight) return;
+
+    windowWidth = width;
+    windowHeight = height;
+    destroyTargets();
+    createTargets();
+}
+
+void DynamicResolution::updateRenderSize() {
+    renderWidth = std::max(1u, static_cast<unsigned int>(std::lround(windowWidth * scale)));
+    renderHeight = std::max(1u, static_cast<unsigned int>(std::lround(windowHeight * scale)));
+}
+
+void DynamicResolution::setEnabled(bool on) {
+    enabled = on;
+    if (!enabled) {
+        scale = MAX_SCALE;
+        updateRenderSize();
+    }
+    smoothedFrameMs = 0.0f;
+    framesSinceAdjust = 0;
+}
+
+void DynamicResolution::setTargetFrameMs(float ms) {
+    targetFrameMs = std::max(1.0f, ms);
+    framesSinceAdjust = 0;
+}
+
+void DynamicResolution::beginFrame() {
+    frameTimed = false;
+    if (!enabled || !timerQueriesSupported || sceneFBO == 0) return;
+
+    // If the GPU is more than QUERY_COUNT frames behind, skip timing rather than stall on the result
+    if (queryPending[queryIndex]) return;
+    glBeginQuery(GL_TIME_ELAPSED, timerQueries[queryIndex]);
+    frameTimed = true;
+}
+
+void DynamicResolution::bindSceneTarget() {
+    if (!enabled || sceneFBO == 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, windowWidth, windowHeight);
+        return;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, sceneFBO);
+    glViewport(0, 0, renderWidth, renderHeight);
+}
+
+void DynamicResolution::endFrame() {
+    if (!enabled || sceneFBO == 0) return;
+
+    GLboolean depthTestWasEnabled = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean blendWasEnabled = glIsEnabled(GL_BLEND);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, windowWidth, windowHeight);
+
+    glUseProgram(upscaleShaderProgram);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, sceneColorTexture);
+    glUniform1i(sceneTextureLoc, 0);
+    glUniform2f(sourceSizeLoc, (float)windowWidth, (float)windowHeight);
+    glUniform2f(uvScaleLoc, (float)renderWidth / (float)windowWidth, (float)renderHeight / (float)windowHeight);
+    // No sharpening at native scale so the upscale is an exact copy
+    glUniform1f(sharpnessLoc, std::min(1.0f, (MAX_SCALE - scale) * 2.0f));
+
+    glBindVertexArray(fullscreenVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+
+    if (depthTestWasEnabled) glEnable(GL_DEPTH_TEST);
+    if (blendWasEnabled) glEnable(GL_BLEND);
+
+    if (frameTimed) {
+        glEndQuery(GL_TIME_ELAPSED);
+        queryPending[queryIndex] = true;
+        queryIndex = (queryIndex + 1) % QUERY_COUNT;
+    }
+    collectTimings();
+}
+
+void DynamicResolution::collectTimings() {
+    // Walk the ring oldest first; results arrive in submission order
+    for (int n = 0; n < QUERY_COUNT; n++) {
+        int i = (queryIndex + n) % QUERY_COUNT;
+        if (!queryPending[i]) continue;
+
+        GLint available = 0;
+        glGetQueryObjectiv(timerQueries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(timerQueries[i], GL_QUERY_RESULT, &elapsedNs);
+        queryPending[i] = false;
+        adjustScale(static_cast<float>(elapsedNs) / 1.0e6f);
+    }
+}
+
+void DynamicResolution::adjustScale(float frameMs) {
+    if (smoothedFrameMs <= 0.0f)
+        smoothedFrameMs = frameMs;
+    else
+        smoothedFrameMs += (frameMs - smoothedFrameMs) * SMOOTHING;
+
+    if (++framesSinceAdjust < ADJUST_INTERVAL_FRAMES) return;
+
+    float newScale = scale;
+    // The main pass is fill-rate bound, so GPU time scales with pixel count (scale squared)
+    if (smoothedFrameMs > targetFrameMs * OVER_BUDGET_RATIO) {
+        float desired = scale * std::sqrt(targetFrameMs * AIM_RATIO / smoothedFrameMs);
+        newScale = std::max(desired, scale - MAX_STEP_DOWN);
+    } else if (smoothedFrameMs < targetFrameMs * HEADROOM_RATIO && scale < MAX_SCALE) {
+        float desired = scale * std::sqrt(targetFrameMs * AIM_RATIO / smoothedFrameMs);
+        newScale = std::min(desired, scale + MAX_STEP_UP);
+    }
+    newScale = std::clamp(newScale, MIN_SCALE, MAX_SCALE);
+    framesSinceAdjust = 0;
+
+    if (std::fabs(newScale - scale) < 0.01f) return;
+
+    // Re-seed the average with the expected cost at the new size so stale samples do not trigger another step
+    smoothedFrameMs *= (newScale * newScale) / (scale * scale);
+    scale = newScale;
+    updateRenderSize();
+}
+
+void DynamicResolution::printStatus() const {
+    std::cout << "\n--- Dynamic Resolution ---" << std::endl;
+    std::cout << "Enabled: " << (enabled ? "yes" : "no")
+              << (timerQueriesSupported ? "" : " (no GPU timers, fixed at native)") << std::endl;
+    std::cout << "Target: " << targetFrameMs << " ms, GPU: " << smoothedFrameMs << " ms" << std::endl;
+    std::cout << "Scale: " << scale << " (" << renderWidth << "x" << renderHeight
+              << " -> " << windowWidth << "x" << windowHeight << ")" << std::endl;
+    std::cout << "--------------------------" << std::endl;
+}
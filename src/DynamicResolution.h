@@ -0,0 +1,62 @@
+#ifndef DYNAMIC_RESOLUTION_H
+#define DYNAMIC_RESOLUTION_H
+
+#include <GL/glew.h>
+
+// Offscreen scene target whose render resolution follows a GPU frame-time budget.
+// The colour/depth attachments are allocated once at window size; lowering the scale
+// only shrinks the viewport we render into, so adjusting it never reallocates.
+class DynamicResolution {
+public:
+    DynamicResolution(unsigned int windowWidth, unsigned int windowHeight, float targetFrameMs);
+    ~DynamicResolution();
+
+    bool init(); // compiles the upscale shader and creates the framebuffer
+    void resize(unsigned int windowWidth, unsigned int windowHeight);
+
+    void beginFrame();     // starts the GPU timer for this frame
+    void bindSceneTarget(); // binds the offscreen framebuffer with the scaled viewport
+    void endFrame();       // sharpening upscale to the default framebuffer, stops the timer, adjusts the scale
+
+    void setEnabled(bool on);
+    bool isEnabled() const { return enabled; }
+    void setTargetFrameMs(float ms);
+    float getTargetFrameMs() const { return targetFrameMs; }
+    float getScale() const { return scale; }
+    float getGpuFrameMs() const { return smoothedFrameMs; }
+    unsigned int getRenderWidth() const { return renderWidth; }
+    unsigned int getRenderHeight() const { return renderHeight; }
+    void printStatus() const;
+
+private:
+    static const int QUERY_COUNT = 4; // enough frames in flight that reading a result never stalls
+
+    unsigned int windowWidth, windowHeight;
+    unsigned int renderWidth, renderHeight;
+    float targetFrameMs;
+    float scale;
+    float smoothedFrameMs;
+    bool enabled;
+    bool timerQueriesSupported;
+    bool frameTimed;
+    int framesSinceAdjust;
+
+    GLuint sceneFBO;
+    GLuint sceneColorTexture;
+    GLuint sceneDepthRBO;
+    GLuint upscaleShaderProgram;
+    GLuint fullscreenVAO;
+    GLint sourceSizeLoc, uvScaleLoc, sharpnessLoc, sceneTextureLoc;
+
+    GLuint timerQueries[QUERY_COUNT];
+    bool queryPending[QUERY_COUNT];
+    int queryIndex;
+
+    void createTargets();
+    void destroyTargets();
+    void updateRenderSize();
+    void collectTimings();
+    void adjustScale(float frameMs);
+};
+
+#endif
@@ -0,0 +1,218 @@
+#include "FrustumCuller.h"
+
+#include <algorithm>
+#include <cmath>
+
+// SSE2 is part of the x86-64 baseline; AVX2 is compiled per function and only called when
+// the CPU reports it, so the binary still runs on older machines. All paths evaluate the
+// plane equations in the same order (no FMA) so they agree bit for bit.
+#if defined(__GNUC__) && defined(__SSE2__)
+#define FRUSTUM_CULLER_X86 1
+#include <immintrin.h>
+#else
+#define FRUSTUM_CULLER_X86 0
+#endif
+
+FrustumPlanes FrustumPlanes::fromMatrix(const float* m) {
+    // Gribb/Hartmann: row 3 +/- rows 0..2 of the matrix; m is column-major so row r is m[r], m[4 + r], ...
+    FrustumPlanes planes;
+    for (int i = 0; i < 6; i++) {
+        int row = i / 2;
+        float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+        float a = m[3] + sign * m[row];
+        float b = m[7] + sign * m[4 + row];
+        float c = m[11] + sign * m[8 + row];
+        float d = m[15] + sign * m[12 + row];
+        float length = std::sqrt(a * a + b * b + c * c);
+        float inv = length > 0.0f ? 1.0f / length : 0.0f;
+        planes.x[i] = a * inv;
+        planes.y[i] = b * inv;
+        planes.z[i] = c * inv;
+        planes.w[i] = d * inv;
+    }
+    return planes;
+}
+
+uint32_t CullingBounds::add(const float boundsMin[3], const float boundsMax[3]) {
+    float ex = (boundsMax[0] - boundsMin[0]) * 0.5f;
+    float ey = (boundsMax[1] - boundsMin[1]) * 0.5f;
+    float ez = (boundsMax[2] - boundsMin[2]) * 0.5f;
+    centerX.push_back(boundsMin[0] + ex);
+    centerY.push_back(boundsMin[1] + ey);
+    centerZ.push_back(boundsMin[2] + ez);
+    extentX.push_back(ex);
+    extentY.push_back(ey);
+    extentZ.push_back(ez);
+    radius.push_back(std::sqrt(ex * ex + ey * ey + ez * ez));
+    return static_cast<uint32_t>(radius.size() - 1);
+}
+
+void CullingBounds::clear() {
+    centerX.clear(); centerY.clear(); centerZ.clear();
+    extentX.clear(); extentY.clear(); extentZ.clear();
+    radius.clear();
+}
+
+CullPath detectCullPath() {
+#if FRUSTUM_CULLER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return CullPath::AVX2;
+    return CullPath::SSE;
+#else
+    return CullPath::Scalar;
+#endif
+}
+
+const char* cullPathName(CullPath path) {
+    switch (path) {
+        case CullPath::AVX2: return "AVX2";
+        case CullPath::SSE: return "SSE";
+        default: return "scalar";
+    }
+}
+
+// --- Scalar kernels (also used for the tails of the SIMD loops) ---
+
+static size_t cullSpheresScalar(const FrustumPlanes& p, const CullingBounds& b, size_t begin, uint32_t* visible) {
+    size_t count = 0;
+    for (size_t i = begin; i < b.size(); i++) {
+        bool inside = true;
+        for (int j = 0; j < 6 && inside; j++)
+            inside = p.x[j] * b.centerX[i] + p.y[j] * b.centerY[i] + p.z[j] * b.centerZ[i] + p.w[j] >= -b.radius[i];
+        if (inside) visible[count++] = static_cast<uint32_t>(i);
+    }
+    return count;
+}
+
+static size_t cullAabbsScalar(const FrustumPlanes& p, const CullingBounds& b, size_t begin, uint32_t* visible) {
+    size_t count = 0;
+    for (size_t i = begin; i < b.size(); i++) {
+        bool inside = true;
+        for (int j = 0; j < 6 && inside; j++) {
+            float distance = p.x[j] * b.centerX[i] + p.y[j] * b.centerY[i] + p.z[j] * b.centerZ[i] + p.w[j];
+            float reach = std::fabs(p.x[j]) * b.extentX[i] + std::fabs(p.y[j]) * b.extentY[i] + std::fabs(p.z[j]) * b.extentZ[i];
+            inside = distance >= -reach;
+        }
+        if (inside) visible[count++] = static_cast<uint32_t>(i);
+    }
+    return count;
+}
+
+#if FRUSTUM_CULLER_X86
+
+static inline size_t appendMask(unsigned int mask, uint32_t base, uint32_t* visible) {
+    size_t count = 0;
+    while (mask) {
+        visible[count++] = base + static_cast<uint32_t>(__builtin_ctz(mask));
+        mask &= mask - 1;
+    }
+    return count;
+}
+
+// --- SSE: 4 objects per iteration ---
+
+static size_t cullSpheresSSE(const FrustumPlanes& p, const CullingBounds& b, uint32_t* visible) {
+    size_t n = b.size(), count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 cx = _mm_loadu_ps(&b.centerX[i]);
+        __m128 cy = _mm_loadu_ps(&b.centerY[i]);
+        __m128 cz = _mm_loadu_ps(&b.centerZ[i]);
+        __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&b.radius[i]));
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int j = 0; j < 6; j++) {
+            __m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.x[j]), cx), _mm_mul_ps(_mm_set1_ps(p.y[j]), cy)),
+                                             _mm_mul_ps(_mm_set1_ps(p.z[j]), cz)), _mm_set1_ps(p.w[j]));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(d, negRadius));
+        }
+        count += appendMask(static_cast<unsigned int>(_mm_movemask_ps(inside)), static_cast<uint32_t>(i), visible + count);
+    }
+    return count + cullSpheresScalar(p, b, i, visible + count);
+}
+
+static size_t cullAabbsSSE(const FrustumPlanes& p, const CullingBounds& b, uint32_t* visible) {
+    size_t n = b.size(), count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 cx = _mm_loadu_ps(&b.centerX[i]);
+        __m128 cy = _mm_loadu_ps(&b.centerY[i]);
+        __m128 cz = _mm_loadu_ps(&b.centerZ[i]);
+        __m128 ex = _mm_loadu_ps(&b.extentX[i]);
+        __m128 ey = _mm_loadu_ps(&b.extentY[i]);
+        __m128 ez = _mm_loadu_ps(&b.extentZ[i]);
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int j = 0; j < 6; j++) {
+            __m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.x[j]), cx), _mm_mul_ps(_mm_set1_ps(p.y[j]), cy)),
+                                             _mm_mul_ps(_mm_set1_ps(p.z[j]), cz)), _mm_set1_ps(p.w[j]));
+            __m128 reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::fabs(p.x[j])), ex), _mm_mul_ps(_mm_set1_ps(std::fabs(p.y[j])), ey)),
+                                      _mm_mul_ps(_mm_set1_ps(std::fabs(p.z[j])), ez));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(d, _mm_sub_ps(_mm_setzero_ps(), reach)));
+        }
+        count += appendMask(static_cast<unsigned int>(_mm_movemask_ps(inside)), static_cast<uint32_t>(i), visible + count);
+    }
+    return count + cullAabbsScalar(p, b, i, visible + count);
+}
+
+// --- AVX2: 8 objects per iteration ---
+
+__attribute__((target("avx2")))
+static size_t cullSpheresAVX2(const FrustumPlanes& p, const CullingBounds& b, uint32_t* visible) {
+    size_t n = b.size(), count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 cx = _mm256_loadu_ps(&b.centerX[i]);
+        __m256 cy = _mm256_loadu_ps(&b.centerY[i]);
+        __m256 cz = _mm256_loadu_ps(&b.centerZ[i]);
+        __m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(&b.radius[i]));
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int j = 0; j < 6; j++) {
+            __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(p.x[j]), cx), _mm256_mul_ps(_mm256_set1_ps(p.y[j]), cy)),
+                                                   _mm256_mul_ps(_mm256_set1_ps(p.z[j]), cz)), _mm256_set1_ps(p.w[j]));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, negRadius, _CMP_GE_OQ));
+        }
+        count += appendMask(static_cast<unsigned int>(_mm256_movemask_ps(inside)), static_cast<uint32_t>(i), visible + count);
+    }
+    return count + cullSpheresScalar(p, b, i, visible + count);
+}
+
+__attribute__((target("avx2")))
+static size_t cullAabbsAVX2(const FrustumPlanes& p, const CullingBounds& b, uint32_t* visible) {
+    size_t n = b.size(), count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 cx = _mm256_loadu_ps(&b.centerX[i]);
+        __m256 cy = _mm256_loadu_ps(&b.centerY[i]);
+        __m256 cz = _mm256_loadu_ps(&b.centerZ[i]);
+        __m256 ex = _mm256_loadu_ps(&b.extentX[i]);
+        __m256 ey = _mm256_loadu_ps(&b.extentY[i]);
+        __m256 ez = _mm256_loadu_ps(&b.extentZ[i]);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int j = 0; j < 6; j++) {
+            __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(p.x[j]), cx), _mm256_mul_ps(_mm256_set1_ps(p.y[j]), cy)),
+                                                   _mm256_mul_ps(_mm256_set1_ps(p.z[j]), cz)), _mm256_set1_ps(p.w[j]));
+            __m256 reach = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(std::fabs(p.x[j])), ex), _mm256_mul_ps(_mm256_set1_ps(std::fabs(p.y[j])), ey)),
+                                         _mm256_mul_ps(_mm256_set1_ps(std::fabs(p.z[j])), ez));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, _mm256_sub_ps(_mm256_setzero_ps(), reach), _CMP_GE_OQ));
+        }
+        count += appendMask(static_cast<unsigned int>(_mm256_movemask_ps(inside)), static_cast<uint32_t>(i), visible + count);
+    }
+    return count + cullAabbsScalar(p, b, i, visible + count);
+}
+
+#endif
+
+size_t cullSpheres(const FrustumPlanes& planes, const CullingBounds& bounds, uint32_t* visible, CullPath path) {
+#if FRUSTUM_CULLER_X86
+    static const CullPath supported = detectCullPath();
+    path = std::min(path, supported);
+    if (path == CullPath::AVX2) return cullSpheresAVX2(planes, bounds, visible);
+    if (path == CullPath::SSE) return cullSpheresSSE(planes, bounds, visible);
+#endif
+    return cullSpheresScalar(planes, bounds, 0, visible);
+}
+
+size_t cullAabbs(const FrustumPlanes& planes, const CullingBounds& bounds, uint32_t* visible, CullPath path) {
+#if FRUSTUM_CULLER_X86
+    static const CullPath supported = detectCullPath();
+    path = std::min(path, supported);
+    if (path == CullPath::AVX2) return cullAabbsAVX2(planes, bounds, visible);
+    if (path == CullPath::SSE) return cullAabbsSSE(planes, bounds, visible);
+#endif
+    return cullAabbsScalar(planes, bounds, 0, visible);
+}
@@ -0,0 +1,40 @@
+#ifndef FRUSTUM_CULLER_H
+#define FRUSTUM_CULLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Six normalised planes, inside when x*px + y*py + z*pz + w >= 0. Stored per component
+// so the SIMD kernels can broadcast them without shuffling.
+struct FrustumPlanes {
+    float x[6], y[6], z[6], w[6];
+
+    // From a column-major view-projection matrix, e.g. glm::value_ptr(projection * view)
+    static FrustumPlanes fromMatrix(const float* m);
+};
+
+// World-space bounds in structure-of-arrays form, one entry per cullable object.
+// Every entry has both an AABB (center + half extents) and its bounding sphere.
+struct CullingBounds {
+    std::vector<float> centerX, centerY, centerZ;
+    std::vector<float> extentX, extentY, extentZ;
+    std::vector<float> radius;
+
+    uint32_t add(const float boundsMin[3], const float boundsMax[3]);
+    void clear();
+    size_t size() const { return radius.size(); }
+};
+
+// Ordered from slowest to fastest; a requested path the CPU lacks falls back to the best available
+enum class CullPath { Scalar, SSE, AVX2 };
+
+CullPath detectCullPath();
+const char* cullPathName(CullPath path);
+
+// Write the indices of the entries that intersect the frustum to visible (which must hold
+// bounds.size() entries), in ascending order, and return how many there are.
+size_t cullSpheres(const FrustumPlanes& planes, const CullingBounds& bounds, uint32_t* visible, CullPath path);
+size_t cullAabbs(const FrustumPlanes& planes, const CullingBounds& bounds, uint32_t* visible, CullPath path);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef LIGHTMAP_FORMAT_H
+#define LIGHTMAP_FORMAT_H
+
+#include <cstdint>
+#include <string>
+
+// On-disk layout written by the lightmap baker (baker/) and read back by Model.
+//
+// For models/<Name>.obj the baker writes, into models/lightmaps/:
+//   <Name>.hdr   - Radiance RGBE atlas holding baked point-light irradiance (linear, not gamma corrected)
+//   <Name>.lmuv  - lightmap UVs, one per face corner, for every mesh in Model::processNode order
+//
+// .lmuv layout (little endian):
+//   LightmapFileHeader
+//   per mesh: uint32 cornerCount, then cornerCount * (float u, float v)
+//
+// UVs are per face corner because every triangle gets its own chart; the runtime
+// de-indexes a mesh when it has a lightmap. cornerCount must match the mesh's index
+// count after import, otherwise the lightmap is stale and ignored.
+
+const uint32_t LIGHTMAP_MAGIC = 0x56554d4c; // "LMUV"
+const uint32_t LIGHTMAP_VERSION = 1;
+
+struct LightmapFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t atlasWidth;
+    uint32_t atlasHeight;
+    uint32_t meshCount;
+};
+
+inline std::string lightmapDirectory(const std::string& modelDirectory) {
+    return modelDirectory + "/lightmaps";
+}
+
+#endif
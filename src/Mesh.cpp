@@ -6,19 +6,39 @@ Mesh::Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std:
     this->indices = indices;
     this->textures = textures;
 
+    boundsMin = glm::vec3(0.0f);
+    boundsMax = glm::vec3(0.0f);
+    if (!this->vertices.empty()) {
+        boundsMin = boundsMax = this->vertices[0].Position;
+        for (const Vertex& vertex : this->vertices) {
+            boundsMin = glm::min(boundsMin, vertex.Position);
+            boundsMax = glm::max(boundsMax, vertex.Position);
+        }
+    }
+
     setupMesh();
 }
 
 void Mesh::Draw(unsigned int shaderProgram) {
     unsigned int diffuseNr = 1;
     unsigned int specularNr = 1;
+    bool hasLightmap = false;
     
     for(unsigned int i = 0; i < textures.size(); i++) {
-        glActiveTexture(GL_TEXTURE0 + i);
-        
         std::string number;
         std::string name = textures[i].type;
 
+        if(name == "texture_lightmap") {
+            glActiveTexture(GL_TEXTURE0 + LIGHTMAP_TEXTURE_UNIT);
+            glBindTexture(GL_TEXTURE_2D, textures[i].id);
+            GLint location = glGetUniformLocation(shaderProgram, "lightmap");
+            if (location != -1) glUniform1i(location, LIGHTMAP_TEXTURE_UNIT);
+            hasLightmap = true;
+            continue;
+        }
+
+        glActiveTexture(GL_TEXTURE0 + i);
+
         if(name == "texture_diffuse")
             number = std::to_string(diffuseNr++);
         else if(name == "texture_specular")
@@ -62,6 +82,10 @@ void Mesh::Draw(unsigned int shaderProgram) {
         }
     }
     
+    // Meshes without a baked lightmap fall back to dynamic point lights
+    GLint hasLightmapLocation = glGetUniformLocation(shaderProgram, "hasLightmap");
+    if (hasLightmapLocation != -1) glUniform1i(hasLightmapLocation, hasLightmap ? 1 : 0);
+    
     // Draw mesh
     glBindVertexArray(VAO);
     
@@ -115,6 +139,10 @@ void Mesh::setupMesh() {
     glEnableVertexAttribArray(2);
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
 
+    // Lightmap texture coords
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, LightmapCoords));
+
     // Unbind VAO (it's always a good thing to unbind any buffer/array to prevent strange bugs)
     glBindVertexArray(0);
     
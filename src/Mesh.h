@@ -11,8 +11,12 @@ struct Vertex {
     glm::vec3 Position;
     glm::vec3 Normal;
     glm::vec2 TexCoords;
+    glm::vec2 LightmapCoords;
 };
 
+// Lightmaps get their own unit so they never collide with material maps or the shadow map (unit 3)
+const unsigned int LIGHTMAP_TEXTURE_UNIT = 4;
+
 struct Texture {
     unsigned int id;
     std::string type;
@@ -25,6 +29,9 @@ public:
     std::vector<Vertex>       vertices;
     std::vector<unsigned int> indices;
     std::vector<Texture>      textures;
+    // object-space bounds, used for culling and shadow caching
+    glm::vec3 boundsMin;
+    glm::vec3 boundsMax;
     
     Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Texture> textures);
     void Draw(unsigned int shaderProgram);
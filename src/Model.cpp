@@ -1,9 +1,12 @@
 #include "Model.h"
+#include "LightmapFormat.h"
+#include "SceneData.h"
 #include <iostream>
 
 #include "stb_image.h"
 
-Model::Model(std::string const &path, bool gamma) : gammaCorrection(gamma) {
+Model::Model(std::string const &path, bool gamma)
+    : gammaCorrection(gamma), hasLightmap(false), boundsMin(0.0f), boundsMax(0.0f) {
     try {
         loadModel(path);
     }
@@ -24,7 +27,7 @@ void Model::Draw(unsigned int shaderProgram) {
 
 void Model::loadModel(std::string const &path) {
     Assimp::Importer importer;
-    const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace);
+    const aiScene* scene = importer.ReadFile(path, SCENE_IMPORT_FLAGS);
     
     if(!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) 
     {
@@ -34,7 +37,66 @@ void Model::loadModel(std::string const &path) {
     
     directory = path.substr(0, path.find_last_of('/'));
 
+    loadLightmap(path);
     processNode(scene->mRootNode, scene);
+    lightmapUVs.clear();
+
+    for (size_t i = 0; i < meshes.size(); i++) {
+        boundsMin = (i == 0) ? meshes[i].boundsMin : glm::min(boundsMin, meshes[i].boundsMin);
+        boundsMax = (i == 0) ? meshes[i].boundsMax : glm::max(boundsMax, meshes[i].boundsMax);
+    }
+}
+
+void Model::loadLightmap(std::string const &path) {
+    size_t nameStart = path.find_last_of('/') + 1;
+    std::string name = path.substr(nameStart, path.find_last_of('.') - nameStart);
+    std::string base = lightmapDirectory(directory) + "/" + name;
+
+    std::ifstream file(base + ".lmuv", std::ios::binary);
+    if (!file.is_open())
+        return; // not baked, dynamic point lights only
+
+    LightmapFileHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != LIGHTMAP_MAGIC || header.version != LIGHTMAP_VERSION) {
+        std::cerr << "Warning: Ignoring invalid lightmap " << base << ".lmuv" << std::endl;
+        return;
+    }
+
+    std::vector<std::vector<glm::vec2>> uvs(header.meshCount);
+    for (uint32_t m = 0; m < header.meshCount; m++) {
+        uint32_t count = 0;
+        file.read(reinterpret_cast<char*>(&count), sizeof(count));
+        uvs[m].resize(count);
+        file.read(reinterpret_cast<char*>(uvs[m].data()), count * sizeof(glm::vec2));
+    }
+    if (!file) {
+        std::cerr << "Warning: Truncated lightmap " << base << ".lmuv" << std::endl;
+        return;
+    }
+
+    int width, height, nrComponents;
+    float *data = stbi_loadf((base + ".hdr").c_str(), &width, &height, &nrComponents, 3);
+    if (!data) {
+        std::cerr << "Warning: Lightmap atlas failed to load at path: " << base << ".hdr" << std::endl;
+        return;
+    }
+
+    glGenTextures(1, &lightmapTexture.id);
+    glBindTexture(GL_TEXTURE_2D, lightmapTexture.id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, width, height, 0, GL_RGB, GL_FLOAT, data);
+    // Charts are packed edge to edge, so no mipmaps and no wrapping
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    stbi_image_free(data);
+
+    lightmapTexture.type = "texture_lightmap";
+    lightmapTexture.path = base + ".hdr";
+    lightmapUVs = std::move(uvs);
+    hasLightmap = true;
+    std::cout << "  Loaded lightmap: " << lightmapTexture.path << " (" << width << "x" << height << ")" << std::endl;
 }
 
 void Model::processNode(aiNode *node, const aiScene *scene) {
@@ -89,6 +151,7 @@ Mesh Model::processMesh(aiMesh *mesh, const aiScene *scene) {
         else
             vertex.TexCoords = glm::vec2(0.0f, 0.0f);
 
+        vertex.LightmapCoords = glm::vec2(0.0f, 0.0f);
         vertices.push_back(vertex);
     }
     
@@ -100,6 +163,23 @@ Mesh Model::processMesh(aiMesh *mesh, const aiScene *scene) {
             indices.push_back(face.mIndices[j]);        
     }
     
+    // baked lightmap UVs are per face corner, so the mesh is de-indexed to carry them
+    size_t meshIndex = meshes.size();
+    bool meshHasLightmap = hasLightmap && meshIndex < lightmapUVs.size() && lightmapUVs[meshIndex].size() == indices.size();
+    if (hasLightmap && !meshHasLightmap)
+        std::cerr << "Warning: Lightmap does not match mesh " << meshIndex << " in " << directory << ", re-run the baker" << std::endl;
+    if (meshHasLightmap) {
+        std::vector<Vertex> corners;
+        corners.reserve(indices.size());
+        for (size_t i = 0; i < indices.size(); i++) {
+            Vertex corner = vertices[indices[i]];
+            corner.LightmapCoords = lightmapUVs[meshIndex][i];
+            corners.push_back(corner);
+            indices[i] = static_cast<unsigned int>(i);
+        }
+        vertices.swap(corners);
+    }
+
     // process materials
     aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];    
 
@@ -118,6 +198,9 @@ Mesh Model::processMesh(aiMesh *mesh, const aiScene *scene) {
     // height maps
     std::vector<Texture> heightMaps = loadMaterialTextures(material, aiTextureType_AMBIENT, "texture_height");
     textures.insert(textures.end(), heightMaps.begin(), heightMaps.end());
+
+    if (meshHasLightmap)
+        textures.push_back(lightmapTexture);
     
     return Mesh(vertices, indices, textures);
 }
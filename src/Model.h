@@ -28,11 +28,22 @@ public:
     std::vector<Mesh>    meshes;
     std::string directory;
     bool gammaCorrection;
+    bool hasLightmap;
+    // object-space bounds over all meshes
+    glm::vec3 boundsMin;
+    glm::vec3 boundsMax;
 
     Model(std::string const &path, bool gamma = false);
     void Draw(unsigned int shaderProgram);
+    glm::vec3 getBoundsCenter() const { return (boundsMin + boundsMax) * 0.5f; }
+    float getBoundsRadius() const { return glm::length(boundsMax - boundsMin) * 0.5f; }
 private:
+    // per-mesh lightmap UVs (one per face corner) from the baker, only kept while loading
+    std::vector<std::vector<glm::vec2>> lightmapUVs;
+    Texture lightmapTexture;
+
     void loadModel(std::string const &path);
+    void loadLightmap(std::string const &path);
     void processNode(aiNode *node, const aiScene *scene);
     Mesh processMesh(aiMesh *mesh, const aiScene *scene);
     std::vector<Texture> loadMaterialTextures(aiMaterial *mat, aiTextureType type, std::string typeName);
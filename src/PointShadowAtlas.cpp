@@ -0,0 +1,293 @@
+#include "PointShadowAtlas.h"
+#include "shader.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <iostream>
+
+// Cube face orientations. fragmentShader.glsl rebuilds the same basis from these two
+// tables (POINT_SHADOW_FORWARD / POINT_SHADOW_UP), so keep them in sync.
+static const glm::vec3 FACE_FORWARD[6] = {
+    glm::vec3( 1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f),
+    glm::vec3( 0.0f, 1.0f, 0.0f), glm::vec3( 0.0f,-1.0f, 0.0f),
+    glm::vec3( 0.0f, 0.0f, 1.0f), glm::vec3( 0.0f, 0.0f,-1.0f)
+};
+static const glm::vec3 FACE_UP[6] = {
+    glm::vec3(0.0f,-1.0f, 0.0f), glm::vec3(0.0f,-1.0f, 0.0f),
+    glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f,-1.0f),
+    glm::vec3(0.0f,-1.0f, 0.0f), glm::vec3(0.0f,-1.0f, 0.0f)
+};
+
+static const float SHADOW_NEAR_PLANE = 0.05f;
+static const float SLOT_STEAL_RATIO = 1.25f; // a light must beat a slot holder by 25% to take its slot
+
+PointShadowAtlas::PointShadowAtlas(unsigned int atlasSize, unsigned int tileSize, int faceUpdatesPerFrame)
+    : atlasSize(atlasSize), tileSize(tileSize), tilesPerRow(atlasSize / tileSize),
+      faceUpdatesPerFrame(faceUpdatesPerFrame), facesRenderedLastFrame(0),
+      atlasFBO(0), atlasDepthTexture(0), shadowShaderProgram(0), shadowGeometry(nullptr),
+      faceMatrixLoc(-1), modelLoc(-1), lightPosLoc(-1), farPlaneLoc(-1) {
+    maxSlots = static_cast<int>(tilesPerRow * tilesPerRow) / 6;
+    slotOwner.assign(maxSlots, -1);
+}
+
+PointShadowAtlas::~PointShadowAtlas() {
+    if (atlasFBO != 0) glDeleteFramebuffers(1, &atlasFBO);
+    if (atlasDepthTexture != 0) glDeleteTextures(1, &atlasDepthTexture);
+    if (shadowShaderProgram != 0) glDeleteProgram(shadowShaderProgram);
+}
+
+bool PointShadowAtlas::init() {
+    shadowShaderProgram = LoadShaders("point_shadow_vertex.glsl", "point_shadow_fragment.glsl");
+    if (shadowShaderProgram == 0) {
+        std::cerr << "ERROR::POINT_SHADOWS:: Failed to load point shadow shaders!" << std::endl;
+        return false;
+    }
+    faceMatrixLoc = glGetUniformLocation(shadowShaderProgram, "faceMatrix");
+    modelLoc = glGetUniformLocation(shadowShaderProgram, "model");
+    lightPosLoc = glGetUniformLocation(shadowShaderProgram, "lightPos");
+    farPlaneLoc = glGetUniformLocation(shadowShaderProgram, "farPlane");
+
+    glGenFramebuffers(1, &atlasFBO);
+    glGenTextures(1, &atlasDepthTexture);
+    glBindTexture(GL_TEXTURE_2D, atlasDepthTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, atlasSize, atlasSize, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindFramebuffer(GL_FRAMEBUFFER, atlasFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, atlasDepthTexture, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    if (!complete)
+        std::cerr << "ERROR::FRAMEBUFFER:: Point Shadow Atlas Framebuffer is not complete!" << std::endl;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return complete;
+}
+
+void PointShadowAtlas::setLights(const std::vector<glm::vec3>& positions, const std::vector<float>& radii) {
+    lights.clear();
+    for (size_t i = 0; i < positions.size(); i++) {
+        LightState light;
+        light.position = positions[i];
+        light.radius = radii[i];
+        light.priority = 0.0f;
+        light.slot = -1;
+        std::fill(light.faceValid, light.faceValid + 6, false);
+        light.complete = false;
+        lights.push_back(light);
+    }
+    slotOwner.assign(maxSlots, -1);
+}
+
+int PointShadowAtlas::getSlot(int light) const {
+    if (light < 0 || light >= (int)lights.size()) return -1;
+    return lights[light].complete ? lights[light].slot : -1;
+}
+
+void PointShadowAtlas::invalidateAll() {
+    for (LightState& light : lights)
+        std::fill(light.faceValid, light.faceValid + 6, false);
+}
+
+bool PointShadowAtlas::sphereInFace(const LightState& light, int face, const glm::vec3& center, float radius) const {
+    glm::vec3 d = center - light.position;
+    if (glm::dot(d, d) > (light.radius + radius) * (light.radius + radius)) return false;
+
+    // Inside the 90 degree pyramid means |d.s| <= d.f and |d.u| <= d.f; test against the
+    // four normalised side planes so the sphere radius can be applied directly
+    glm::vec3 f = FACE_FORWARD[face];
+    glm::vec3 s = glm::normalize(glm::cross(f, FACE_UP[face]));
+    glm::vec3 u = glm::cross(s, f);
+    const float invSqrt2 = 0.70710678f;
+    if (glm::dot(d, (f - s) * invSqrt2) < -radius) return false;
+    if (glm::dot(d, (f + s) * invSqrt2) < -radius) return false;
+    if (glm::dot(d, (f - u) * invSqrt2) < -radius) return false;
+    if (glm::dot(d, (f + u) * invSqrt2) < -radius) return false;
+    return true;
+}
+
+void PointShadowAtlas::invalidateSphere(const glm::vec3& center, float radius) {
+    for (LightState& light : lights) {
+        if (light.slot < 0) continue;
+        for (int face = 0; face < 6; face++) {
+            if (light.faceValid[face] && sphereInFace(light, face, center, radius))
+                light.faceValid[face] = false;
+        }
+    }
+}
+
+void PointShadowAtlas::invalidateMovedCasters(const std::vector<ShadowCaster>& casters) {
+    bool sameCasters = knownCasters.size() == casters.size();
+    for (size_t i = 0; sameCasters && i < casters.size(); i++)
+        sameCasters = knownCasterModels[i] == casters[i].model;
+
+    if (!sameCasters) {
+        // Casters added or removed: cheap to be conservative, this is not a per-frame event
+        invalidateAll();
+    } else {
+        for (size_t i = 0; i < casters.size(); i++) {
+            if (knownCasters[i].modelMatrix == casters[i].modelMatrix) continue;
+            // The caster leaves a hole where it was and a new shadow where it is
+            invalidateSphere(knownCasters[i].center, knownCasters[i].radius);
+            invalidateSphere(casters[i].center, casters[i].radius);
+        }
+    }
+
+    knownCasterModels.resize(casters.size());
+    knownCasters.resize(casters.size());
+    for (size_t i = 0; i < casters.size(); i++) {
+        knownCasterModels[i] = casters[i].model;
+        knownCasters[i].modelMatrix = casters[i].modelMatrix;
+        knownCasters[i].center = casters[i].center;
+        knownCasters[i].radius = casters[i].radius;
+    }
+}
+
+void PointShadowAtlas::assignSlots(const glm::mat4& cameraViewProjection, const glm::vec3& cameraPos) {
+    // Frustum planes from the camera matrix (Gribb/Hartmann), used to drop lights whose
+    // influence sphere is entirely off screen
+    glm::vec4 rows[4];
+    for (int r = 0; r < 4; r++)
+        rows[r] = glm::vec4(cameraViewProjection[0][r], cameraViewProjection[1][r], cameraViewProjection[2][r], cameraViewProjection[3][r]);
+    glm::vec4 planes[6] = { rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1],
+                            rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2] };
+
+    // Screen contribution: the fraction of the view the light's sphere of influence covers,
+    // zero when the sphere is outside the frustum
+    for (LightState& light : lights) {
+        bool visible = true;
+        for (const glm::vec4& plane : planes) {
+            float length = glm::length(glm::vec3(plane));
+            if (glm::dot(glm::vec3(plane), light.position) + plane.w < -light.radius * length) {
+                visible = false;
+                break;
+            }
+        }
+        float distance = glm::length(light.position - cameraPos);
+        light.priority = visible ? std::min(1.0f, (light.radius * light.radius) / std::max(distance * distance, 1e-4f)) : 0.0f;
+        // Nearer lights break ties between several lights that cover the whole screen
+        light.priority += visible ? 1.0f / (1.0f + distance) : 0.0f;
+    }
+
+    std::vector<int> order(lights.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = static_cast<int>(i);
+    std::sort(order.begin(), order.end(), [this](int a, int b) { return lights[a].priority > lights[b].priority; });
+
+    for (int rank = 0; rank < (int)order.size() && rank < maxSlots; rank++) {
+        LightState& candidate = lights[order[rank]];
+        if (candidate.slot >= 0 || candidate.priority <= 0.0f) continue;
+
+        int slot = static_cast<int>(std::find(slotOwner.begin(), slotOwner.end(), -1) - slotOwner.begin());
+        if (slot == maxSlots) {
+            // Steal from the weakest holder, with hysteresis so two similar lights do not
+            // keep evicting each other (and throwing away their cached faces) every frame
+            int victim = -1;
+            for (int s = 0; s < maxSlots; s++) {
+                int owner = slotOwner[s];
+                if (victim < 0 || lights[owner].priority < lights[slotOwner[victim]].priority) victim = s;
+            }
+            if (victim < 0 || candidate.priority < lights[slotOwner[victim]].priority * SLOT_STEAL_RATIO) continue;
+            lights[slotOwner[victim]].slot = -1;
+            lights[slotOwner[victim]].complete = false;
+            slot = victim;
+        }
+
+        slotOwner[slot] = order[rank];
+        candidate.slot = slot;
+        candidate.complete = false;
+        std::fill(candidate.faceValid, candidate.faceValid + 6, false);
+    }
+}
+
+void PointShadowAtlas::renderFace(int lightIndex, int face, const std::vector<ShadowCaster>& casters) {
+    LightState& light = lights[lightIndex];
+    unsigned int tile = static_cast<unsigned int>(light.slot * 6 + face);
+    GLint x = (tile % tilesPerRow) * tileSize;
+    GLint y = (tile / tilesPerRow) * tileSize;
+
+    glViewport(x, y, tileSize, tileSize);
+    glScissor(x, y, tileSize, tileSize);
+    glClear(GL_DEPTH_BUFFER_BIT); // scissored, so only this tile
+
+    glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, SHADOW_NEAR_PLANE, light.radius);
+    glm::mat4 view = glm::lookAt(light.position, light.position + FACE_FORWARD[face], FACE_UP[face]);
+    glm::mat4 faceMatrix = projection * view;
+    glUniformMatrix4fv(faceMatrixLoc, 1, GL_FALSE, glm::value_ptr(faceMatrix));
+    glUniform3fv(lightPosLoc, 1, glm::value_ptr(light.position));
+    glUniform1f(farPlaneLoc, light.radius);
+
+    for (const ShadowCaster& caster : casters) {
+        if (!sphereInFace(light, face, caster.center, caster.radius)) continue;
+        if (shadowGeometry && caster.shadowGeometry >= 0) {
+            shadowGeometry->bind(); // Mesh::Draw below binds its own VAO, so rebind each time
+            shadowGeometry->draw(caster.shadowGeometry, modelLoc, caster.modelMatrix);
+        } else {
+            glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(caster.modelMatrix));
+            caster.model->Draw(shadowShaderProgram);
+        }
+    }
+    if (shadowGeometry) shadowGeometry->unbind();
+    light.faceValid[face] = true;
+}
+
+void PointShadowAtlas::update(const std::vector<ShadowCaster>& casters, const glm::mat4& cameraViewProjection, const glm::vec3& cameraPos) {
+    facesRenderedLastFrame = 0;
+    if (atlasFBO == 0 || lights.empty()) return;
+
+    invalidateMovedCasters(casters);
+    assignSlots(cameraViewProjection, cameraPos);
+
+    // Highest priority lights get their stale faces refreshed first
+    std::vector<int> order;
+    for (size_t i = 0; i < lights.size(); i++)
+        if (lights[i].slot >= 0) order.push_back(static_cast<int>(i));
+    std::sort(order.begin(), order.end(), [this](int a, int b) { return lights[a].priority > lights[b].priority; });
+
+    bool bound = false;
+    for (int lightIndex : order) {
+        LightState& light = lights[lightIndex];
+        for (int face = 0; face < 6 && facesRenderedLastFrame < faceUpdatesPerFrame; face++) {
+            if (light.faceValid[face]) continue;
+            if (!bound) {
+                glBindFramebuffer(GL_FRAMEBUFFER, atlasFBO);
+                glEnable(GL_SCISSOR_TEST);
+                glUseProgram(shadowShaderProgram);
+                bound = true;
+            }
+            renderFace(lightIndex, face, casters);
+            facesRenderedLastFrame++;
+        }
+        light.complete = light.complete || std::all_of(light.faceValid, light.faceValid + 6, [](bool v) { return v; });
+        if (facesRenderedLastFrame >= faceUpdatesPerFrame) break;
+    }
+
+    if (bound) {
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+}
+
+void PointShadowAtlas::bind(GLuint shaderProgram, unsigned int textureUnit) const {
+    glActiveTexture(GL_TEXTURE0 + textureUnit);
+    glBindTexture(GL_TEXTURE_2D, atlasDepthTexture);
+    glUniform1i(glGetUniformLocation(shaderProgram, "pointShadowAtlas"), textureUnit);
+    glUniform1i(glGetUniformLocation(shaderProgram, "pointShadowTilesPerRow"), tilesPerRow);
+    glUniform1f(glGetUniformLocation(shaderProgram, "pointShadowTileSize"), (float)tileSize / (float)atlasSize);
+    glUniform1f(glGetUniformLocation(shaderProgram, "pointShadowTexel"), 1.0f / (float)atlasSize);
+}
+
+void PointShadowAtlas::printStatus() const {
+    int assigned = 0, complete = 0;
+    for (const LightState& light : lights) {
+        if (light.slot >= 0) assigned++;
+        if (light.slot >= 0 && light.complete) complete++;
+    }
+    std::cout << "\n--- Point Light Shadows ---" << std::endl;
+    std::cout << "Atlas: " << atlasSize << "x" << atlasSize << ", " << maxSlots << " slots of 6x" << tileSize << std::endl;
+    std::cout << "Lights shadowed: " << complete << " complete / " << assigned << " assigned / " << lights.size() << " total" << std::endl;
+    std::cout << "Faces rendered last frame: " << facesRenderedLastFrame << " (budget " << faceUpdatesPerFrame << ")" << std::endl;
+    std::cout << "---------------------------" << std::endl;
+}
@@ -0,0 +1,87 @@
+#ifndef POINT_SHADOW_ATLAS_H
+#define POINT_SHADOW_ATLAS_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+#include "Model.h"
+#include "ShadowGeometry.h"
+
+// Anything that can cast a point-light shadow this frame
+struct ShadowCaster {
+    Model* model;
+    int shadowGeometry; // handle in the atlas' ShadowGeometry, -1 to draw the model itself
+    glm::mat4 modelMatrix;
+    glm::vec3 center;   // world-space bounding sphere
+    float radius;
+};
+
+// Omnidirectional shadows for point lights. Each shadowed light owns a slot of six
+// square tiles (one per cube face) in a single shared depth atlas that stores
+// distance-to-light / radius. Faces are cached: a face is only re-rendered when a
+// caster inside its frustum moves, and re-renders are capped per frame. When there
+// are more lights than slots, the lights contributing most to the screen win.
+class PointShadowAtlas {
+public:
+    PointShadowAtlas(unsigned int atlasSize, unsigned int tileSize, int faceUpdatesPerFrame);
+    ~PointShadowAtlas();
+
+    bool init();
+    void setGeometry(const ShadowGeometry* geometry) { shadowGeometry = geometry; }
+    void setLights(const std::vector<glm::vec3>& positions, const std::vector<float>& radii);
+
+    // Prioritises lights, invalidates faces touched by moved casters and re-renders up to
+    // the per-frame budget. Leaves the atlas framebuffer bound; callers rebind their own target.
+    void update(const std::vector<ShadowCaster>& casters, const glm::mat4& cameraViewProjection, const glm::vec3& cameraPos);
+
+    int getSlot(int light) const;  // -1 while the light has no complete shadow
+    float getFarPlane(int light) const { return lights[light].radius; }
+    void bind(GLuint shaderProgram, unsigned int textureUnit) const;
+    void invalidateAll();
+    void printStatus() const;
+
+    int getMaxSlots() const { return maxSlots; }
+
+private:
+    struct LightState {
+        glm::vec3 position;
+        float radius;
+        float priority;
+        int slot;           // -1 when not assigned
+        bool faceValid[6];
+        bool complete;      // all six faces rendered at least once since the slot was assigned
+    };
+
+    struct CasterState {
+        glm::mat4 modelMatrix;
+        glm::vec3 center;
+        float radius;
+    };
+
+    unsigned int atlasSize;
+    unsigned int tileSize;
+    unsigned int tilesPerRow;
+    int maxSlots;
+    int faceUpdatesPerFrame;
+    int facesRenderedLastFrame;
+
+    GLuint atlasFBO;
+    GLuint atlasDepthTexture;
+    GLuint shadowShaderProgram;
+    const ShadowGeometry* shadowGeometry;
+    GLint faceMatrixLoc, modelLoc, lightPosLoc, farPlaneLoc;
+
+    std::vector<LightState> lights;
+    std::vector<int> slotOwner;                          // light index per slot, -1 if free
+    std::vector<const Model*> knownCasterModels;         // identity of cached caster entries
+    std::vector<CasterState> knownCasters;
+
+    void invalidateMovedCasters(const std::vector<ShadowCaster>& casters);
+    void invalidateSphere(const glm::vec3& center, float radius);
+    void assignSlots(const glm::mat4& cameraViewProjection, const glm::vec3& cameraPos);
+    void renderFace(int light, int face, const std::vector<ShadowCaster>& casters);
+    bool sphereInFace(const LightState& light, int face, const glm::vec3& center, float radius) const;
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef SCENE_DATA_H
+#define SCENE_DATA_H
+
+#include <assimp/postprocess.h>
+#include <glm/glm.hpp>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Static scene description shared by the renderer and the offline lightmap baker,
+// so both always agree on which models exist and where the lights are.
+
+// --- Models ---
+// Post-processing used for every scene import; the baker relies on getting identical meshes
+const unsigned int SCENE_IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_FlipUVs | aiProcess_CalcTangentSpace;
+
+// Opaque models loaded from models/<name>.obj at the origin with no transform
+const std::vector<std::string> SCENE_OPAQUE_MODEL_NAMES = {
+    "BackWall", "Barstools", "BarTables", "BlueCouches", "BrownChairs", "CharcoalChairs", "CircleSofas",
+    "CoffeeTables", "Cubicles", "Dividers", "EntranceWall", "GreyChairs", "ITLabsLeft", "ITLabsRight", "Kiosk",
+    "LabWallsLeft", "LabWallsRight", "LabWindowFrames", "MainFloor", "MiniCoffeeTable", "Railings",
+    "RoofFraming", "Underflooring", "WallDecorLeft", "WallDecorRight", "CoffeeMachine", "CashRegister", "OtherLights", "Lights", "Cans", "PopcornMachine"
+};
+
+// --- Point Lights ---
+struct PointLightData {
+    glm::vec3 position;
+    float linear;
+    float quadratic;
+};
+
+const float POINT_LIGHT_CONSTANT = 1.0f;
+const glm::vec3 POINT_LIGHT_AMBIENT = glm::vec3(0.0002f);
+const glm::vec3 POINT_LIGHT_DIFFUSE = glm::vec3(0.05f);
+const glm::vec3 POINT_LIGHT_SPECULAR = glm::vec3(0.1f);
+
+// Positions transformed from the Blender export
+const PointLightData SCENE_POINT_LIGHTS[] = {
+    // Light 1 - Attenuation for ~160 units
+    { glm::vec3(0.154029f, -21.925095f, -22.325785f), 0.022f, 0.0019f },
+    // Light 2 (Original pointLights[1] - Transformed from Blender Light.002)
+    { glm::vec3(-30.696480f, -21.925095f, -22.325785f), 0.022f, 0.0019f },
+    // Light 3 (Transformed from Blender Light.003) - Adjusted attenuation for potentially larger distance
+    { glm::vec3(-65.954384f, -21.925095f, -22.325785f), 0.014f, 0.0007f },
+    // Light 4 (Transformed from Blender Light.004)
+    { glm::vec3(-1.367252f, 17.311728f, -22.325785f), 0.022f, 0.0019f },
+    // Light 5 (Transformed from Blender Light.005)
+    { glm::vec3(-32.221157f, 17.290623f, -22.325785f), 0.014f, 0.0007f },
+    // Light 6 (Transformed from Blender Light.006) - Further distance
+    { glm::vec3(-67.484856f, 17.297579f, -22.325785f), 0.007f, 0.0002f },
+    // Light 7 (Transformed from Blender Light.007)
+    { glm::vec3(29.528439f, 17.187288f, -22.325785f), 0.014f, 0.0007f },
+    // Light 8 (Transformed from Blender Cube.010)
+    { glm::vec3(0.403565f, 16.272787f, -23.359404f), 0.022f, 0.0019f },
+    // Light 9 (Transformed from Blender Cube.013)
+    { glm::vec3(-30.437645f, 16.273632f, -23.359404f), 0.014f, 0.0007f },
+    // Light 10 (Transformed from Blender Cube.014)
+    { glm::vec3(-1.605055f, 16.320671f, -23.359404f), 0.022f, 0.0019f },
+    // Light 11 (Transformed from Blender Cube.017)
+    { glm::vec3(31.253157f, 16.073551f, -23.359404f), 0.014f, 0.0007f },
+    // Light 12 (Blender Light.008)
+    { glm::vec3(73.030205f, 29.086636f, 0.262677f), 0.007f, 0.0002f },
+    // Light 13 (Blender Light.009)
+    { glm::vec3(73.030205f, 37.828785f, 0.262677f), 0.007f, 0.0002f },
+    // Light 14 (Blender Light.011)
+    { glm::vec3(73.030205f, 5.471813f, 0.262677f), 0.014f, 0.0007f },
+    // Light 15 (Blender Light.014)
+    { glm::vec3(-97.400917f, 19.527908f, -29.851522f), 0.007f, 0.0002f },
+    // Light 16 (Blender Light.015)
+    { glm::vec3(-66.798378f, 6.912896f, -28.229601f), 0.014f, 0.0007f },
+    // Light 17 (Blender Light.016)
+    { glm::vec3(-44.519119f, -1.154248f, 16.305470f), 0.022f, 0.0019f },
+    // Light 18 (Blender Light.017)
+    { glm::vec3(31.984005f, -1.154248f, 16.305470f), 0.022f, 0.0019f },
+    // Light 19 (Blender Light.018)
+    { glm::vec3(-6.326900f, -1.154248f, 16.305470f), 0.022f, 0.0019f },
+    // Light 20 (Blender Light.019 - Note: This was a duplicate position in your list, I used a slightly different Z for uniqueness)
+    { glm::vec3(-44.519119f, -1.154248f, 15.305470f), 0.022f, 0.0019f },
+};
+const int SCENE_POINT_LIGHT_COUNT = sizeof(SCENE_POINT_LIGHTS) / sizeof(SCENE_POINT_LIGHTS[0]);
+
+// Distance at which a light's diffuse contribution drops below one 8-bit step,
+// i.e. where constant + linear*d + quadratic*d^2 reaches 256 * diffuse
+inline float pointLightRadius(const PointLightData& light) {
+    float cutoff = 256.0f * POINT_LIGHT_DIFFUSE.x;
+    float c = POINT_LIGHT_CONSTANT - cutoff;
+    return (-light.linear + std::sqrt(light.linear * light.linear - 4.0f * light.quadratic * c)) / (2.0f * light.quadratic);
+}
+
+#endif
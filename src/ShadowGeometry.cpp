@@ -0,0 +1,115 @@
+#include "ShadowGeometry.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cmath>
+#include <iostream>
+
+static const float QUANTIZE_MAX = 65535.0f;
+
+ShadowGeometry::ShadowGeometry(bool quantize)
+    : quantize(quantize), VAO(0), VBO(0), EBO(0), vertexCount(0),
+      uploadedVertexBytes(0), uploadedIndexBytes(0), sourceVertexBytes(0) {}
+
+ShadowGeometry::~ShadowGeometry() {
+    if (VAO != 0) glDeleteVertexArrays(1, &VAO);
+    if (VBO != 0) glDeleteBuffers(1, &VBO);
+    if (EBO != 0) glDeleteBuffers(1, &EBO);
+}
+
+int ShadowGeometry::addModel(const Model& model) {
+    Range range;
+    range.firstIndex = indices.size();
+    range.baseVertex = static_cast<GLint>(vertexCount);
+    range.dequantize = glm::mat4(1.0f);
+
+    glm::vec3 extent = model.boundsMax - model.boundsMin;
+    glm::vec3 toQuantized(0.0f);
+    if (quantize) {
+        for (int axis = 0; axis < 3; axis++)
+            toQuantized[axis] = extent[axis] > 0.0f ? QUANTIZE_MAX / extent[axis] : 0.0f;
+        range.dequantize = glm::translate(glm::mat4(1.0f), model.boundsMin);
+        range.dequantize = glm::scale(range.dequantize, extent / QUANTIZE_MAX);
+    }
+
+    // Indices are relative to the model's first vertex; baseVertex places them in the shared buffer
+    unsigned int modelVertex = 0;
+    for (const Mesh& mesh : model.meshes) {
+        for (const Vertex& vertex : mesh.vertices) {
+            if (quantize) {
+                glm::vec3 q = (vertex.Position - model.boundsMin) * toQuantized;
+                for (int axis = 0; axis < 3; axis++)
+                    quantizedPositions.push_back(static_cast<uint16_t>(std::lround(glm::clamp(q[axis], 0.0f, QUANTIZE_MAX))));
+                quantizedPositions.push_back(0); // pad to 8 bytes so every vertex stays 4-byte aligned
+            } else {
+                positions.push_back(vertex.Position.x);
+                positions.push_back(vertex.Position.y);
+                positions.push_back(vertex.Position.z);
+            }
+        }
+        for (unsigned int index : mesh.indices)
+            indices.push_back(modelVertex + index);
+        modelVertex += static_cast<unsigned int>(mesh.vertices.size());
+        sourceVertexBytes += mesh.vertices.size() * sizeof(Vertex);
+    }
+
+    vertexCount += modelVertex;
+    range.indexCount = static_cast<GLsizei>(indices.size() - range.firstIndex);
+    ranges.push_back(range);
+    return static_cast<int>(ranges.size() - 1);
+}
+
+void ShadowGeometry::upload() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    if (quantize) {
+        uploadedVertexBytes = quantizedPositions.size() * sizeof(uint16_t);
+        glBufferData(GL_ARRAY_BUFFER, uploadedVertexBytes, quantizedPositions.data(), GL_STATIC_DRAW);
+        // Not normalised: the shader sees 0..65535 and the range's dequantize matrix maps it back
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_FALSE, 4 * sizeof(uint16_t), (void*)0);
+    } else {
+        uploadedVertexBytes = positions.size() * sizeof(float);
+        glBufferData(GL_ARRAY_BUFFER, uploadedVertexBytes, positions.data(), GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    }
+
+    uploadedIndexBytes = indices.size() * sizeof(unsigned int);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, uploadedIndexBytes, indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+
+    // The GPU has its copy; the meshes keep their own CPU data for everything else
+    std::vector<float>().swap(positions);
+    std::vector<uint16_t>().swap(quantizedPositions);
+    std::vector<unsigned int>().swap(indices);
+}
+
+void ShadowGeometry::bind() const {
+    glBindVertexArray(VAO);
+}
+
+void ShadowGeometry::draw(int handle, GLint modelMatrixLoc, const glm::mat4& modelMatrix) const {
+    const Range& range = ranges[handle];
+    if (range.indexCount == 0) return;
+    glm::mat4 matrix = modelMatrix * range.dequantize;
+    glUniformMatrix4fv(modelMatrixLoc, 1, GL_FALSE, glm::value_ptr(matrix));
+    glDrawElementsBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT,
+                             (void*)(range.firstIndex * sizeof(unsigned int)), range.baseVertex);
+}
+
+void ShadowGeometry::unbind() const {
+    glBindVertexArray(0);
+}
+
+void ShadowGeometry::printStatus() const {
+    std::cout << "Shadow geometry: " << ranges.size() << " casters, " << vertexCount << " vertices, "
+              << uploadedVertexBytes / 1024 << " KB positions" << (quantize ? " (16-bit)" : "")
+              << " + " << uploadedIndexBytes / 1024 << " KB indices (vs " << sourceVertexBytes / 1024
+              << " KB interleaved)" << std::endl;
+}
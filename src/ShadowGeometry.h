@@ -0,0 +1,51 @@
+#ifndef SHADOW_GEOMETRY_H
+#define SHADOW_GEOMETRY_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "Model.h"
+
+// Position-only copy of the shadow casters for depth-only passes. depth_vertex.glsl only
+// reads aPos, so the depth pass draws from one shared VAO/VBO/EBO instead of binding every
+// Mesh's full interleaved vertices and textures, and each model becomes a single draw.
+// With quantisation, positions are stored as 16-bit integers relative to the model's bounds
+// (8 bytes per vertex); the dequantising scale/offset is folded into the model matrix, so
+// the shader is unchanged.
+class ShadowGeometry {
+public:
+    explicit ShadowGeometry(bool quantize);
+    ~ShadowGeometry();
+
+    int addModel(const Model& model); // returns a handle for draw(); call before upload()
+    void upload();
+
+    void bind() const;
+    void draw(int handle, GLint modelMatrixLoc, const glm::mat4& modelMatrix) const;
+    void unbind() const;
+
+    void printStatus() const;
+
+private:
+    struct Range {
+        GLsizei indexCount;
+        size_t firstIndex;
+        GLint baseVertex;
+        glm::mat4 dequantize; // identity for float positions
+    };
+
+    bool quantize;
+    GLuint VAO, VBO, EBO;
+    std::vector<Range> ranges;
+    std::vector<float> positions;            // xyz per vertex when not quantised
+    std::vector<uint16_t> quantizedPositions; // xyz + padding per vertex when quantised
+    std::vector<unsigned int> indices;
+    size_t vertexCount;
+    size_t uploadedVertexBytes;
+    size_t uploadedIndexBytes;
+    size_t sourceVertexBytes; // what the per-mesh interleaved buffers hold, for printStatus
+};
+
+#endif
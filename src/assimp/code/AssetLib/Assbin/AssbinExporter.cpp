@@ -47,20 +47,32 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssbinFileWriter.h"
 
+#include <assimp/config.h>
 #include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
 #include <assimp/Exporter.hpp>
 #include <assimp/IOSystem.hpp>
 
+#include "zlib.h"
+
+#include <algorithm>
+
 namespace Assimp {
 
-void ExportSceneAssbin(const char *pFile, IOSystem *pIOSystem, const aiScene *pScene, const ExportProperties * /*pProperties*/) {
+void ExportSceneAssbin(const char *pFile, IOSystem *pIOSystem, const aiScene *pScene, const ExportProperties *pProperties) {
+    const int configuredLevel = pProperties->GetPropertyInteger(AI_CONFIG_EXPORT_ASSBIN_COMPRESSION, Z_NO_COMPRESSION);
+    const int compressionLevel = std::min(std::max(configuredLevel, Z_NO_COMPRESSION), Z_BEST_COMPRESSION);
+    if (compressionLevel != configuredLevel) {
+        ASSIMP_LOG_WARN("ASSBIN: compression level ", configuredLevel, " is out of range, using ", compressionLevel);
+    }
     DumpSceneToAssbin(
             pFile,
             "\0", // no command(s).
             pIOSystem,
             pScene,
             false, // shortened?
-            false); // compressed?
+            compressionLevel > 0, // compressed?
+            compressionLevel);
 }
 } // end of namespace Assimp
 
@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "zlib.h"
 
 #include <ctime>
+#include <vector>
 
 #if _MSC_VER
 #pragma warning(push)
@@ -229,6 +230,53 @@ inline size_t WriteArray(IOStream *stream, const T *in, unsigned int size) {
     return n;
 }
 
+// -----------------------------------------------------------------------------------
+// Vectors and colors have no padding, so their arrays are written as one block
+template <>
+inline size_t WriteArray<aiVector3D>(IOStream *stream, const aiVector3D *in, unsigned int size) {
+    static_assert(sizeof(aiVector3D) == 3 * sizeof(ai_real), "aiVector3D is not packed");
+    stream->Write(in, sizeof(aiVector3D), size);
+
+    return sizeof(aiVector3D) * size;
+}
+
+// -----------------------------------------------------------------------------------
+template <>
+inline size_t WriteArray<aiColor4D>(IOStream *stream, const aiColor4D *in, unsigned int size) {
+    static_assert(sizeof(aiColor4D) == 4 * sizeof(ai_real), "aiColor4D is not packed");
+    stream->Write(in, sizeof(aiColor4D), size);
+
+    return sizeof(aiColor4D) * size;
+}
+
+// -----------------------------------------------------------------------------------
+// Serialize the faces of a mesh in one block, with indices of type T
+template <typename T>
+inline size_t WriteFaces(IOStream *stream, const aiFace *faces, unsigned int numFaces) {
+    std::vector<uint8_t> data;
+    data.reserve(numFaces * (sizeof(uint16_t) + 3 * sizeof(T)));
+    for (unsigned int i = 0; i < numFaces; ++i) {
+        const aiFace &f = faces[i];
+
+        static_assert(AI_MAX_FACE_INDICES <= 0xffff, "AI_MAX_FACE_INDICES <= 0xffff");
+        const uint16_t numIndices = static_cast<uint16_t>(f.mNumIndices);
+        size_t pos = data.size();
+        data.resize(pos + sizeof(uint16_t) + f.mNumIndices * sizeof(T));
+        memcpy(&data[pos], &numIndices, sizeof(uint16_t));
+        pos += sizeof(uint16_t);
+
+        for (unsigned int a = 0; a < f.mNumIndices; ++a, pos += sizeof(T)) {
+            const T index = static_cast<T>(f.mIndices[a]);
+            memcpy(&data[pos], &index, sizeof(T));
+        }
+    }
+
+    if (!data.empty()) {
+        stream->Write(data.data(), 1, data.size());
+    }
+    return data.size();
+}
+
 // ----------------------------------------------------------------------------------
 /** @class  AssbinChunkWriter
  *  @brief  Chunk writer mechanism for the .assbin file structure
@@ -327,6 +375,7 @@ class AssbinFileWriter {
 private:
     bool shortened;
     bool compressed;
+    int compressionLevel;
 
 protected:
     // -----------------------------------------------------------------------------------
@@ -425,7 +474,9 @@ protected:
 
     // -----------------------------------------------------------------------------------
     void WriteBinaryMesh(IOStream *container, const aiMesh *mesh) {
-        AssbinChunkWriter chunk(container, ASSBIN_CHUNK_AIMESH);
+        // start with room for the positions, normals and triangles
+        AssbinChunkWriter chunk(container, ASSBIN_CHUNK_AIMESH,
+                std::max<size_t>(4096, mesh->mNumVertices * 2 * sizeof(aiVector3D) + mesh->mNumFaces * 14));
 
         Write<unsigned int>(&chunk, mesh->mPrimitiveTypes);
         Write<unsigned int>(&chunk, mesh->mNumVertices);
@@ -531,19 +582,10 @@ protected:
         } else // else write as usual
         {
             // if there are less than 2^16 vertices, we can simply use 16 bit integers ...
-            for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
-                const aiFace &f = mesh->mFaces[i];
-
-                static_assert(AI_MAX_FACE_INDICES <= 0xffff, "AI_MAX_FACE_INDICES <= 0xffff");
-                Write<uint16_t>(&chunk, static_cast<uint16_t>(f.mNumIndices));
-
-                for (unsigned int a = 0; a < f.mNumIndices; ++a) {
-                    if (mesh->mNumVertices < (1u << 16)) {
-                        Write<uint16_t>(&chunk, static_cast<uint16_t>(f.mIndices[a]));
-                    } else {
-                        Write<unsigned int>(&chunk, f.mIndices[a]);
-                    }
-                }
+            if (mesh->mNumVertices < (1u << 16)) {
+                WriteFaces<uint16_t>(&chunk, mesh->mFaces, mesh->mNumFaces);
+            } else {
+                WriteFaces<uint32_t>(&chunk, mesh->mFaces, mesh->mNumFaces);
             }
         }
 
@@ -726,8 +768,8 @@ protected:
     }
 
 public:
-    AssbinFileWriter(bool shortened, bool compressed) :
-            shortened(shortened), compressed(compressed) {
+    AssbinFileWriter(bool shortened, bool compressed, int compressionLevel) :
+            shortened(shortened), compressed(compressed), compressionLevel(compressionLevel) {
     }
 
     // -----------------------------------------------------------------------------------
@@ -780,9 +822,12 @@ public:
             ai_snprintf(buff, 128, "%s", cmd);
             out->Write(buff, sizeof(char), 128);
 
-            // leave 64 bytes free for future extensions
-            memset(buff, 0xcd, 64);
-            out->Write(buff, sizeof(char), 64);
+            // lets the loader detect a different byte order
+            Write<unsigned int>(out, ASSBIN_BYTE_ORDER_MARK);
+
+            // leave 60 bytes free for future extensions
+            memset(buff, 0xcd, 60);
+            out->Write(buff, sizeof(char), 60);
             // == 435 bytes
 
             // ==== total header size: 512 bytes
@@ -798,7 +843,7 @@ public:
                 uLongf compressedSize = (uLongf)compressBound(uncompressedSize);
                 uint8_t *compressedBuffer = new uint8_t[compressedSize];
 
-                int res = compress2(compressedBuffer, &compressedSize, (const Bytef *)uncompressedStream.GetBufferPointer(), uncompressedSize, 9);
+                int res = compress2(compressedBuffer, &compressedSize, (const Bytef *)uncompressedStream.GetBufferPointer(), uncompressedSize, compressionLevel);
                 if (res != Z_OK) {
                     delete[] compressedBuffer;
                     throw DeadlyExportError("Compression failed.");
@@ -822,8 +867,8 @@ public:
 
 void DumpSceneToAssbin(
         const char *pFile, const char *cmd, IOSystem *pIOSystem,
-        const aiScene *pScene, bool shortened, bool compressed) {
-    AssbinFileWriter fileWriter(shortened, compressed);
+        const aiScene *pScene, bool shortened, bool compressed, int compressionLevel) {
+    AssbinFileWriter fileWriter(shortened, compressed, compressionLevel);
     fileWriter.WriteBinaryDump(pFile, cmd, pIOSystem, pScene);
 }
 #if _MSC_VER
@@ -50,12 +50,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // internal headers
 #include "AssbinLoader.h"
 #include "Common/assbin_chunks.h"
+#include <assimp/ByteSwapper.h>
 #include <assimp/MemoryIOWrapper.h>
 #include <assimp/anim.h>
 #include <assimp/importerdesc.h>
 #include <assimp/mesh.h>
 #include <assimp/scene.h>
+#include <assimp/version.h>
 #include <memory>
+#include <vector>
 
 #ifdef ASSIMP_BUILD_NO_OWN_ZLIB
 #include <zlib.h>
@@ -208,6 +211,25 @@ void ReadArray(IOStream *stream, T *out, unsigned int size) {
     }
 }
 
+// -----------------------------------------------------------------------------------
+// Vectors and colors have no padding, so their arrays are read as one block
+template <>
+void ReadArray<aiVector3D>(IOStream *stream, aiVector3D *out, unsigned int size) {
+    static_assert(sizeof(aiVector3D) == 3 * sizeof(ai_real), "aiVector3D is not packed");
+    if (stream->Read(out, sizeof(aiVector3D), size) != size) {
+        throw DeadlyImportError("Unexpected EOF");
+    }
+}
+
+// -----------------------------------------------------------------------------------
+template <>
+void ReadArray<aiColor4D>(IOStream *stream, aiColor4D *out, unsigned int size) {
+    static_assert(sizeof(aiColor4D) == 4 * sizeof(ai_real), "aiColor4D is not packed");
+    if (stream->Read(out, sizeof(aiColor4D), size) != size) {
+        throw DeadlyImportError("Unexpected EOF");
+    }
+}
+
 // -----------------------------------------------------------------------------------
 template <typename T>
 void ReadBounds(IOStream *stream, T * /*p*/, unsigned int n) {
@@ -401,21 +423,30 @@ void AssbinImporter::ReadBinaryMesh(IOStream *stream, aiMesh *mesh) {
     } else {
         // else write as usual
         // if there are less than 2^16 vertices, we can simply use 16 bit integers ...
+        const bool shortIndices = fitsIntoUI16(mesh->mNumVertices);
+        std::vector<uint16_t> indices16;
         mesh->mFaces = new aiFace[mesh->mNumFaces];
         for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
             aiFace &f = mesh->mFaces[i];
 
             static_assert(AI_MAX_FACE_INDICES <= 0xffff, "AI_MAX_FACE_INDICES <= 0xffff");
             f.mNumIndices = Read<uint16_t>(stream);
-            f.mIndices = new unsigned int[f.mNumIndices];
-
-            for (unsigned int a = 0; a < f.mNumIndices; ++a) {
-                // Check if unsigned  short ( 16 bit  ) are big enough for the indices
-                if (fitsIntoUI16(mesh->mNumVertices)) {
-                    f.mIndices[a] = Read<uint16_t>(stream);
-                } else {
-                    f.mIndices[a] = Read<unsigned int>(stream);
-                }
+            f.mIndices = mesh->AllocateFaceIndices(f.mNumIndices);
+            if (0 == f.mNumIndices) {
+                continue;
+            }
+
+            // read all indices of the face at once
+            size_t read;
+            if (shortIndices) {
+                indices16.resize(f.mNumIndices);
+                read = stream->Read(indices16.data(), sizeof(uint16_t), f.mNumIndices);
+                std::copy(indices16.begin(), indices16.begin() + read, f.mIndices);
+            } else {
+                read = stream->Read(f.mIndices, sizeof(uint32_t), f.mNumIndices);
+            }
+            if (read != f.mNumIndices) {
+                throw DeadlyImportError("Unexpected EOF");
             }
         }
     }
@@ -693,7 +724,13 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
     }
 
     /*unsigned int versionRevision =*/Read<unsigned int>(stream);
-    /*unsigned int compileFlags =*/Read<unsigned int>(stream);
+    const unsigned int compileFlags = Read<unsigned int>(stream);
+
+    // vertex data is stored as it is laid out in memory
+    if ((compileFlags ^ aiGetCompileFlags()) & ASSIMP_CFLAGS_DOUBLE_SUPPORT) {
+        pIOHandler->Close(stream);
+        throw DeadlyImportError("ASSBIN: File was written with a different floating-point precision");
+    }
 
     shortened = Read<uint16_t>(stream) > 0;
     compressed = Read<uint16_t>(stream) > 0;
@@ -705,22 +742,38 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
 
     stream->Seek(256, aiOrigin_CUR); // original filename
     stream->Seek(128, aiOrigin_CUR); // options
-    stream->Seek(64, aiOrigin_CUR); // padding
+
+    // older files have padding here
+    uint32_t byteOrderMark = Read<uint32_t>(stream);
+    ByteSwap::Swap(&byteOrderMark);
+    if (ASSBIN_BYTE_ORDER_MARK == byteOrderMark) {
+        pIOHandler->Close(stream);
+        throw DeadlyImportError("ASSBIN: File was written with a different byte order");
+    }
+    stream->Seek(60, aiOrigin_CUR); // padding
 
     if (compressed) {
         uLongf uncompressedSize = Read<uint32_t>(stream);
         uLongf compressedSize = static_cast<uLongf>(stream->FileSize() - stream->Tell());
 
-        unsigned char *compressedData = new unsigned char[compressedSize];
-        size_t len = stream->Read(compressedData, 1, compressedSize);
-        ai_assert(len == compressedSize);
+        // inflate straight out of a mapped stream, otherwise read the compressed data first
+        std::unique_ptr<unsigned char[]> compressedCopy;
+        const unsigned char *compressedData = stream->GetMappedData();
+        size_t len = compressedSize;
+        if (nullptr != compressedData) {
+            compressedData += stream->Tell();
+        } else {
+            compressedCopy.reset(new unsigned char[compressedSize]);
+            len = stream->Read(compressedCopy.get(), 1, compressedSize);
+            ai_assert(len == compressedSize);
+            compressedData = compressedCopy.get();
+        }
 
         unsigned char *uncompressedData = new unsigned char[uncompressedSize];
 
         int res = uncompress(uncompressedData, &uncompressedSize, compressedData, (uLong)len);
         if (res != Z_OK) {
             delete[] uncompressedData;
-            delete[] compressedData;
             pIOHandler->Close(stream);
             throw DeadlyImportError("Zlib decompression failed.");
         }
@@ -730,9 +783,25 @@ void AssbinImporter::InternReadFile(const std::string &pFile, aiScene *pScene, I
         ReadBinaryScene(&io, pScene);
 
         delete[] uncompressedData;
-        delete[] compressedData;
     } else {
-        ReadBinaryScene(stream, pScene);
+        // the scene is read in many small pieces, so read them from memory
+        const size_t offset = stream->Tell();
+        const size_t size = stream->FileSize() - offset;
+        std::unique_ptr<uint8_t[]> copy;
+        const uint8_t *data = stream->GetMappedData();
+        if (nullptr != data) {
+            data += offset;
+        } else {
+            copy.reset(new uint8_t[size]);
+            if (stream->Read(copy.get(), 1, size) != size) {
+                pIOHandler->Close(stream);
+                throw DeadlyImportError("ASSBIN: Unexpected EOF");
+            }
+            data = copy.get();
+        }
+
+        MemoryIOStream io(data, size);
+        ReadBinaryScene(&io, pScene);
     }
 
     pIOHandler->Close(stream);
@@ -56,6 +56,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/Profiler.h>
 
 #include <numeric>
 
@@ -154,13 +155,16 @@ void ColladaLoader::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     mAnims.clear();
 
     // parse the input file
+    Profiling::ProfileScope parse(m_profiler, "parse");
     ColladaParser parser(pIOHandler, pFile);
+    parse.End();
 
     if (!parser.mRootNode) {
         throw DeadlyImportError("Collada: File came out empty. Something is wrong here.");
     }
 
     // reserve some storage to avoid unnecessary reallocates
+    Profiling::ProfileScope convert(m_profiler, "convert");
     newMats.reserve(parser.mMaterialLibrary.size() * 2u);
     mMeshes.reserve(parser.mMeshLibrary.size() * 2u);
 
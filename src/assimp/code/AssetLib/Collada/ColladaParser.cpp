@@ -76,6 +76,60 @@ static void ReportWarning(const char *msg, ...) {
     ASSIMP_LOG_WARN("Validation warning: ", std::string(szBuffer, iLen));
 }
 
+// ------------------------------------------------------------------------------------------------
+// Marks the elements whose contents were converted while streaming the file, the value is the
+// index into mStreamedValues or mStreamedIndices
+static constexpr char StreamedAttribute[] = "assimp_streamed";
+
+// ------------------------------------------------------------------------------------------------
+static bool IsPrimitiveElement(const std::string &name) {
+    return name == "triangles" || name == "lines" || name == "linestrips" || name == "polygons" ||
+           name == "polylist" || name == "trifans" || name == "tristrips";
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads the numbers of a <float_array>, or the part of it in [content, end)
+static void ReadValues(const char *content, const char *end, std::vector<ai_real> &values) {
+    ai_real batch[256];
+    SkipSpacesAndLineEnd(&content, end);
+    while (content != end) {
+        // convert the plain numbers in one go, fast_atoreal_move() picks up whatever the batch left
+        const size_t count = fast_atoreal_n<ai_real>(content, end, batch, 256);
+        values.insert(values.end(), batch, batch + count);
+        SkipSpacesAndLineEnd(&content, end);
+        if (content != end && count < 256) {
+            ai_real value = 0;
+            content = fast_atoreal_move<ai_real>(content, value);
+            values.push_back(value);
+            SkipSpacesAndLineEnd(&content, end);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads the indices of a <p> element, or the part of it in [content, end)
+static void ReadIndices(const char *content, const char *end, std::vector<size_t> &indices) {
+    SkipSpacesAndLineEnd(&content, end);
+    while (content != end) {
+        // read a value.
+        uint64_t value = 0;
+        const unsigned int digits = strtoul10_run(content, end, value, 10);
+        if (0 != digits) {
+            content += digits;
+            indices.push_back(size_t(value));
+        } else {
+            // Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
+            const char *start = content;
+            indices.push_back(size_t(std::max(0, strtol10(content, &content))));
+            if (content == start) {
+                throw DeadlyImportError("Unexpected character in <p> element.");
+            }
+        }
+        // skip whitespace after it
+        SkipSpacesAndLineEnd(&content, end);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 static bool FindCommonKey(const std::string &collada_key, const MetaKeyPairVector &key_renaming, size_t &found_index) {
     for (size_t i = 0; i < key_renaming.size(); ++i) {
@@ -449,8 +503,19 @@ ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile) :
         }
     }
 
-    // generate a XML reader for it
-    if (!mXmlParser.parse(daeFile.get())) {
+    // Stream the file and convert the large number arrays on the way, the document is built from
+    // the rest only. The pull reader does not handle UTF-16, such files are parsed as a whole.
+    XmlPullReader reader(daeFile.get());
+    bool parsed = false;
+    if (reader.isUtf8()) {
+        std::vector<char> document;
+        ReadLargeArrays(reader, document);
+        parsed = mXmlParser.parse(std::move(document));
+    } else {
+        daeFile->Seek(0, aiOrigin_SET);
+        parsed = mXmlParser.parse(daeFile.get());
+    }
+    if (!parsed) {
         throw DeadlyImportError("Unable to read file, malformed XML");
     }
     // start reading
@@ -478,6 +543,68 @@ ColladaParser::~ColladaParser() {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Streams the file and converts the contents of <source><float_array> and of the <p> elements
+// of the primitives straight into mStreamedValues and mStreamedIndices. The elements are marked
+// with StreamedAttribute, everything else is copied into document as it is.
+void ColladaParser::ReadLargeArrays(XmlPullReader &reader, std::vector<char> &document) {
+    std::vector<std::string> openElements;
+    std::vector<ai_real> *values = nullptr;
+    std::vector<size_t> *indices = nullptr;
+    const char *begin = nullptr;
+    const char *end = nullptr;
+    for (XmlPullReader::Event event = reader.next(); event != XmlPullReader::EndOfDocument; event = reader.next()) {
+        reader.getRaw(begin, end);
+        if (event == XmlPullReader::Text && nullptr != values) {
+            ReadValues(begin, end, *values);
+            continue;
+        }
+        if (event == XmlPullReader::Text && nullptr != indices) {
+            ReadIndices(begin, end, *indices);
+            continue;
+        }
+
+        if (event == XmlPullReader::StartElement) {
+            values = nullptr;
+            indices = nullptr;
+            const std::string &name = reader.getName();
+            const bool isValues = name == "float_array" && !openElements.empty() && openElements.back() == "source";
+            const bool isIndices = name == "p" && !openElements.empty() && IsPrimitiveElement(openElements.back());
+            openElements.push_back(name);
+            if (!reader.isEmptyElement() && (isValues || isIndices)) {
+                size_t index = 0;
+                if (isValues) {
+                    index = mStreamedValues.size();
+                    mStreamedValues.emplace_back();
+                    values = &mStreamedValues.back();
+                    std::string count;
+                    if (reader.getAttribute("count", count)) {
+                        // the count is not trusted with more than the first few million values
+                        values->reserve(std::min<size_t>(strtoul10(count.c_str()), 1 << 24));
+                    }
+                } else {
+                    index = mStreamedIndices.size();
+                    mStreamedIndices.emplace_back();
+                    indices = &mStreamedIndices.back();
+                }
+
+                // copy the start tag up to its '>' and mark the element
+                document.insert(document.end(), begin, end - 1);
+                const std::string mark = std::string(" ") + StreamedAttribute + "=\"" + ai_to_string(index) + "\">";
+                document.insert(document.end(), mark.begin(), mark.end());
+                continue;
+            }
+        } else if (event == XmlPullReader::EndElement) {
+            values = nullptr;
+            indices = nullptr;
+            if (!openElements.empty()) {
+                openElements.pop_back();
+            }
+        }
+        document.insert(document.end(), begin, end);
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 // Read a ZAE manifest and return the filename to attempt to open
 std::string ColladaParser::ReadZaeManifest(ZipArchiveIOSystem &zip_archive) {
@@ -1453,17 +1580,28 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
     XmlParser::getStdStrAttribute(node, "id", id);
     unsigned int count = 0;
     XmlParser::getUIntAttribute(node, "count", count);
-    std::string v;
-    XmlParser::getValueAsString(node, v);
-    v = ai_trim(v);
-    const char *content = v.c_str();
-    const char *end = content + v.size();
+    // the values are read straight from the document text, without copying it first
+    const char *content = nullptr;
+    const char *end = nullptr;
+    XmlParser::getValueAsText(node, content, end);
 
     // read values and store inside an array in the data library
     mDataLibrary[id] = Data();
     Data &data = mDataLibrary[id];
     data.mIsStringArray = isStringArray;
 
+    // the values were converted while streaming the file
+    unsigned int streamed = 0;
+    if (!isStringArray && XmlParser::getUIntAttribute(node, StreamedAttribute, streamed) && streamed < mStreamedValues.size()) {
+        std::vector<ai_real> &values = mStreamedValues[streamed];
+        if (values.size() < count) {
+            throw DeadlyImportError("Expected more values while reading float_array contents.");
+        }
+        values.resize(count);
+        data.mValues = std::move(values);
+        return;
+    }
+
     // some exporters write empty data arrays, but we need to conserve them anyways because others might reference them
     if (content) {
         if (isStringArray) {
@@ -1471,12 +1609,12 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
             std::string s;
 
             for (unsigned int a = 0; a < count; a++) {
-                if (*content == 0) {
+                if (content == end) {
                     throw DeadlyImportError("Expected more values while reading IDREF_array contents.");
                 }
 
                 s.clear();
-                while (!IsSpaceOrNewLine(*content)) {
+                while (content != end && !IsSpaceOrNewLine(*content)) {
                     s += *content;
                     content++;
                 }
@@ -1485,17 +1623,16 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
                 SkipSpacesAndLineEnd(&content, end);
             }
         } else {
-            data.mValues.reserve(count);
+            data.mValues.resize(count);
 
-            for (unsigned int a = 0; a < count; a++) {
-                if (*content == 0) {
+            // convert the plain numbers in one go, the loop picks up whatever the batch left
+            for (size_t a = fast_atoreal_n<ai_real>(content, end, data.mValues.data(), count); a < count; a++) {
+                if (content == end) {
                     throw DeadlyImportError("Expected more values while reading float_array contents.");
                 }
 
                 // read a number
-                ai_real value;
-                content = fast_atoreal_move<ai_real>(content, value);
-                data.mValues.push_back(value);
+                content = fast_atoreal_move<ai_real>(content, data.mValues[a]);
                 // skip whitespace after it
                 SkipSpacesAndLineEnd(&content, end);
             }
@@ -1778,19 +1915,16 @@ size_t ColladaParser::ReadPrimitives(XmlNode &node, Mesh &pMesh, std::vector<Inp
 
     // It is possible to not contain any indices
     if (pNumPrimitives > 0) {
-        std::string v;
-        XmlParser::getValueAsString(node, v);
-        const char *content = v.c_str();
-        const char *end = content + v.size();
-
-        SkipSpacesAndLineEnd(&content, end);
-        while (*content != 0) {
-            // read a value.
-            // Hack: (thom) Some exporters put negative indices sometimes. We just try to carry on anyways.
-            int value = std::max(0, strtol10(content, &content));
-            indices.push_back(size_t(value));
-            // skip whitespace after it
-            SkipSpacesAndLineEnd(&content, end);
+        unsigned int streamed = 0;
+        if (XmlParser::getUIntAttribute(node, StreamedAttribute, streamed) && streamed < mStreamedIndices.size()) {
+            // the indices were converted while streaming the file
+            indices = std::move(mStreamedIndices[streamed]);
+        } else {
+            // the indices are read straight from the document text, without copying it first
+            const char *content = nullptr;
+            const char *end = nullptr;
+            XmlParser::getValueAsText(node, content, end);
+            ReadIndices(content, end, indices);
         }
     }
 
@@ -157,6 +157,10 @@ public:
     /// Reads a mesh from the geometry library
     void ReadMesh(XmlNode &node, Collada::Mesh &pMesh);
 
+    /// Streams the file and converts the contents of the large number arrays on the way,
+    /// everything else is copied into the document
+    void ReadLargeArrays(XmlPullReader &reader, std::vector<char> &document);
+
     /// Reads a source element - a combination of raw data and an accessor defining
     ///things that should not be definable. Yes, that's another rant.
     void ReadSource(XmlNode &node);
@@ -233,6 +237,12 @@ private:
     /// XML reader, member for everyday use
     XmlParser mXmlParser;
 
+    /// Contents of the <float_array> elements, converted while streaming the file
+    std::vector<std::vector<ai_real>> mStreamedValues;
+
+    /// Contents of the <p> elements, converted while streaming the file
+    std::vector<std::vector<size_t>> mStreamedIndices;
+
     /// All data arrays found in the file by ID. Might be referred to by actually
     ///     everyone. Collada, you are a steaming pile of indirection.
     using DataLibrary = std::map<std::string, Collada::Data> ;
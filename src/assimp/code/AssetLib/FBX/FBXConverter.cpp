@@ -1137,11 +1137,14 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
     out_mesh->mNumFaces = static_cast<unsigned int>(faces.size());
     aiFace *fac = out_mesh->mFaces = new aiFace[faces.size()]();
 
+    // every face vertex is a vertex of its own, so the faces need exactly that many indices
+    unsigned int *indices = out_mesh->AllocateFaceIndices(vertices.size());
     unsigned int cursor = 0;
     for (unsigned int pcount : faces) {
         aiFace &f = *fac++;
         f.mNumIndices = pcount;
-        f.mIndices = new unsigned int[pcount];
+        f.mIndices = indices;
+        indices += pcount;
         switch (pcount) {
             case 1:
                 out_mesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
@@ -1361,6 +1364,7 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
 
     out_mesh->mNumFaces = count_faces;
     aiFace *fac = out_mesh->mFaces = new aiFace[count_faces]();
+    unsigned int *indices = out_mesh->AllocateFaceIndices(count_vertices);
 
     // allocate normals
     const std::vector<aiVector3D> &normals = mesh.GetNormals();
@@ -1435,7 +1439,8 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
         aiFace &f = *fac++;
 
         f.mNumIndices = pcount;
-        f.mIndices = new unsigned int[pcount];
+        f.mIndices = indices;
+        indices += pcount;
         switch (pcount) {
             case 1:
                 out_mesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
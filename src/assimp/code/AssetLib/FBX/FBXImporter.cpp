@@ -54,6 +54,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXUtil.h"
 
 #include <assimp/MemoryIOWrapper.h>
+#include <assimp/Profiler.h>
 #include <assimp/StreamReader.h>
 #include <assimp/importerdesc.h>
 #include <assimp/Importer.hpp>
@@ -138,22 +139,31 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	// files can grow large, but the assimp output data structure
 	// then becomes very large, too. Assimp doesn't support
 	// streaming for its output data structures so the net win with
-	// streaming input data would be very low.
+	// streaming input data would be very low. Binary files which
+	// are mapped into memory are tokenized in place.
+	Profiling::ProfileScope read(m_profiler, "read");
 	std::vector<char> contents;
-	contents.resize(stream->FileSize() + 1);
-	stream->Read(&*contents.begin(), 1, contents.size() - 1);
-	contents[contents.size() - 1] = 0;
-	const char *const begin = &*contents.begin();
+	const char *begin = reinterpret_cast<const char *>(stream->GetMappedData());
+	size_t length = stream->FileSize();
+	if (nullptr == begin || length < 18 || strncmp(begin, "Kaydara FBX Binary", 18)) {
+		contents.resize(length + 1);
+		stream->Read(&*contents.begin(), 1, contents.size() - 1);
+		contents[contents.size() - 1] = 0;
+		begin = &*contents.begin();
+		length = contents.size();
+	}
+	read.End();
 
 	// broad-phase tokenized pass in which we identify the core
 	// syntax elements of FBX (brackets, commas, key:value mappings)
 	TokenList tokens;
     Assimp::StackAllocator tempAllocator;
     try {
+		Profiling::ProfileScope parse(m_profiler, "parse");
 		bool is_binary = false;
 		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
 			is_binary = true;
-            TokenizeBinary(tokens, begin, contents.size(), tempAllocator);
+            TokenizeBinary(tokens, begin, length, tempAllocator);
 		} else {
             Tokenize(tokens, begin, tempAllocator);
 		}
@@ -161,12 +171,18 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 		// use this information to construct a very rudimentary
 		// parse-tree representing the FBX scope structure
         Parser parser(tokens, tempAllocator, is_binary);
+        if (nullptr != m_threadPool) {
+            parser.InflateArrays(*m_threadPool);
+        }
 
 		// take the raw parse-tree and convert it to a FBX DOM
 		Document doc(parser, mSettings);
+		parse.End();
 
 		// convert the FBX DOM to aiScene
+		Profiling::ProfileScope convert(m_profiler, "convert");
 		ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones);
+		convert.End();
 
 		// size relative to cm
 		float size_relative_to_cm = doc.GlobalSettings().UnitScaleFactor();
@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_IMPORTER
 
 #include "Common/Compression.h"
+#include "Common/ThreadPool.h"
 
 #include "FBXTokenizer.h"
 #include "FBXParser.h"
@@ -56,7 +57,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ByteSwapper.h>
 #include <assimp/DefaultLogger.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 using namespace Assimp;
 using namespace Assimp::FBX;
@@ -112,7 +115,7 @@ namespace FBX {
 
 // ------------------------------------------------------------------------------------------------
 Element::Element(const Token& key_token, Parser& parser) :
-    key_token(key_token), compound(nullptr)
+    key_token(key_token), parser(parser), compound(nullptr)
 {
     TokenPtr n = nullptr;
     StackAllocator &allocator = parser.GetAllocator();
@@ -238,6 +241,108 @@ Parser::~Parser()
     delete_Scope(root);
 }
 
+// ------------------------------------------------------------------------------------------------
+void Parser::InflateArrays(ThreadPool& pool)
+{
+    if (!is_binary) {
+        return;
+    }
+
+    // a binary data array token holds its type code, the element count, the
+    // compression mode and the compressed length, followed by the payload
+    struct Job {
+        const char* data;
+        uint32_t comp_len;
+        size_t length;
+    };
+    std::vector<Job> jobs;
+    for (const Token* t : tokens) {
+        if (t->Type() != TokenType_DATA || !t->IsBinary() || t->end() - t->begin() < 13) {
+            continue;
+        }
+
+        const char* data = t->begin();
+        size_t stride = 0;
+        switch (*data) {
+            case 'f':
+            case 'i':
+                stride = 4;
+                break;
+            case 'd':
+            case 'l':
+                stride = 8;
+                break;
+            default:
+                continue;
+        }
+
+        BE_NCONST uint32_t count = SafeParse<uint32_t>(data + 1, t->end());
+        AI_SWAP4(count);
+        BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data + 5, t->end());
+        AI_SWAP4(encmode);
+        BE_NCONST uint32_t comp_len = SafeParse<uint32_t>(data + 9, t->end());
+        AI_SWAP4(comp_len);
+        if (encmode != 1 || static_cast<size_t>(t->end() - data) != 13 + static_cast<size_t>(comp_len)) {
+            continue;
+        }
+
+        // the count is not trusted yet: skip arrays the serial reader cannot size either
+        // and arrays deflate cannot produce from comp_len bytes (at most ~1032:1)
+        const uint64_t length = static_cast<uint64_t>(stride) * count;
+        if (length > std::numeric_limits<uint32_t>::max() || length > static_cast<uint64_t>(comp_len) * 1032u) {
+            continue;
+        }
+        jobs.push_back({ data + 5, comp_len, static_cast<size_t>(length) });
+    }
+    if (jobs.empty()) {
+        return;
+    }
+
+    // inflate the largest arrays first, so they don't end up last on one thread
+    std::sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) { return a.comp_len > b.comp_len; });
+
+    std::vector<std::vector<char>> results(jobs.size());
+    std::vector<char> valid(jobs.size(), 0);
+    pool.ParallelFor(jobs.size(), [&](size_t i) {
+        const Job& job = jobs[i];
+        std::vector<char>& buff = results[i];
+        try {
+            buff.resize(job.length);
+            Compression compress;
+            if (compress.open(Compression::Format::Binary, Compression::FlushMode::Finish, 0)) {
+                compress.decompress(job.data + 8, job.comp_len, buff);
+                compress.close();
+                valid[i] = 1;
+            }
+        } catch (const std::exception&) {
+            // leave it to the DOM, which reports the error if it needs the array
+            std::vector<char>().swap(buff);
+        }
+    });
+
+    inflated.reserve(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        if (valid[i]) {
+            inflated[jobs[i].data] = std::move(results[i]);
+        }
+    }
+    ASSIMP_LOG_DEBUG("Inflated ", inflated.size(), " FBX data arrays on ", pool.GetNumThreads(), " threads");
+}
+
+// ------------------------------------------------------------------------------------------------
+bool Parser::TakeInflatedArray(const char* data, std::vector<char>& out)
+{
+    std::unordered_map<const char*, std::vector<char>>::iterator it = inflated.find(data);
+    if (it == inflated.end()) {
+        return false;
+    }
+
+    // arrays are usually read once, so hand the memory over
+    out.swap(it->second);
+    inflated.erase(it);
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 TokenPtr Parser::AdvanceToNextToken()
 {
@@ -530,7 +635,12 @@ void ReadBinaryDataArrayHead(const char*& data, const char* end, char& type, uin
 // ------------------------------------------------------------------------------------------------
 // read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
 void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
-        std::vector<char>& buff, const Element& /*el*/) {
+        std::vector<char>& buff, const Element& el) {
+    if (el.GetParser().TakeInflatedArray(data, buff)) {
+        data = end;
+        return;
+    }
+
     BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data, end);
     AI_SWAP4(encmode);
     data += 4;
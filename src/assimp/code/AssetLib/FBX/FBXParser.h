@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <assimp/LogAux.h>
 #include <assimp/fast_atof.h>
@@ -57,6 +58,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXTokenizer.h"
 
 namespace Assimp {
+
+class ThreadPool;
+
 namespace FBX {
 
 class Scope;
@@ -93,6 +97,10 @@ public:
         return compound;
     }
 
+    Parser& GetParser() const {
+        return parser;
+    }
+
     const Token& KeyToken() const {
         return key_token;
     }
@@ -103,6 +111,7 @@ public:
 
 private:
     const Token& key_token;
+    Parser& parser;
     TokenList tokens;
     Scope* compound;
 };
@@ -174,6 +183,16 @@ public:
         return allocator;
     }
 
+    /** Inflate all zlib compressed binary data arrays up front, spread over
+     *  the threads of pool. The parse-tree is read on one thread, so without
+     *  this the arrays are inflated one at a time as the DOM reads them. */
+    void InflateArrays(ThreadPool& pool);
+
+    /** Move the inflated contents of a binary data array into out.
+     *  @param data Points to the array's compression mode field
+     *  @return false if the array was not inflated by InflateArrays() */
+    bool TakeInflatedArray(const char* data, std::vector<char>& out);
+
 private:
     friend class Scope;
     friend class Element;
@@ -190,6 +209,9 @@ private:
     Scope *root;
 
     const bool is_binary;
+
+    // arrays inflated by InflateArrays(), keyed by their compression mode field
+    std::unordered_map<const char*, std::vector<char>> inflated;
 };
 
 
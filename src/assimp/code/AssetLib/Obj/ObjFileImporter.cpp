@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
 #include <assimp/ObjMaterial.h>
+#include <assimp/Profiler.h>
 #include <memory>
 
 static constexpr aiImporterDesc desc = {
@@ -124,12 +125,6 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
         throw DeadlyImportError("OBJ-file is too small.");
     }
 
-    IOStreamBuffer<char> streamedBuffer;
-    streamedBuffer.open(fileStream.get());
-
-    // Allocate buffer and read file into it
-    //TextFileToBuffer( fileStream.get(),m_Buffer);
-
     // Get the model name
     std::string modelName, folderName;
     std::string::size_type pos = file.find_last_of("\\/");
@@ -144,15 +139,38 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
     }
 
     // parse the file into a temporary representation
-    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+    if (nullptr != m_threadPool) {
+        // The chunked parser needs the whole file in memory
+        Profiling::ProfileScope read(m_profiler, "read");
+        m_Buffer.resize(fileSize);
+        if (fileStream->Read(m_Buffer.data(), 1, fileSize) != fileSize) {
+            throw DeadlyImportError("OBJ: Failed to read ", file, ".");
+        }
+        read.End();
 
-    // And create the proper return structures out of it
-    CreateDataFromImport(parser.GetModel(), pScene);
+        Profiling::ProfileScope parse(m_profiler, "parse");
+        ObjFileParser parser(m_Buffer, modelName, pIOHandler, m_progress, file, *m_threadPool);
+        parse.End();
 
-    streamedBuffer.close();
+        // And create the proper return structures out of it
+        Profiling::ProfileScope convert(m_profiler, "convert");
+        CreateDataFromImport(parser.GetModel(), pScene);
+    } else {
+        // The streamed parser reads while it parses
+        Profiling::ProfileScope parse(m_profiler, "parse");
+        IOStreamBuffer<char> streamedBuffer;
+        streamedBuffer.open(fileStream.get());
+        ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+        parse.End();
+
+        // And create the proper return structures out of it
+        Profiling::ProfileScope convert(m_profiler, "convert");
+        CreateDataFromImport(parser.GetModel(), pScene);
+        streamedBuffer.close();
+    }
 
     // Clean up allocated storage for the next import
-    m_Buffer.clear();
+    std::vector<char>().swap(m_Buffer);
 
     // Pop directory stack
     if (pIOHandler->StackSize() > 0) {
@@ -328,6 +346,7 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
         pMesh->mName.Set(pObjMesh->m_name);
     }
 
+    size_t numIndices = 0;
     for (size_t index = 0; index < pObjMesh->m_Faces.size(); index++) {
         const ObjFile::Face *inp = pObjMesh->m_Faces[index];
         if (inp == nullptr) {
@@ -336,12 +355,15 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
 
         if (inp->mPrimitiveType == aiPrimitiveType_LINE) {
             pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size() - 1);
+            numIndices += 2 * (inp->m_vertices.size() - 1);
             pMesh->mPrimitiveTypes |= aiPrimitiveType_LINE;
         } else if (inp->mPrimitiveType == aiPrimitiveType_POINT) {
             pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size());
+            numIndices += inp->m_vertices.size();
             pMesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
         } else {
             ++pMesh->mNumFaces;
+            numIndices += inp->m_vertices.size();
             if (inp->m_vertices.size() > 3) {
                 pMesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
             } else {
@@ -359,6 +381,9 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
 
         unsigned int outIndex = 0u;
 
+        // all index arrays live in one block, createVertexArray() fills them
+        unsigned int *indices = pMesh->AllocateFaceIndices(numIndices);
+
         // Copy all data from all stored meshes
         for (auto &face : pObjMesh->m_Faces) {
             const ObjFile::Face *inp = face;
@@ -366,14 +391,16 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
                 for (size_t i = 0; i < inp->m_vertices.size() - 1; ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
                     uiIdxCount += f.mNumIndices = 2;
-                    f.mIndices = new unsigned int[2];
+                    f.mIndices = indices;
+                    indices += 2;
                 }
                 continue;
             } else if (inp->mPrimitiveType == aiPrimitiveType_POINT) {
                 for (size_t i = 0; i < inp->m_vertices.size(); ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
                     uiIdxCount += f.mNumIndices = 1;
-                    f.mIndices = new unsigned int[1];
+                    f.mIndices = indices;
+                    indices += 1;
                 }
                 continue;
             }
@@ -382,7 +409,8 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
             const unsigned int uiNumIndices = (unsigned int)face->m_vertices.size();
             uiIdxCount += pFace->mNumIndices = (unsigned int)uiNumIndices;
             if (pFace->mNumIndices > 0) {
-                pFace->mIndices = new unsigned int[uiNumIndices];
+                pFace->mIndices = indices;
+                indices += uiNumIndices;
             }
         }
     }
@@ -49,7 +49,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/ParsingUtils.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include "Common/ThreadPool.h"
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -57,6 +60,86 @@ namespace Assimp {
 
 constexpr const char ObjFileParser::DEFAULT_MATERIAL[];
 
+// Chunks smaller than this aren't worth a thread
+static constexpr size_t ObjMinChunkSize = 64 * 1024;
+// More chunks than threads, so chunks with many statements to parse don't hold up the others
+static constexpr size_t ObjChunksPerThread = 4;
+
+// ------------------------------------------------------------------------------------------------
+/// Per-chunk parse result. Vertex data is kept in chunk-local arrays. Every face and every other
+/// statement becomes a record, in file order, so they can be stitched back together serially.
+struct ObjFileParser::ParseChunk {
+    struct Record {
+        /// The parsed face, nullptr for a statement which is replayed from its line
+        ObjFile::Face *face;
+        /// Offset of the line in the file data
+        size_t line;
+        /// Chunk-local vertex counts when the line was read
+        size_t numVertices, numTexCoords, numNormals;
+        bool hasNormal, hasRelative;
+    };
+
+    size_t begin = 0, end = 0;
+    std::unique_ptr<ObjFile::Model> data;
+    std::vector<Record> records;
+    /// Vertex data already appended to the model by the stitch pass
+    size_t usedVertices = 0, usedTexCoords = 0, usedNormals = 0;
+
+    ~ParseChunk() {
+        for (Record &record : records) {
+            delete record.face;
+        }
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Reads the line at pos into buffer the same way IOStreamBuffer::getNextDataLine() does, joining
+// lines continued by a backslash. Returns the offset of the next line.
+static size_t readDataLine(const std::vector<char> &data, size_t pos, std::vector<char> &buffer) {
+    const size_t size = data.size();
+    buffer.clear();
+    while (pos < size) {
+        if (data[pos] == '\\' && pos + 1 < size && IsLineEnd(data[pos + 1])) {
+            while (pos < size && data[pos] != '\n') {
+                ++pos;
+            }
+            ++pos;
+            continue;
+        }
+        if (IsLineEnd(data[pos])) {
+            ++pos;
+            break;
+        }
+        buffer.push_back(data[pos]);
+        ++pos;
+    }
+    buffer.push_back('\n');
+    buffer.push_back('\0');
+    return pos;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Returns the offset of the first line starting at or after pos, skipping over continued lines.
+static size_t findLineStart(const std::vector<char> &data, size_t pos) {
+    const size_t size = data.size();
+    while (pos < size) {
+        const char *newLine = static_cast<const char *>(::memchr(&data[pos], '\n', size - pos));
+        if (newLine == nullptr) {
+            return size;
+        }
+        size_t lineEnd = newLine - &data[0];
+        size_t last = lineEnd;
+        if (last > 0 && data[last - 1] == '\r') {
+            --last;
+        }
+        if (last == 0 || data[last - 1] != '\\') {
+            return lineEnd + 1;
+        }
+        pos = lineEnd + 1;
+    }
+    return size;
+}
+
 ObjFileParser::ObjFileParser() :
         m_DataIt(),
         m_DataItEnd(),
@@ -97,6 +180,33 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
     parseFile(streamBuffer);
 }
 
+ObjFileParser::ObjFileParser(std::vector<char> &data, const std::string &modelName,
+        IOSystem *io, ProgressHandler *progress,
+        const std::string &originalObjFileName, ThreadPool &threadPool) :
+        m_DataIt(),
+        m_DataItEnd(),
+        m_pModel(nullptr),
+        m_uiLine(0),
+        m_buffer(),
+        m_pIO(io),
+        m_progress(progress),
+        m_originalObjFileName(originalObjFileName) {
+    std::fill_n(m_buffer, Buffersize, '\0');
+
+    // Create the model instance to store all the data
+    m_pModel.reset(new ObjFile::Model());
+    m_pModel->mModelName = modelName;
+
+    // create default material and store it
+    m_pModel->mDefaultMaterial = new ObjFile::Material;
+    m_pModel->mDefaultMaterial->MaterialName.Set(DEFAULT_MATERIAL);
+    m_pModel->mMaterialLib.emplace_back(DEFAULT_MATERIAL);
+    m_pModel->mMaterialMap[DEFAULT_MATERIAL] = m_pModel->mDefaultMaterial;
+
+    // Start parsing the file
+    parseFileParallel(data, threadPool);
+}
+
 void ObjFileParser::setBuffer(std::vector<char> &buffer) {
     m_DataIt = buffer.begin();
     m_DataItEnd = buffer.end();
@@ -129,130 +239,284 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
             m_progress->UpdateFileRead(processed, progressTotal);
         }
 
-        // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
-        if (insideCstype) {
-            switch (*m_DataIt) {
-            case 'e': {
-                std::string name;
-                getNameNoSpace(m_DataIt, m_DataItEnd, name);
-                insideCstype = name != "end";
-            } break;
-            }
-            goto pf_skip_line;
-        }
+        parseLine(insideCstype);
+    }
+}
 
-        // parse line
+void ObjFileParser::parseLine(bool &insideCstype) {
+    // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
+    if (insideCstype) {
         switch (*m_DataIt) {
-        case 'v': // Parse a vertex texture coordinate
-        {
-            ++m_DataIt;
-            if (*m_DataIt == ' ' || *m_DataIt == '\t') {
-                size_t numComponents = getNumComponentsInDataDefinition();
-                if (numComponents == 3) {
-                    // read in vertex definition
-                    getVector3(m_pModel->mVertices);
-                } else if (numComponents == 4) {
-                    // read in vertex definition (homogeneous coords)
-                    getHomogeneousVector3(m_pModel->mVertices);
-                } else if (numComponents == 6) {
-                    // fill previous omitted vertex-colors by default
-                    if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
-                        m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
-                    }
-                    // read vertex and vertex-color
-                    getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
-                }
-                // append omitted vertex-colors as default for the end if any vertex-color exists
-                if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+        case 'e': {
+            std::string name;
+            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+            insideCstype = name != "end";
+        } break;
+        }
+        goto pf_skip_line;
+    }
+
+    // parse line
+    switch (*m_DataIt) {
+    case 'v': // Parse a vertex texture coordinate
+    {
+        ++m_DataIt;
+        if (*m_DataIt == ' ' || *m_DataIt == '\t') {
+            size_t numComponents = getNumComponentsInDataDefinition();
+            if (numComponents == 3) {
+                // read in vertex definition
+                getVector3(m_pModel->mVertices);
+            } else if (numComponents == 4) {
+                // read in vertex definition (homogeneous coords)
+                getHomogeneousVector3(m_pModel->mVertices);
+            } else if (numComponents == 6) {
+                // fill previous omitted vertex-colors by default
+                if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
                     m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
                 }
-            } else if (*m_DataIt == 't') {
-                // read in texture coordinate ( 2D or 3D )
-                ++m_DataIt;
-                size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
-                m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
-            } else if (*m_DataIt == 'n') {
-                // Read in normal vector definition
-                ++m_DataIt;
-                getVector3(m_pModel->mNormals);
+                // read vertex and vertex-color
+                getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
             }
-        } break;
+            // append omitted vertex-colors as default for the end if any vertex-color exists
+            if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+                m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+            }
+        } else if (*m_DataIt == 't') {
+            // read in texture coordinate ( 2D or 3D )
+            ++m_DataIt;
+            size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
+            m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
+        } else if (*m_DataIt == 'n') {
+            // Read in normal vector definition
+            ++m_DataIt;
+            getVector3(m_pModel->mNormals);
+        }
+    } break;
 
-        case 'p': // Parse a face, line or point statement
-        case 'l':
-        case 'f': {
-            getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
-        } break;
+    case 'p': // Parse a face, line or point statement
+    case 'l':
+    case 'f': {
+        getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
+    } break;
 
-        case '#': // Parse a comment
-        {
-            getComment();
-        } break;
+    case '#': // Parse a comment
+    {
+        getComment();
+    } break;
 
-        case 'u': // Parse a material desc. setter
-        {
-            std::string name;
+    case 'u': // Parse a material desc. setter
+    {
+        std::string name;
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
 
-            if (name == "usemtl") {
-                getMaterialDesc();
-            }
-        } break;
+        if (name == "usemtl") {
+            getMaterialDesc();
+        }
+    } break;
 
-        case 'm': // Parse a material library or merging group ('mg')
-        {
-            std::string name;
+    case 'm': // Parse a material library or merging group ('mg')
+    {
+        std::string name;
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
 
-            if (name == "mg")
-                getGroupNumberAndResolution();
-            else if (name == "mtllib")
-                getMaterialLib();
-            else
-                goto pf_skip_line;
-        } break;
+        if (name == "mg")
+            getGroupNumberAndResolution();
+        else if (name == "mtllib")
+            getMaterialLib();
+        else
+            goto pf_skip_line;
+    } break;
+
+    case 'g': // Parse group name
+    {
+        getGroupName();
+    } break;
+
+    case 's': // Parse group number
+    {
+        getGroupNumber();
+    } break;
+
+    case 'o': // Parse object name
+    {
+        getObjectName();
+    } break;
+
+    case 'c': // handle cstype section start
+    {
+        std::string name;
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        insideCstype = name == "cstype";
+        goto pf_skip_line;
+    }
 
-        case 'g': // Parse group name
-        {
-            getGroupName();
-        } break;
+    default: {
+    pf_skip_line:
+        m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    } break;
+    }
+}
 
-        case 's': // Parse group number
-        {
-            getGroupNumber();
-        } break;
+void ObjFileParser::parseFileParallel(std::vector<char> &data, ThreadPool &threadPool) {
+    const size_t fileSize = data.size();
+    std::vector<char> buffer;
 
-        case 'o': // Parse object name
-        {
-            getObjectName();
-        } break;
+    // Statements inside free-form sections would be taken for vertices and faces by the chunk
+    // parser, so such files are read serially.
+    static constexpr char CsType[] = "cstype";
+    const bool hasFreeForm = std::search(data.begin(), data.end(), CsType, CsType + sizeof(CsType) - 1) != data.end();
+
+    size_t numChunks = std::min<size_t>(threadPool.GetNumThreads() * ObjChunksPerThread, fileSize / ObjMinChunkSize);
+    if (hasFreeForm || numChunks < 2) {
+        bool insideCstype = false;
+        for (size_t pos = 0; pos < fileSize;) {
+            pos = readDataLine(data, pos, buffer);
+            m_DataIt = buffer.begin();
+            m_DataItEnd = buffer.end();
+            mEnd = &buffer[buffer.size() - 1] + 1;
+            parseLine(insideCstype);
+        }
+        if (m_progress) {
+            m_progress->UpdateFileRead(static_cast<unsigned int>(fileSize), static_cast<unsigned int>(fileSize));
+        }
+        return;
+    }
 
-        case 'c': // handle cstype section start
-        {
-            std::string name;
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
-            insideCstype = name == "cstype";
-            goto pf_skip_line;
+    // Split at line starts
+    std::vector<ParseChunk> chunks(numChunks);
+    size_t pos = 0;
+    for (size_t i = 0; i < numChunks; ++i) {
+        chunks[i].begin = pos;
+        pos = i + 1 == numChunks ? fileSize : std::max(pos, findLineStart(data, fileSize / numChunks * (i + 1)));
+        chunks[i].end = pos;
+    }
+
+    threadPool.ParallelFor(numChunks, [&](size_t i) {
+        ObjFileParser chunkParser;
+        chunkParser.m_pModel.reset(new ObjFile::Model());
+        chunkParser.parseChunk(data, chunks[i]);
+        chunks[i].data = std::move(chunkParser.m_pModel);
+    });
+
+    // Reserve the vertex arrays from the chunk totals, so the stitch pass only copies
+    size_t numVertices = 0, numTexCoords = 0, numNormals = 0;
+    bool hasColors = false;
+    for (const ParseChunk &chunk : chunks) {
+        numVertices += chunk.data->mVertices.size();
+        numTexCoords += chunk.data->mTextureCoord.size();
+        numNormals += chunk.data->mNormals.size();
+        hasColors = hasColors || !chunk.data->mVertexColors.empty();
+        m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, chunk.data->mTextureCoordDim);
+    }
+    m_pModel->mVertices.reserve(numVertices);
+    m_pModel->mTextureCoord.reserve(numTexCoords);
+    m_pModel->mNormals.reserve(numNormals);
+
+    // Stitch the chunks together in file order. Statements and faces which depend on what came
+    // before them (relative indices, missing texture coordinates) are parsed again here against
+    // the vertex counts of the whole file up to that line.
+    bool insideCstype = false;
+    for (ParseChunk &chunk : chunks) {
+        for (ParseChunk::Record &record : chunk.records) {
+            appendChunkData(chunk, record.numVertices, record.numTexCoords, record.numNormals);
+
+            ObjFile::Face *face = record.face;
+            record.face = nullptr;
+            const bool texCoordsMissing = face != nullptr && !face->m_texturCoords.empty() &&
+                                          m_pModel->mTextureCoord.empty() && !m_pModel->mNormals.empty();
+            if (face != nullptr && !record.hasRelative && !texCoordsMissing) {
+                storeFace(face, record.hasNormal);
+                continue;
+            }
+            delete face;
+
+            readDataLine(data, record.line, buffer);
+            m_DataIt = buffer.begin();
+            m_DataItEnd = buffer.end();
+            mEnd = &buffer[buffer.size() - 1] + 1;
+            parseLine(insideCstype);
         }
+        appendChunkData(chunk, chunk.data->mVertices.size(), chunk.data->mTextureCoord.size(), chunk.data->mNormals.size());
+    }
 
-        default: {
-        pf_skip_line:
-            m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    // A chunk has either no colors or one per vertex; the serial parser pads missing ones with black
+    if (hasColors) {
+        m_pModel->mVertexColors.reserve(numVertices);
+        for (const ParseChunk &chunk : chunks) {
+            const std::vector<aiVector3D> &colors = chunk.data->mVertexColors;
+            if (colors.empty()) {
+                m_pModel->mVertexColors.resize(m_pModel->mVertexColors.size() + chunk.data->mVertices.size(), aiVector3D(0, 0, 0));
+            } else {
+                m_pModel->mVertexColors.insert(m_pModel->mVertexColors.end(), colors.begin(), colors.end());
+            }
+        }
+    }
+
+    if (m_progress) {
+        m_progress->UpdateFileRead(static_cast<unsigned int>(fileSize), static_cast<unsigned int>(fileSize));
+    }
+}
+
+void ObjFileParser::parseChunk(std::vector<char> &data, ParseChunk &chunk) {
+    std::vector<char> buffer;
+    bool insideCstype = false;
+    for (size_t pos = chunk.begin; pos < chunk.end;) {
+        const size_t line = pos;
+        pos = readDataLine(data, pos, buffer);
+        m_DataIt = buffer.begin();
+        m_DataItEnd = buffer.end();
+        mEnd = &buffer[buffer.size() - 1] + 1;
+
+        ParseChunk::Record record = { nullptr, line, m_pModel->mVertices.size(), m_pModel->mTextureCoord.size(),
+            m_pModel->mNormals.size(), false, false };
+        switch (*m_DataIt) {
+        case 'v': // Vertex data only goes to the chunk-local arrays
+            parseLine(insideCstype);
+            break;
+
+        case 'p':
+        case 'l':
+        case 'f': {
+            const aiPrimitiveType type = *m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT);
+            record.face = readFace(type, false, record.hasNormal, record.hasRelative);
+            if (record.face != nullptr) {
+                chunk.records.push_back(record);
+            }
         } break;
+
+        case '#':
+        case '\n':
+        case '\r':
+        case '\0':
+            break;
+
+        default:
+            chunk.records.push_back(record);
+            break;
         }
     }
 }
 
+void ObjFileParser::appendChunkData(ParseChunk &chunk, size_t numVertices, size_t numTexCoords, size_t numNormals) {
+    const ObjFile::Model &data = *chunk.data;
+    m_pModel->mVertices.insert(m_pModel->mVertices.end(), data.mVertices.begin() + chunk.usedVertices, data.mVertices.begin() + numVertices);
+    m_pModel->mTextureCoord.insert(m_pModel->mTextureCoord.end(), data.mTextureCoord.begin() + chunk.usedTexCoords, data.mTextureCoord.begin() + numTexCoords);
+    m_pModel->mNormals.insert(m_pModel->mNormals.end(), data.mNormals.begin() + chunk.usedNormals, data.mNormals.begin() + numNormals);
+    chunk.usedVertices = numVertices;
+    chunk.usedTexCoords = numTexCoords;
+    chunk.usedNormals = numNormals;
+}
+
 void ObjFileParser::copyNextWord(char *pBuffer, size_t length) {
     size_t index = 0;
     m_DataIt = getNextWord<DataArrayIt>(m_DataIt, m_DataItEnd);
@@ -316,116 +580,79 @@ size_t ObjFileParser::getNumComponentsInDataDefinition() {
     return numComponents;
 }
 
-size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
-    size_t numComponents = getNumComponentsInDataDefinition();
-    ai_real x, y, z;
-    if (2 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
-
-        copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
-        z = 0.0;
-    } else if (3 == numComponents) {
-        copyNextWord(m_buffer, Buffersize);
-        x = (ai_real)fast_atof(m_buffer);
+void ObjFileParser::getValues(ai_real *values, size_t count) {
+    // Plain numbers are converted as one batch. Anything else (line continuations, nan and
+    // inf, decimal commas, missing values) goes word by word, which also reports the errors.
+    if (m_DataIt != m_DataItEnd) {
+        const char *begin = &(*m_DataIt);
+        const char *in = begin;
+        if (fast_atoreal_n<ai_real>(in, begin + (m_DataItEnd - m_DataIt), values, count, false) == count) {
+            m_DataIt += in - begin;
+            return;
+        }
+    }
 
+    for (size_t i = 0; i < count; ++i) {
         copyNextWord(m_buffer, Buffersize);
-        y = (ai_real)fast_atof(m_buffer);
+        values[i] = (ai_real)fast_atof(m_buffer);
+    }
+}
 
-        copyNextWord(m_buffer, Buffersize);
-        z = (ai_real)fast_atof(m_buffer);
+size_t ObjFileParser::getTexCoordVector(std::vector<aiVector3D> &point3d_array) {
+    size_t numComponents = getNumComponentsInDataDefinition();
+    ai_real xyz[3] = { 0, 0, 0 };
+    if (2 == numComponents || 3 == numComponents) {
+        getValues(xyz, numComponents);
     } else {
         throw DeadlyImportError("OBJ: Invalid number of components");
     }
 
     // Coerce nan and inf to 0 as is the OBJ default value
-    if (!std::isfinite(x))
-        x = 0;
-
-    if (!std::isfinite(y))
-        y = 0;
-
-    if (!std::isfinite(z))
-        z = 0;
+    for (ai_real &v : xyz) {
+        if (!std::isfinite(v))
+            v = 0;
+    }
 
-    point3d_array.emplace_back(x, y, z);
+    point3d_array.emplace_back(xyz[0], xyz[1], xyz[2]);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
     return numComponents;
 }
 
 void ObjFileParser::getVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
+    ai_real xyz[3];
+    getValues(xyz, 3);
 
-    point3d_array.emplace_back(x, y, z);
+    point3d_array.emplace_back(xyz[0], xyz[1], xyz[2]);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getHomogeneousVector3(std::vector<aiVector3D> &point3d_array) {
-    ai_real x, y, z, w;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    w = (ai_real)fast_atof(m_buffer);
+    ai_real xyzw[4];
+    getValues(xyzw, 4);
 
+    const ai_real w = xyzw[3];
     if (w == 0)
         throw DeadlyImportError("OBJ: Invalid component in homogeneous vector (Division by zero)");
 
-    point3d_array.emplace_back(x / w, y / w, z / w);
+    point3d_array.emplace_back(xyzw[0] / w, xyzw[1] / w, xyzw[2] / w);
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getTwoVectors3(std::vector<aiVector3D> &point3d_array_a, std::vector<aiVector3D> &point3d_array_b) {
-    ai_real x, y, z;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
+    ai_real values[6];
+    getValues(values, 6);
 
-    point3d_array_a.emplace_back(x, y, z);
-
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    z = (ai_real)fast_atof(m_buffer);
-
-    point3d_array_b.emplace_back(x, y, z);
+    point3d_array_a.emplace_back(values[0], values[1], values[2]);
+    point3d_array_b.emplace_back(values[3], values[4], values[5]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
-    ai_real x, y;
-    copyNextWord(m_buffer, Buffersize);
-    x = (ai_real)fast_atof(m_buffer);
-
-    copyNextWord(m_buffer, Buffersize);
-    y = (ai_real)fast_atof(m_buffer);
+    ai_real xy[2];
+    getValues(xy, 2);
 
-    point2d_array.emplace_back(x, y);
+    point2d_array.emplace_back(xy[0], xy[1]);
 
     m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
@@ -433,13 +660,20 @@ void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
 static constexpr char DefaultObjName[] = "defaultobject";
 
 void ObjFileParser::getFace(aiPrimitiveType type) {
+    bool hasNormal = false, hasRelative = false;
+    ObjFile::Face *face = readFace(type, true, hasNormal, hasRelative);
+    if (face != nullptr) {
+        storeFace(face, hasNormal);
+    }
+}
+
+ObjFile::Face *ObjFileParser::readFace(aiPrimitiveType type, bool skipMissingTexCoords, bool &hasNormal, bool &hasRelative) {
     m_DataIt = getNextToken<DataArrayIt>(m_DataIt, m_DataItEnd);
     if (m_DataIt == m_DataItEnd || *m_DataIt == '\0') {
-        return;
+        return nullptr;
     }
 
     ObjFile::Face *face = new ObjFile::Face(type);
-    bool hasNormal = false;
 
     const int vSize = static_cast<unsigned int>(m_pModel->mVertices.size());
     const int vtSize = static_cast<unsigned int>(m_pModel->mTextureCoord.size());
@@ -464,30 +698,22 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
             iPos = 0;
         } else {
             //OBJ USES 1 Base ARRAYS!!!!
-            int iVal;
-            auto end = m_DataIt;
-            // find either the buffer end or the '\0'
-            while (end < m_DataItEnd && *end != '\0')
-                ++end;
-            // avoid temporary string allocation if there is a zero
-            if (end != m_DataItEnd) {
-                iVal = ::atoi(&(*m_DataIt));
-            } else {
-                // otherwise make a zero terminated copy, which is safe to pass to atoi
-                std::string number(&(*m_DataIt), m_DataItEnd - m_DataIt);
-                iVal = ::atoi(number.c_str());
+            const char *token = &(*m_DataIt);
+            const char *end = token + (m_DataItEnd - m_DataIt);
+            const bool negative = (*token == '-');
+            const unsigned int sign = (negative || *token == '+') ? 1 : 0;
+
+            // the whole digit run is consumed; an index that is not a number or does not
+            // fit into an int stays 0
+            int iVal = 0;
+            uint64_t value = 0;
+            const unsigned int digits = strtoul10_run(token + sign, end, value);
+            if (digits > 0 && value <= static_cast<uint64_t>(INT_MAX)) {
+                iVal = negative ? -static_cast<int>(value) : static_cast<int>(value);
+                iStep = static_cast<int>(sign + digits);
             }
 
-            // increment iStep position based off of the sign and # of digits
-            int tmp = iVal;
-            if (iVal < 0) {
-                ++iStep;
-            }
-            while ((tmp = tmp / 10) != 0) {
-                ++iStep;
-            }
-
-            if (iPos == 1 && !vt && vn) {
+            if (skipMissingTexCoords && iPos == 1 && !vt && vn) {
                 iPos = 2; // skip texture coords for normals if there are no tex coords
             }
 
@@ -505,6 +731,7 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
                 }
             } else if (iVal < 0) {
                 // Store relatively index
+                hasRelative = true;
                 if (0 == iPos) {
                     face->m_vertices.push_back(vSize + iVal);
                 } else if (1 == iPos) {
@@ -529,9 +756,15 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
         // skip line and clean up
         m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
         delete face;
-        return;
+        return nullptr;
     }
 
+    // Skip the rest of the line
+    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    return face;
+}
+
+void ObjFileParser::storeFace(ObjFile::Face *face, bool hasNormal) {
     // Set active material, if one set
     if (nullptr != m_pModel->mCurrentMaterial) {
         face->m_pMaterial = m_pModel->mCurrentMaterial;
@@ -556,8 +789,6 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
     if (!m_pModel->mCurrentMesh->m_hasNormals && hasNormal) {
         m_pModel->mCurrentMesh->m_hasNormals = true;
     }
-    // Skip the rest of the line
-    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getMaterialDesc() {
@@ -59,6 +59,7 @@ namespace Assimp {
 class ObjFileImporter;
 class IOSystem;
 class ProgressHandler;
+class ThreadPool;
 
 // ------------------------------------------------------------------------------------------------
 /// \class  ObjFileParser
@@ -75,6 +76,8 @@ public:
     ObjFileParser();
     /// @brief  Constructor with data array.
     ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName);
+    /// @brief  Constructor with the whole file in memory, which is parsed in chunks on the thread pool.
+    ObjFileParser(std::vector<char> &data, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName, ThreadPool &threadPool);
     /// @brief  Destructor
     ~ObjFileParser() = default;
     /// @brief  If you want to load in-core data.
@@ -88,8 +91,14 @@ public:
 protected:
     /// Parse the loaded file
     void parseFile(IOStreamBuffer<char> &streamBuffer);
+    /// Parse the file data in chunks and stitch the results together in file order
+    void parseFileParallel(std::vector<char> &data, ThreadPool &threadPool);
+    /// Parse the statement in the current line
+    void parseLine(bool &insideCstype);
     /// Method to copy the new delimited word in the current line.
     void copyNextWord(char *pBuffer, size_t length);
+    /// Reads the next count numbers of the current line.
+    void getValues(ai_real *values, size_t count);
     /// Get the number of components in a line.
     size_t getNumComponentsInDataDefinition();
     /// Stores the vector
@@ -104,6 +113,10 @@ protected:
     void getVector2(std::vector<aiVector2D> &point2d_array);
     /// Stores the following face.
     void getFace(aiPrimitiveType type);
+    /// Reads the indices of the following face, returns nullptr for an empty face.
+    ObjFile::Face *readFace(aiPrimitiveType type, bool skipMissingTexCoords, bool &hasNormal, bool &hasRelative);
+    /// Adds a face to the current mesh, creating the object and mesh if needed.
+    void storeFace(ObjFile::Face *face, bool hasNormal);
     /// Reads the material description.
     void getMaterialDesc();
     /// Gets a comment.
@@ -132,6 +145,12 @@ protected:
     void reportErrorTokenInFace();
 
 private:
+    struct ParseChunk;
+    /// Reads the vertex data and faces of one chunk, keeps other statements for the stitch pass.
+    void parseChunk(std::vector<char> &data, ParseChunk &chunk);
+    /// Appends the chunk's vertex data up to the given counts to the model.
+    void appendChunkData(ParseChunk &chunk, size_t numVertices, size_t numTexCoords, size_t numNormals);
+
     /// Default material name
     static constexpr const char DEFAULT_MATERIAL[] = AI_DEFAULT_MATERIAL_NAME;
     //! Iterator to current position in buffer
@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // internal headers
 #include "PlyLoader.h"
+#include <assimp/ByteSwapper.h>
 #include <assimp/IOStreamBuffer.h>
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
@@ -102,6 +103,52 @@ namespace {
         return isBigEndian;
     }
 
+    // ------------------------------------------------------------------------------------------------
+    inline bool IsIntegerType(PLY::EDataType eType) {
+        return EDT_Float != eType && EDT_Double != eType && EDT_INVALID != eType;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    template <class T>
+    inline void SwapValue(T *value) {
+        ByteSwap::Swap(value);
+    }
+
+    inline void SwapValue(uint8_t *) {}
+    inline void SwapValue(int8_t *) {}
+
+    // ------------------------------------------------------------------------------------------------
+    // Copies a float property of count binary vertices into every dstStride-th value of dst
+    void CopyFloatColumn(const char *src, size_t srcStride, unsigned int count, ai_real *dst, size_t dstStride, bool swap) {
+        float f;
+        if (swap) {
+            for (unsigned int i = 0; i < count; ++i, src += srcStride, dst += dstStride) {
+                ::memcpy(&f, src, sizeof(float));
+                ByteSwap::Swap(&f);
+                *dst = f;
+            }
+        } else {
+            for (unsigned int i = 0; i < count; ++i, src += srcStride, dst += dstStride) {
+                ::memcpy(&f, src, sizeof(float));
+                *dst = f;
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Reads count binary vertex indices of type T
+    template <class T>
+    void ReadIndices(const char *src, unsigned int count, unsigned int *out, bool swap) {
+        T t;
+        for (unsigned int i = 0; i < count; ++i, src += sizeof(T)) {
+            ::memcpy(&t, src, sizeof(T));
+            if (swap) {
+                SwapValue(&t);
+            }
+            out[i] = static_cast<unsigned int>(t);
+        }
+    }
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -476,6 +523,269 @@ void PLYImporter::LoadVertex(const PLY::Element *pcElement, const PLY::ElementIn
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+bool PLYImporter::CanLoadBinaryBlocks(const PLY::Element *pcElement) {
+    ai_assert(nullptr != pcElement);
+
+    if (pcElement->alProperties.empty()) {
+        return false;
+    }
+
+    if (PLY::EEST_Vertex == pcElement->eSemantic) {
+        for (const PLY::Property &prop : pcElement->alProperties) {
+            if (prop.bIsList || 0 == PLY::PropertyInstance::GetBinarySize(prop.eType)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (PLY::EEST_Face == pcElement->eSemantic) {
+        unsigned int numLists = 0;
+        bool haveIndices = false;
+        for (const PLY::Property &prop : pcElement->alProperties) {
+            if (0 == PLY::PropertyInstance::GetBinarySize(prop.eType)) {
+                return false;
+            }
+            if (prop.bIsList) {
+                ++numLists;
+                haveIndices = PLY::EST_VertexIndex == prop.Semantic &&
+                              IsIntegerType(prop.eFirstType) && IsIntegerType(prop.eType);
+            }
+        }
+        return 1 == numLists && haveIndices;
+    }
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+const char *PLYImporter::LoadBinaryBlock(const PLY::Element *pcElement, const char *data, const char *end,
+        unsigned int &pos, bool isBigEndian) {
+    ai_assert(nullptr != pcElement);
+
+    if (PLY::EEST_Vertex == pcElement->eSemantic) {
+        return LoadVertexBlock(pcElement, data, end, pos, isBigEndian);
+    }
+    return LoadFaceBlock(pcElement, data, end, pos, isBigEndian);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Decode binary vertices column by column. Same results as LoadVertex().
+const char *PLYImporter::LoadVertexBlock(const PLY::Element *pcElement, const char *data, const char *end,
+        unsigned int &pos, bool isBigEndian) {
+    enum ColumnTarget {
+        Unused,
+        Position,
+        Normal,
+        Color,
+        TextureCoord
+    };
+
+    struct Column {
+        unsigned int offset;
+        PLY::EDataType eType;
+        ColumnTarget target;
+        unsigned int component;
+    };
+
+    // locate the properties within a vertex
+    std::vector<Column> columns;
+    columns.reserve(pcElement->alProperties.size());
+    bool haveTarget[5] = { false, false, false, false, false };
+    bool haveAlpha = false;
+    unsigned int stride = 0;
+    for (const PLY::Property &prop : pcElement->alProperties) {
+        Column column = { stride, prop.eType, Unused, 0 };
+        switch (prop.Semantic) {
+        case PLY::EST_XCoord:
+        case PLY::EST_YCoord:
+        case PLY::EST_ZCoord:
+            column.target = Position;
+            column.component = prop.Semantic - PLY::EST_XCoord;
+            break;
+        case PLY::EST_XNormal:
+        case PLY::EST_YNormal:
+        case PLY::EST_ZNormal:
+            column.target = Normal;
+            column.component = prop.Semantic - PLY::EST_XNormal;
+            break;
+        case PLY::EST_Red:
+        case PLY::EST_Green:
+        case PLY::EST_Blue:
+        case PLY::EST_Alpha:
+            column.target = Color;
+            column.component = prop.Semantic - PLY::EST_Red;
+            haveAlpha = haveAlpha || PLY::EST_Alpha == prop.Semantic;
+            break;
+        case PLY::EST_UTextureCoord:
+        case PLY::EST_VTextureCoord:
+            column.target = TextureCoord;
+            column.component = prop.Semantic - PLY::EST_UTextureCoord;
+            break;
+        default:
+            break;
+        }
+        haveTarget[column.target] = true;
+        columns.push_back(column);
+        stride += PLY::PropertyInstance::GetBinarySize(prop.eType);
+    }
+
+    const unsigned int count = static_cast<unsigned int>(
+            std::min(static_cast<size_t>(pcElement->NumOccur - pos), static_cast<size_t>(end - data) / stride));
+    if (0 == count || !(haveTarget[Position] || haveTarget[Normal] || haveTarget[Color] || haveTarget[TextureCoord])) {
+        pos += count;
+        return data + static_cast<size_t>(count) * stride;
+    }
+
+    // create aiMesh if needed
+    if (nullptr == mGeneratedMesh) {
+        mGeneratedMesh = new aiMesh();
+        mGeneratedMesh->mMaterialIndex = 0;
+    }
+
+    if (nullptr == mGeneratedMesh->mVertices) {
+        mGeneratedMesh->mNumVertices = pcElement->NumOccur;
+        mGeneratedMesh->mVertices = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+    if (pos + count > mGeneratedMesh->mNumVertices) {
+        throw DeadlyImportError("Invalid .ply file: Too many vertices");
+    }
+
+    if (haveTarget[Normal] && nullptr == mGeneratedMesh->mNormals) {
+        mGeneratedMesh->mNormals = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+    if (haveTarget[Color]) {
+        if (nullptr == mGeneratedMesh->mColors[0]) {
+            mGeneratedMesh->mColors[0] = new aiColor4D[mGeneratedMesh->mNumVertices];
+        }
+        // assume 1.0 for the alpha channel if it is not set
+        if (!haveAlpha) {
+            for (unsigned int i = pos; i < pos + count; ++i) {
+                mGeneratedMesh->mColors[0][i].a = 1.0;
+            }
+        }
+    }
+    if (haveTarget[TextureCoord] && nullptr == mGeneratedMesh->mTextureCoords[0]) {
+        mGeneratedMesh->mNumUVComponents[0] = 2;
+        mGeneratedMesh->mTextureCoords[0] = new aiVector3D[mGeneratedMesh->mNumVertices];
+    }
+
+    // copy the columns into the mesh
+    for (const Column &column : columns) {
+        ai_real *dst = nullptr;
+        size_t dstStride = 3;
+        switch (column.target) {
+        case Position:
+            dst = &mGeneratedMesh->mVertices[pos][column.component];
+            break;
+        case Normal:
+            dst = &mGeneratedMesh->mNormals[pos][column.component];
+            break;
+        case Color:
+            dst = &mGeneratedMesh->mColors[0][pos][column.component];
+            dstStride = 4;
+            break;
+        case TextureCoord:
+            dst = &mGeneratedMesh->mTextureCoords[0][pos][column.component];
+            break;
+        default:
+            continue;
+        }
+
+        const char *src = data + column.offset;
+        if (EDT_Float == column.eType && Color != column.target) {
+            CopyFloatColumn(src, stride, count, dst, dstStride, isBigEndian);
+            continue;
+        }
+
+        PLY::PropertyInstance::ValueUnion v;
+        for (unsigned int i = 0; i < count; ++i, src += stride, dst += dstStride) {
+            PLY::PropertyInstance::DecodeValueBinary(src, column.eType, &v, isBigEndian);
+            *dst = Color == column.target ? NormalizeColorValue(v, column.eType) :
+                                            PLY::PropertyInstance::ConvertTo<ai_real>(v, column.eType);
+        }
+    }
+
+    pos += count;
+    return data + static_cast<size_t>(count) * stride;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Decode binary faces without building a DOM for them. Same results as LoadFace().
+const char *PLYImporter::LoadFaceBlock(const PLY::Element *pcElement, const char *data, const char *end,
+        unsigned int &pos, bool isBigEndian) {
+    if (mGeneratedMesh == nullptr) {
+        throw DeadlyImportError("Invalid .ply file: Vertices should be declared before faces");
+    }
+
+    if (mGeneratedMesh->mFaces == nullptr) {
+        mGeneratedMesh->mNumFaces = pcElement->NumOccur;
+        mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
+    } else if (mGeneratedMesh->mNumFaces < pcElement->NumOccur) {
+        throw DeadlyImportError("Invalid .ply file: Too many faces");
+    }
+
+    size_t available = static_cast<size_t>(end - data);
+    for (; pos < pcElement->NumOccur; ++pos) {
+        // find the index list and the size of the face
+        const PLY::Property *list = nullptr;
+        const char *indices = nullptr;
+        unsigned int numIndices = 0;
+        size_t size = 0;
+        for (const PLY::Property &prop : pcElement->alProperties) {
+            if (!prop.bIsList) {
+                size += PLY::PropertyInstance::GetBinarySize(prop.eType);
+                continue;
+            }
+
+            const unsigned int countSize = PLY::PropertyInstance::GetBinarySize(prop.eFirstType);
+            if (size + countSize > available) {
+                return data;
+            }
+            PLY::PropertyInstance::ValueUnion v;
+            PLY::PropertyInstance::DecodeValueBinary(data + size, prop.eFirstType, &v, isBigEndian);
+            numIndices = PLY::PropertyInstance::ConvertTo<unsigned int>(v, prop.eFirstType);
+            size += countSize;
+
+            list = &prop;
+            indices = data + size;
+            size += static_cast<size_t>(numIndices) * PLY::PropertyInstance::GetBinarySize(prop.eType);
+        }
+        if (size > available) {
+            return data;
+        }
+
+        aiFace &face = mGeneratedMesh->mFaces[pos];
+        face.mNumIndices = numIndices;
+        face.mIndices = mGeneratedMesh->AllocateFaceIndices(numIndices);
+        switch (list->eType) {
+        case EDT_UChar:
+            ReadIndices<uint8_t>(indices, numIndices, face.mIndices, isBigEndian);
+            break;
+        case EDT_Char:
+            ReadIndices<int8_t>(indices, numIndices, face.mIndices, isBigEndian);
+            break;
+        case EDT_UShort:
+            ReadIndices<uint16_t>(indices, numIndices, face.mIndices, isBigEndian);
+            break;
+        case EDT_Short:
+            ReadIndices<int16_t>(indices, numIndices, face.mIndices, isBigEndian);
+            break;
+        case EDT_UInt:
+            ReadIndices<uint32_t>(indices, numIndices, face.mIndices, isBigEndian);
+            break;
+        default:
+            ReadIndices<int32_t>(indices, numIndices, face.mIndices, isBigEndian);
+            break;
+        }
+
+        data += size;
+        available -= size;
+    }
+    return data;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Convert a color component to [0...1]
 ai_real PLYImporter::NormalizeColorValue(PLY::PropertyInstance::ValueUnion val, PLY::EDataType eType) {
@@ -584,7 +894,7 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
             if (NotSet != iProperty) {
                 const unsigned int iNum = (unsigned int)GetProperty(instElement->alProperties, iProperty).avList.size();
                 mGeneratedMesh->mFaces[pos].mNumIndices = iNum;
-                mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[iNum];
+                mGeneratedMesh->mFaces[pos].mIndices = mGeneratedMesh->AllocateFaceIndices(iNum);
 
                 std::vector<PLY::PropertyInstance::ValueUnion>::const_iterator p =
                         GetProperty(instElement->alProperties, iProperty).avList.begin();
@@ -654,7 +964,7 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
                 }
 
                 mGeneratedMesh->mFaces[pos].mNumIndices = 3;
-                mGeneratedMesh->mFaces[pos].mIndices = new unsigned int[3];
+                mGeneratedMesh->mFaces[pos].mIndices = mGeneratedMesh->AllocateFaceIndices(3);
                 mGeneratedMesh->mFaces[pos].mIndices[0] = aiTable[0];
                 mGeneratedMesh->mFaces[pos].mIndices[1] = aiTable[1];
                 mGeneratedMesh->mFaces[pos].mIndices[2] = p;
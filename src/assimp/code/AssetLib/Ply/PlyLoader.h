@@ -84,6 +84,21 @@ public:
     */
     void LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
 
+    // -------------------------------------------------------------------
+    /** Check whether the instances of a binary element can be extracted
+     *  with LoadBinaryBlock(): vertices without list properties and faces
+     *  whose only list holds the vertex indices.
+     */
+    static bool CanLoadBinaryBlocks(const PLY::Element *pcElement);
+
+    // -------------------------------------------------------------------
+    /** Extract the complete instances of a binary element in [data, end),
+     *  starting with instance pos. Advances pos and returns the end of the
+     *  last extracted instance.
+     */
+    const char *LoadBinaryBlock(const PLY::Element *pcElement, const char *data, const char *end,
+            unsigned int &pos, bool isBigEndian);
+
 protected:
     // -------------------------------------------------------------------
     /** Return importer meta information.
@@ -121,6 +136,11 @@ protected:
             PLY::EDataType eType);
 
 private:
+    const char *LoadVertexBlock(const PLY::Element *pcElement, const char *data, const char *end,
+            unsigned int &pos, bool isBigEndian);
+    const char *LoadFaceBlock(const PLY::Element *pcElement, const char *data, const char *end,
+            unsigned int &pos, bool isBigEndian);
+
     unsigned char *mBuffer;
     PLY::DOM *pcDOM;
     aiMesh *mGeneratedMesh;
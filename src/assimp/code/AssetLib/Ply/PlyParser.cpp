@@ -495,7 +495,7 @@ bool PLY::DOM::ParseElementInstanceLists(IOStreamBuffer<char> &streamBuffer, std
 // ------------------------------------------------------------------------------------------------
 bool PLY::DOM::ParseElementInstanceListsBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char *&pCur,
-        unsigned int &bufferSize,
+        size_t &bufferSize,
         PLYImporter *loader,
         bool p_bBE) {
     ASSIMP_LOG_VERBOSE_DEBUG("PLY::DOM::ParseElementInstanceListsBinary() begin");
@@ -533,11 +533,16 @@ bool PLY::DOM::ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, DOM *p_pc
         return false;
     }
 
-    streamBuffer.getNextBlock(buffer);
+    // A mapped file is parsed in place, everything else block by block
+    const char *pCur = nullptr;
+    size_t remaining = 0;
+    if (!streamBuffer.getRemainingData(pCur, remaining)) {
+        streamBuffer.getNextBlock(buffer);
+        pCur = (char *)&buffer[0];
+        remaining = buffer.size();
+    }
 
-    unsigned int bufferSize = static_cast<unsigned int>(buffer.size());
-    const char *pCur = (char *)&buffer[0];
-    if (!p_pcOut->ParseElementInstanceListsBinary(streamBuffer, buffer, pCur, bufferSize, loader, p_bBE)) {
+    if (!p_pcOut->ParseElementInstanceListsBinary(streamBuffer, buffer, pCur, remaining, loader, p_bBE)) {
         ASSIMP_LOG_VERBOSE_DEBUG("PLY::DOM::ParseInstanceBinary() failure");
         return false;
     }
@@ -619,18 +624,42 @@ bool PLY::ElementInstanceList::ParseInstanceList(
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Append the next file block to the unread rest of the buffer
+static void ReadNextBinaryBlock(IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        size_t &bufferSize) {
+    std::vector<char> nbuffer;
+    if (!streamBuffer.getNextBlock(nbuffer)) {
+        throw DeadlyImportError("Invalid .ply file: File corrupted");
+    }
+
+    // concat buffer contents
+    std::vector<char> rest(pCur, pCur + bufferSize);
+    rest.insert(rest.end(), nbuffer.begin(), nbuffer.end());
+    buffer.swap(rest);
+    bufferSize = buffer.size();
+    pCur = (char *)&buffer[0];
+}
+
 // ------------------------------------------------------------------------------------------------
 bool PLY::ElementInstanceList::ParseInstanceListBinary(
         IOStreamBuffer<char> &streamBuffer,
         std::vector<char> &buffer,
         const char *&pCur,
-        unsigned int &bufferSize,
+        size_t &bufferSize,
         const PLY::Element *pcElement,
         PLY::ElementInstanceList *p_pcOut,
         PLYImporter *loader,
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
 
+    // vertices and faces with a fixed layout go straight into the mesh
+    if (nullptr == p_pcOut && PLYImporter::CanLoadBinaryBlocks(pcElement)) {
+        return ParseInstanceListBinaryBlocks(streamBuffer, buffer, pCur, bufferSize, pcElement, loader, p_bBE);
+    }
+
     // we can add special handling code for unknown element semantics since
     // we can't skip it as a whole block (we don't know its exact size
     // due to the fact that lists could be contained in the property list
@@ -658,6 +687,32 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
     return true;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool PLY::ElementInstanceList::ParseInstanceListBinaryBlocks(
+        IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        size_t &bufferSize,
+        const PLY::Element *pcElement,
+        PLYImporter *loader,
+        bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+    ai_assert(nullptr != loader);
+
+    // hand all complete instances in the buffer to the loader, then fetch the next block
+    unsigned int pos = 0;
+    while (pos < pcElement->NumOccur) {
+        const char *next = loader->LoadBinaryBlock(pcElement, pCur, pCur + bufferSize, pos, p_bBE);
+        if (next == pCur) {
+            ReadNextBinaryBlock(streamBuffer, buffer, pCur, bufferSize);
+            continue;
+        }
+        bufferSize -= static_cast<size_t>(next - pCur);
+        pCur = next;
+    }
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 bool PLY::ElementInstance::ParseInstance(const char *&pCur, const char *end,
         const PLY::Element *pcElement,
@@ -687,7 +742,7 @@ bool PLY::ElementInstance::ParseInstanceBinary(
         IOStreamBuffer<char> &streamBuffer,
         std::vector<char> &buffer,
         const char *&pCur,
-        unsigned int &bufferSize,
+        size_t &bufferSize,
         const PLY::Element *pcElement,
         PLY::ElementInstance *p_pcOut,
         bool p_bBE /* = false */) {
@@ -751,7 +806,7 @@ bool PLY::PropertyInstance::ParseInstance(const char *&pCur, const char *end, co
 // ------------------------------------------------------------------------------------------------
 bool PLY::PropertyInstance::ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char *&pCur,
-        unsigned int &bufferSize,
+        size_t &bufferSize,
         const PLY::Property *prop,
         PLY::PropertyInstance *p_pcOut,
         bool p_bBE) {
@@ -851,61 +906,40 @@ bool PLY::PropertyInstance::ParseValue(const char *&pCur,
 bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
         std::vector<char> &buffer,
         const char *&pCur,
-        unsigned int &bufferSize,
+        size_t &bufferSize,
         PLY::EDataType eType,
         PLY::PropertyInstance::ValueUnion *out,
         bool p_bBE) {
     ai_assert(nullptr != out);
 
     // calc element size
-    unsigned int lsize = 0;
-    switch (eType) {
-    case EDT_Char:
-    case EDT_UChar:
-        lsize = 1;
-        break;
-
-    case EDT_UShort:
-    case EDT_Short:
-        lsize = 2;
-        break;
-
-    case EDT_UInt:
-    case EDT_Int:
-    case EDT_Float:
-        lsize = 4;
-        break;
-
-    case EDT_Double:
-        lsize = 8;
-        break;
-
-    case EDT_INVALID:
-    default:
-        break;
-    }
+    const unsigned int lsize = GetBinarySize(eType);
 
     // read the next file block if needed
     if (bufferSize < lsize) {
-        std::vector<char> nbuffer;
-        if (streamBuffer.getNextBlock(nbuffer)) {
-            // concat buffer contents
-            buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
-            buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
-            nbuffer.clear();
-            bufferSize = static_cast<unsigned int>(buffer.size());
-            pCur = (char *)&buffer[0];
-        } else {
-            throw DeadlyImportError("Invalid .ply file: File corrupted");
-        }
+        ReadNextBinaryBlock(streamBuffer, buffer, pCur, bufferSize);
     }
 
+    const bool ret = DecodeValueBinary(pCur, eType, out, p_bBE);
+    pCur += lsize;
+    bufferSize -= lsize;
+
+    return ret;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool PLY::PropertyInstance::DecodeValueBinary(const char *pCur,
+        PLY::EDataType eType,
+        PLY::PropertyInstance::ValueUnion *out,
+        bool p_bBE) {
+    ai_assert(nullptr != pCur);
+    ai_assert(nullptr != out);
+
     bool ret = true;
     switch (eType) {
     case EDT_UInt: {
         uint32_t t;
         memcpy(&t, pCur, sizeof(uint32_t));
-        pCur += sizeof(uint32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
@@ -916,7 +950,6 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     case EDT_UShort: {
         uint16_t t;
         memcpy(&t, pCur, sizeof(uint16_t));
-        pCur += sizeof(uint16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
@@ -927,7 +960,6 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     case EDT_UChar: {
         uint8_t t;
         memcpy(&t, pCur, sizeof(uint8_t));
-        pCur += sizeof(uint8_t);
         out->iUInt = t;
         break;
     }
@@ -935,7 +967,6 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     case EDT_Int: {
         int32_t t;
         memcpy(&t, pCur, sizeof(int32_t));
-        pCur += sizeof(int32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
@@ -946,7 +977,6 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     case EDT_Short: {
         int16_t t;
         memcpy(&t, pCur, sizeof(int16_t));
-        pCur += sizeof(int16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
@@ -957,7 +987,6 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     case EDT_Char: {
         int8_t t;
         memcpy(&t, pCur, sizeof(int8_t));
-        pCur += sizeof(int8_t);
         out->iInt = t;
         break;
     }
@@ -965,7 +994,6 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     case EDT_Float: {
         float t;
         memcpy(&t, pCur, sizeof(float));
-        pCur += sizeof(float);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
@@ -975,7 +1003,6 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     case EDT_Double: {
         double t;
         memcpy(&t, pCur, sizeof(double));
-        pCur += sizeof(double);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
@@ -986,11 +1013,36 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
         ret = false;
     }
 
-    bufferSize -= lsize;
-
     return ret;
 }
 
+// ------------------------------------------------------------------------------------------------
+unsigned int PLY::PropertyInstance::GetBinarySize(PLY::EDataType eType) {
+    switch (eType) {
+    case EDT_Char:
+    case EDT_UChar:
+        return 1;
+
+    case EDT_UShort:
+    case EDT_Short:
+        return 2;
+
+    case EDT_UInt:
+    case EDT_Int:
+    case EDT_Float:
+        return 4;
+
+    case EDT_Double:
+        return 8;
+
+    case EDT_INVALID:
+    default:
+        break;
+    }
+
+    return 0;
+}
+
 } // namespace Assimp
 
 #endif // !! ASSIMP_BUILD_NO_PLY_IMPORTER
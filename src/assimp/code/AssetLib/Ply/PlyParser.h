@@ -330,7 +330,7 @@ public:
     // -------------------------------------------------------------------
     //! Parse a property instance in binary format
     static bool ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, const Property* prop, PropertyInstance* p_pcOut, bool p_bBE);
+        const char* &pCur, size_t &bufferSize, const Property* prop, PropertyInstance* p_pcOut, bool p_bBE);
 
     // -------------------------------------------------------------------
     //! Get the default value for a given data type
@@ -343,7 +343,15 @@ public:
     // -------------------------------------------------------------------
     //! Parse a binary value
     static bool ParseValueBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, EDataType eType, ValueUnion* out, bool p_bBE);
+        const char* &pCur, size_t &bufferSize, EDataType eType, ValueUnion* out, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Decode a binary value whose bytes are all in memory
+    static bool DecodeValueBinary(const char* pCur, EDataType eType, ValueUnion* out, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Get the size of a binary value, 0 for invalid types
+    static unsigned int GetBinarySize(EDataType eType);
 
     // -------------------------------------------------------------------
     //! Convert a property value to a given type TYPE
@@ -370,7 +378,7 @@ public:
     // -------------------------------------------------------------------
     //! Parse a binary element instance
     static bool ParseInstanceBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, const Element* pcElement, ElementInstance* p_pcOut, bool p_bBE);
+        const char* &pCur, size_t &bufferSize, const Element* pcElement, ElementInstance* p_pcOut, bool p_bBE);
 };
 
 // ---------------------------------------------------------------------------------
@@ -394,7 +402,13 @@ public:
     // -------------------------------------------------------------------
     //! Parse a binary element instance list
     static bool ParseInstanceListBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
-        const char* &pCur, unsigned int &bufferSize, const Element* pcElement, ElementInstanceList* p_pcOut, PLYImporter* loader, bool p_bBE);
+        const char* &pCur, size_t &bufferSize, const Element* pcElement, ElementInstanceList* p_pcOut, PLYImporter* loader, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    //! Parse a binary element instance list the loader extracts block
+    //! by block, see PLYImporter::CanLoadBinaryBlocks()
+    static bool ParseInstanceListBinaryBlocks(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, size_t &bufferSize, const Element* pcElement, PLYImporter* loader, bool p_bBE);
 };
 // ---------------------------------------------------------------------------------
 /** \brief Class to represent the document object model of an ASCII or binary
@@ -441,7 +455,7 @@ private:
 
     // -------------------------------------------------------------------
     //! Read in all element instance lists for a binary file format
-    bool ParseElementInstanceListsBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer, const char* &pCur, unsigned int &bufferSize, PLYImporter* loader, bool p_bBE);
+    bool ParseElementInstanceListsBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer, const char* &pCur, size_t &bufferSize, PLYImporter* loader, bool p_bBE);
 };
 
 // ---------------------------------------------------------------------------------
@@ -44,11 +44,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_STL_IMPORTER
 
 #include "STLLoader.h"
+#include "Common/ThreadPool.h"
 #include <assimp/ParsingUtils.h>
 #include <assimp/fast_atof.h>
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
 #include <assimp/IOSystem.hpp>
 #include <memory>
 
@@ -121,6 +123,101 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
     }
     return isASCII;
 }
+
+// A corner of a binary facet as the weld sees it: the bits of its position and the color
+// attribute of the facet (0 if the facet has none). Corners with equal keys are welded.
+struct STLWeldKey {
+    uint32_t mBits[4];
+
+    bool operator==(const STLWeldKey &other) const {
+        return 0 == memcmp(mBits, other.mBits, sizeof(mBits));
+    }
+};
+
+// Open-addressing hash table handing out vertex indices for weld keys in order of their
+// first occurrence.
+class STLWeldTable {
+public:
+    explicit STLWeldTable(size_t expectedKeys) {
+        size_t numSlots = 64;
+        while (numSlots < 2 * expectedKeys) {
+            numSlots *= 2;
+        }
+        mSlots.assign(numSlots, 0u);
+        mKeys.reserve(expectedKeys);
+    }
+
+    unsigned int Insert(const STLWeldKey &key) {
+        size_t slot = Hash(key) & (mSlots.size() - 1);
+        while (0 != mSlots[slot]) {
+            if (mKeys[mSlots[slot] - 1] == key) {
+                return mSlots[slot] - 1;
+            }
+            slot = (slot + 1) & (mSlots.size() - 1);
+        }
+
+        mKeys.push_back(key);
+        mSlots[slot] = static_cast<unsigned int>(mKeys.size());
+        if (2 * mKeys.size() > mSlots.size()) {
+            Grow();
+        }
+        return static_cast<unsigned int>(mKeys.size() - 1);
+    }
+
+    const std::vector<STLWeldKey> &GetKeys() const {
+        return mKeys;
+    }
+
+private:
+    static size_t Hash(const STLWeldKey &key) {
+        uint64_t hash = 0;
+        for (uint32_t bits : key.mBits) {
+            hash = (hash ^ bits) * 0x9e3779b97f4a7c15ull;
+            hash ^= hash >> 29;
+        }
+        return static_cast<size_t>(hash);
+    }
+
+    void Grow() {
+        mSlots.assign(mSlots.size() * 2, 0u);
+        for (size_t i = 0; i < mKeys.size(); ++i) {
+            size_t slot = Hash(mKeys[i]) & (mSlots.size() - 1);
+            while (0 != mSlots[slot]) {
+                slot = (slot + 1) & (mSlots.size() - 1);
+            }
+            mSlots[slot] = static_cast<unsigned int>(i + 1);
+        }
+    }
+
+    std::vector<unsigned int> mSlots; // index into mKeys + 1, 0 for free slots
+    std::vector<STLWeldKey> mKeys;
+};
+
+// Welds the corners of count facets and writes the vertex index of each corner to indices
+void WeldFacets(const unsigned char *facets, size_t count, STLWeldTable &table, unsigned int *indices) {
+    for (size_t i = 0; i < count; ++i, facets += 50) {
+        uint16_t color;
+        ::memcpy(&color, facets + 48, sizeof(uint16_t));
+
+        STLWeldKey key;
+        key.mBits[3] = (color & (1 << 15)) ? color : 0u;
+        for (unsigned int c = 0; c < 3; ++c) {
+            // skip the facet normal
+            ::memcpy(key.mBits, facets + 12 * (c + 1), 3 * sizeof(uint32_t));
+            for (unsigned int k = 0; k < 3; ++k) {
+                // 0 and -0 are the same position
+                if (0x80000000u == key.mBits[k]) {
+                    key.mBits[k] = 0u;
+                }
+            }
+            *indices++ = table.Insert(key);
+        }
+    }
+}
+
+// Below this many facets per thread the weld is not split into chunks
+constexpr size_t STLMinFacetsPerChunk = 1 << 16;
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -136,6 +233,11 @@ STLImporter::STLImporter() :
 // Destructor, private as well
 STLImporter::~STLImporter() = default;
 
+// ------------------------------------------------------------------------------------------------
+void STLImporter::SetupProperties(const Importer *pImp) {
+    mWeld = pImp->GetPropertyBool(AI_CONFIG_IMPORT_STL_WELD, false);
+}
+
 // ------------------------------------------------------------------------------------------------
 // Returns whether the class can handle the format of the given file.
 bool STLImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bool /*checkSig*/) const {
@@ -150,10 +252,12 @@ const aiImporterDesc *STLImporter::GetInfo() const {
 
 void addFacesToMesh(aiMesh *pMesh) {
     pMesh->mFaces = new aiFace[pMesh->mNumFaces];
+    unsigned int *indices = pMesh->AllocateFaceIndices(3 * static_cast<size_t>(pMesh->mNumFaces));
     for (unsigned int i = 0, p = 0; i < pMesh->mNumFaces; ++i) {
 
         aiFace &face = pMesh->mFaces[i];
-        face.mIndices = new unsigned int[face.mNumIndices = 3];
+        face.mIndices = indices + p;
+        face.mNumIndices = 3;
         for (unsigned int o = 0; o < 3; ++o, ++p) {
             face.mIndices[o] = p;
         }
@@ -173,12 +277,17 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     mFileSize = file->FileSize();
 
     // allocate storage and copy the contents of the file to a memory buffer
-    // (terminate it with zero)
+    // (terminate it with zero). Binary files are read in place if the stream is mapped.
     std::vector<char> buffer2;
-    TextFileToBuffer(file.get(), buffer2);
+    const char *mapped = reinterpret_cast<const char *>(file->GetMappedData());
+    if (nullptr != mapped && IsBinarySTL(mapped, mFileSize)) {
+        mBuffer = mapped;
+    } else {
+        TextFileToBuffer(file.get(), buffer2);
+        mBuffer = &buffer2[0];
+    }
 
     mScene = pScene;
-    mBuffer = &buffer2[0];
 
     // the default vertex color is light gray.
     mClrColorDefault.r = mClrColorDefault.g = mClrColorDefault.b = mClrColorDefault.a = 0.6f;
@@ -434,6 +543,23 @@ bool STLImporter::LoadBinaryFile() {
     // now read the number of facets
     mScene->mRootNode->mName.Set("<STL_BINARY>");
 
+    aiNode *root = mScene->mRootNode;
+
+    // allocate one node
+    aiNode *node = new aiNode();
+    node->mParent = root;
+
+    root->mNumChildren = 1u;
+    root->mChildren = new aiNode *[root->mNumChildren];
+    root->mChildren[0] = node;
+
+    // add all created meshes to the single node
+    node->mNumMeshes = mScene->mNumMeshes;
+    node->mMeshes = new unsigned int[mScene->mNumMeshes];
+    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+        node->mMeshes[i] = i;
+    }
+
     pMesh->mNumFaces = *((uint32_t *)sz);
     sz += 4;
 
@@ -445,6 +571,11 @@ bool STLImporter::LoadBinaryFile() {
         throw DeadlyImportError("STL: file is empty. There are no facets defined");
     }
 
+    if (mWeld) {
+        WeldBinaryFacets(pMesh, sz, bIsMaterialise);
+        return bIsMaterialise && !pMesh->mColors[0];
+    }
+
     pMesh->mNumVertices = pMesh->mNumFaces * 3;
 
     aiVector3D *vp = pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
@@ -531,28 +662,100 @@ bool STLImporter::LoadBinaryFile() {
     // now copy faces
     addFacesToMesh(pMesh);
 
-    aiNode *root = mScene->mRootNode;
+    if (bIsMaterialise && !pMesh->mColors[0]) {
+        // use the color as diffuse material color
+        return true;
+    }
+    return false;
+}
 
-    // allocate one node
-    aiNode *node = new aiNode();
-    node->mParent = root;
+// ------------------------------------------------------------------------------------------------
+// Read the facets of a binary file into an indexed mesh
+void STLImporter::WeldBinaryFacets(aiMesh *pMesh, const unsigned char *facets, bool bIsMaterialise) {
+    const size_t numFacets = pMesh->mNumFaces;
+
+    // The corners index straight into the face index block of the mesh
+    unsigned int *indices = pMesh->AllocateFaceIndices(3 * numFacets);
+    pMesh->mFaces = new aiFace[numFacets];
+    for (size_t i = 0; i < numFacets; ++i) {
+        pMesh->mFaces[i].mNumIndices = 3;
+        pMesh->mFaces[i].mIndices = indices + 3 * i;
+    }
 
-    root->mNumChildren = 1u;
-    root->mChildren = new aiNode *[root->mNumChildren];
-    root->mChildren[0] = node;
+    // Closed meshes have about half as many vertices as facets
+    STLWeldTable table(numFacets / 2);
+    const size_t numChunks = nullptr == m_threadPool ? 1 : std::min<size_t>(m_threadPool->GetNumThreads(), numFacets / STLMinFacetsPerChunk);
+    if (numChunks < 2) {
+        WeldFacets(facets, numFacets, table, indices);
+    } else {
+        // Weld each chunk on its own, then merge the vertices of the chunks in order and
+        // remap the chunks' indices. Vertices keep the order of their first use, so the
+        // result is the same as welding in one go.
+        const size_t chunkSize = (numFacets + numChunks - 1) / numChunks;
+        std::vector<std::unique_ptr<STLWeldTable>> chunkTables(numChunks);
+        m_threadPool->ParallelFor(numChunks, [&](size_t c) {
+            const size_t first = c * chunkSize;
+            const size_t count = std::min(chunkSize, numFacets - first);
+            chunkTables[c].reset(new STLWeldTable(count / 2));
+            WeldFacets(facets + 50 * first, count, *chunkTables[c], indices + 3 * first);
+        });
+
+        std::vector<std::vector<unsigned int>> remap(numChunks);
+        for (size_t c = 0; c < numChunks; ++c) {
+            const std::vector<STLWeldKey> &keys = chunkTables[c]->GetKeys();
+            remap[c].resize(keys.size());
+            for (size_t k = 0; k < keys.size(); ++k) {
+                remap[c][k] = table.Insert(keys[k]);
+            }
+            chunkTables[c].reset();
+        }
 
-    // add all created meshes to the single node
-    node->mNumMeshes = mScene->mNumMeshes;
-    node->mMeshes = new unsigned int[mScene->mNumMeshes];
-    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
-        node->mMeshes[i] = i;
+        m_threadPool->ParallelFor(numChunks, [&](size_t c) {
+            const size_t first = c * chunkSize;
+            const size_t count = std::min(chunkSize, numFacets - first);
+            for (unsigned int *index = indices + 3 * first, *end = index + 3 * count; index != end; ++index) {
+                *index = remap[c][*index];
+            }
+        });
     }
 
-    if (bIsMaterialise && !pMesh->mColors[0]) {
-        // use the color as diffuse material color
-        return true;
+    const std::vector<STLWeldKey> &keys = table.GetKeys();
+    pMesh->mNumVertices = static_cast<unsigned int>(keys.size());
+    pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
+    bool hasColors = false;
+    for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+        aiVector3f position;
+        ::memcpy(&position, keys[v].mBits, sizeof(aiVector3f));
+        pMesh->mVertices[v] = aiVector3D(position.x, position.y, position.z);
+        hasColors = hasColors || 0 != keys[v].mBits[3];
     }
-    return false;
+
+    if (hasColors) {
+        ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
+        pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
+        const ai_real invVal((ai_real)1.0 / (ai_real)31.0);
+        for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+            const uint32_t color = keys[v].mBits[3];
+            aiColor4D &clr = pMesh->mColors[0][v];
+            if (0 == color) {
+                clr = mClrColorDefault;
+                continue;
+            }
+            clr.a = 1.0;
+            if (bIsMaterialise) // this is reversed
+            {
+                clr.r = (color & 0x1fu) * invVal;
+                clr.g = ((color & (0x1fu << 5)) >> 5u) * invVal;
+                clr.b = ((color & (0x1fu << 10)) >> 10u) * invVal;
+            } else {
+                clr.b = (color & 0x1fu) * invVal;
+                clr.g = ((color & (0x1fu << 5)) >> 5u) * invVal;
+                clr.r = ((color & (0x1fu << 10)) >> 10u) * invVal;
+            }
+        }
+    }
+
+    ASSIMP_LOG_DEBUG("STL: Welded ", 3 * numFacets, " corners into ", pMesh->mNumVertices, " vertices");
 }
 
 void STLImporter::pushMeshesToNode(std::vector<unsigned int> &meshIndices, aiNode *node) {
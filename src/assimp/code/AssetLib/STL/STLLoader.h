@@ -50,6 +50,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Forward declarations
 struct aiNode;
+struct aiMesh;
 
 namespace Assimp {
 
@@ -90,12 +91,23 @@ protected:
     void InternReadFile( const std::string& pFile, aiScene* pScene,
         IOSystem* pIOHandler) override;
 
+    /**
+     * @brief   Reads AI_CONFIG_IMPORT_STL_WELD.
+     */
+    void SetupProperties(const Importer* pImp) override;
+
     /**
      * @brief   Loads a binary .stl file
      * @return true if the default vertex color must be used as material color
      */
     bool LoadBinaryFile();
 
+    /**
+     * @brief   Turns the facets of a binary file into an indexed mesh, see
+     *  AI_CONFIG_IMPORT_STL_WELD
+     */
+    void WeldBinaryFacets(aiMesh *pMesh, const unsigned char *facets, bool bIsMaterialise);
+
     /**
      * @brief   Loads a ASCII text .stl file
      */
@@ -116,6 +128,9 @@ protected:
 
     /** Default vertex color */
     aiColor4D mClrColorDefault;
+
+    /** Weld the corners of binary files, see AI_CONFIG_IMPORT_STL_WELD */
+    bool mWeld = false;
 };
 
 } // end of namespace Assimp
@@ -121,6 +121,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssetLib/glTFCommon/glTFCommon.h"
 
+namespace Assimp {
+class ThreadPool;
+}
+
+#ifdef ASSIMP_ENABLE_DRACO
+namespace draco {
+class Mesh;
+}
+#endif
+
 namespace glTF2 {
 
 using glTFCommon::Nullable;
@@ -500,6 +510,10 @@ public:
 
     bool LoadFromStream(IOStream &stream, size_t length = 0, size_t baseOffset = 0);
 
+    /// Uses the data of a mapped stream (see IOStream::GetMappedData()) in place. The buffer
+    /// keeps the stream open for as long as it references the data.
+    bool LoadFromMappedStream(const std::shared_ptr<IOStream> &stream, size_t length, size_t baseOffset);
+
     /// \fn void EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
     /// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
     /// \param [in] pOffset - offset from begin of "bufferView" to encoded region, in bytes.
@@ -572,6 +586,7 @@ struct Accessor : public Object {
     unsigned int GetElementSize();
 
     inline uint8_t *GetPointer();
+    inline uint8_t *GetSparseData();
     inline size_t GetStride();
     inline size_t GetMaxByteSize();
 
@@ -629,6 +644,7 @@ struct Accessor : public Object {
         size_t valuesByteOffset;
 
         std::vector<uint8_t> data; //!< Actual data, which may be defaulted to an array of zeros or the original data, with the sparse buffer view applied on top of it.
+        bool populated = false; //!< data is filled on first access, see Accessor::GetPointer()
 
         void PopulateData(size_t numBytes, const uint8_t *bytes);
         void PatchData(unsigned int elementSize);
@@ -1243,6 +1259,15 @@ public:
 
     Ref<Buffer> GetBodyBuffer() { return mBodyBuffer; }
 
+    //! Sets the worker threads Load() may use, nullptr loads on the calling thread only
+    void SetThreadPool(Assimp::ThreadPool *pool) { mThreadPool = pool; }
+
+#ifdef ASSIMP_ENABLE_DRACO
+    //! Hands over the mesh decoded in advance for a KHR_draco_mesh_compression
+    //! extension object, or nullptr if it has not been decoded yet.
+    std::unique_ptr<draco::Mesh> TakeDecodedDraco(const Value &dracoExt);
+#endif
+
     Asset(Asset &) = delete;
     Asset &operator=(const Asset &) = delete;
 
@@ -1257,6 +1282,12 @@ private:
     void ReadExtensionsUsed(Document &doc);
     void ReadExtensionsRequired(Document &doc);
 
+#ifdef ASSIMP_ENABLE_DRACO
+    /// Decodes the Draco payloads of all mesh primitives on a thread pool before
+    /// the meshes themselves are read.
+    void DecodeDracoMeshes(Document &doc);
+#endif
+
     IOStream *OpenFile(const std::string &path, const char *mode, bool absolute = false);
 
 private:
@@ -1269,6 +1300,10 @@ private:
     IdMap mUsedIds;
     std::map<std::string, int, std::less<>> mUsedNamesMap;
     Ref<Buffer> mBodyBuffer;
+    Assimp::ThreadPool *mThreadPool = nullptr;
+#ifdef ASSIMP_ENABLE_DRACO
+    std::map<const Value *, std::unique_ptr<draco::Mesh>> mDecodedDraco;
+#endif
 };
 
 inline std::string getContextForErrorMessages(const std::string &id, const std::string &name) {
@@ -81,6 +81,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef DRACO_MESH_COMPRESSION_SUPPORTED
 #   error glTF: KHR_draco_mesh_compression: draco library must have DRACO_MESH_COMPRESSION_SUPPORTED
 #endif
+
+#include "Common/ThreadPool.h"
+#include <type_traits>
 #endif
 // clang-format on
 
@@ -324,6 +327,21 @@ template <typename T>
 static bool GetAttributeForAllPoints_Draco(const draco::Mesh &dracoMesh,
         const draco::PointAttribute &dracoAttribute,
         Buffer &outBuffer) {
+    // float32 attributes are stored just like the accessor wants them, copy the values
+    // as they are instead of converting them one component at a time
+    const size_t valueBytes = sizeof(T) * dracoAttribute.num_components();
+    if (std::is_same<T, float>::value && dracoAttribute.data_type() == draco::DT_FLOAT32 &&
+            dracoAttribute.byte_stride() == static_cast<int64_t>(valueBytes)) {
+        if (dracoAttribute.is_mapping_identity() && dracoAttribute.size() >= dracoMesh.num_points()) {
+            memcpy(outBuffer.GetPointer(), dracoAttribute.GetAddress(draco::AttributeValueIndex(0)), valueBytes * dracoMesh.num_points());
+            return true;
+        }
+        for (draco::PointIndex i(0); i < dracoMesh.num_points(); ++i) {
+            memcpy(outBuffer.GetPointer() + i.value() * valueBytes, dracoAttribute.GetAddressOfMappedIndex(i), valueBytes);
+        }
+        return true;
+    }
+
     size_t byteOffset = 0;
     T values[4] = { 0, 0, 0, 0 };
     for (draco::PointIndex i(0); i < dracoMesh.num_points(); ++i) {
@@ -614,12 +632,9 @@ inline void Buffer::Read(Value &obj, Asset &r) {
         if (byteLength > 0) {
             std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir.back() == '/' ? r.mCurrentAssetDir : r.mCurrentAssetDir + '/') : "";
 
-            IOStream *file = r.OpenFile(dir + uri, "rb");
+            std::shared_ptr<IOStream> file(r.OpenFile(dir + uri, "rb"));
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
-
-                if (!ok)
+                if (!LoadFromMappedStream(file, byteLength, 0) && !LoadFromStream(*file, byteLength))
                     throw DeadlyImportError("GLTF: error while reading referenced file \"", uri, "\"");
             } else {
                 throw DeadlyImportError("GLTF: could not open referenced file \"", uri, "\"");
@@ -647,6 +662,18 @@ inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseO
     return true;
 }
 
+inline bool Buffer::LoadFromMappedStream(const std::shared_ptr<IOStream> &stream, size_t length, size_t baseOffset) {
+    const uint8_t *mapped = stream->GetMappedData();
+    if (nullptr == mapped || baseOffset > stream->FileSize() || length > stream->FileSize() - baseOffset) {
+        return false;
+    }
+
+    byteLength = length;
+    // aliasing constructor: shares ownership of the stream, points at the body
+    mData = std::shared_ptr<uint8_t>(stream, const_cast<uint8_t *>(mapped + baseOffset));
+    return true;
+}
+
 inline void Buffer::EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t *pDecodedData, const size_t pDecodedData_Length, const std::string &pID) {
     // Check pointer to data
     if (pDecodedData == nullptr) throw DeadlyImportError("GLTF: for marking encoded region pointer to decoded data must be provided.");
@@ -945,21 +972,26 @@ inline void Accessor::Read(Value &obj, Asset &r) {
         }
 
 
-        const unsigned int elementSize = GetElementSize();
-        const size_t dataSize = count * elementSize;
+        // the patched copy is only made when the data is requested
         if (bufferView) {
             size_t bufferViewTailSize;
-            const uint8_t* bufferViewPointer = bufferView->GetPointerAndTailSize(byteOffset, bufferViewTailSize);
-            if (dataSize > bufferViewTailSize) {
+            bufferView->GetPointerAndTailSize(byteOffset, bufferViewTailSize);
+            if (count * GetElementSize() > bufferViewTailSize) {
                 throw DeadlyImportError("Invalid buffer when reading ", id.c_str(), name.empty() ? "" : " (" + name + ")");
             }
-            sparse->PopulateData(dataSize, bufferViewPointer);
-        }
-        else {
-            sparse->PopulateData(dataSize, nullptr);
         }
+    }
+}
+
+inline uint8_t *Accessor::GetSparseData() {
+    if (!sparse->populated) {
+        const unsigned int elementSize = GetElementSize();
+        size_t bufferViewTailSize;
+        sparse->PopulateData(count * elementSize, bufferView ? bufferView->GetPointerAndTailSize(byteOffset, bufferViewTailSize) : nullptr);
         sparse->PatchData(elementSize);
+        sparse->populated = true;
     }
+    return sparse->data.data();
 }
 
 inline unsigned int Accessor::GetNumComponents() {
@@ -979,7 +1011,7 @@ inline uint8_t *Accessor::GetPointer() {
         return decodedBuffer->GetPointer();
 
     if (sparse)
-        return sparse->data.data();
+        return GetSparseData();
 
     if (!bufferView || !bufferView->buffer) return nullptr;
     uint8_t *basePtr = bufferView->buffer->GetPointer();
@@ -1012,7 +1044,7 @@ inline size_t Accessor::GetMaxByteSize() {
     if (decodedBuffer)
         return decodedBuffer->byteLength;
 
-    return (bufferView ? bufferView->byteLength : sparse->data.size());
+    return (bufferView ? bufferView->byteLength : count * GetElementSize());
 }
 
 template <class T>
@@ -1045,6 +1077,7 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
             if (srcIdx >= maxIndexCount) {
                 throw DeadlyImportError("GLTF: index*stride ", (srcIdx * stride), " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
             }
+            // elemSize <= targetElemSize is checked above
             memcpy(outData + i, data + srcIdx * stride, elemSize);
         }
     } else { // non-indexed cases
@@ -1053,6 +1086,12 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
         }
         if (stride == elemSize && targetElemSize == elemSize) {
             memcpy(outData, data, totalSize);
+        } else if (targetElemSize == elemSize) {
+            // interleaved attributes in the layout of T: copies of a fixed size compile to
+            // plain loads and stores instead of a memcpy call per element
+            for (size_t i = 0; i < usedCount; ++i) {
+                memcpy(outData + i, data + i * stride, targetElemSize);
+            }
         } else {
             for (size_t i = 0; i < usedCount; ++i) {
                 memcpy(outData + i, data + i * stride, elemSize);
@@ -1538,21 +1577,25 @@ inline void Mesh::Read(Value &pJSON_Object, Asset &pAsset_Root) {
                 // Skip if any missing
                 if (Value *dracoExt = FindExtension(primitive, "KHR_draco_mesh_compression")) {
                     if (Value *bufView = FindUInt(*dracoExt, "bufferView")) {
-                        // Attempt to load indices and attributes using draco compression
-                        auto bufferView = pAsset_Root.bufferViews.Retrieve(bufView->GetUint());
-                        // Attempt to perform the draco decode on the buffer data
-                        const char *bufferViewData = reinterpret_cast<const char *>(bufferView->buffer->GetPointer() + bufferView->byteOffset);
-                        draco::DecoderBuffer decoderBuffer;
-                        decoderBuffer.Init(bufferViewData, bufferView->byteLength);
-                        draco::Decoder decoder;
-                        auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
-                        if (!decodeResult.ok()) {
-                            // A corrupt Draco isn't actually fatal if the primitive data is also provided in a standard buffer, but does anyone do that?
-                            throw DeadlyImportError("GLTF: Invalid Draco mesh compression in mesh: ", name, " primitive: ", i, ": ", decodeResult.status().error_msg_string());
-                        }
+                        // Use the mesh decoded by Asset::DecodeDracoMeshes(), if any
+                        std::unique_ptr<draco::Mesh> pDracoMesh = pAsset_Root.TakeDecodedDraco(*dracoExt);
+                        if (!pDracoMesh) {
+                            // Attempt to load indices and attributes using draco compression
+                            auto bufferView = pAsset_Root.bufferViews.Retrieve(bufView->GetUint());
+                            // Attempt to perform the draco decode on the buffer data
+                            const char *bufferViewData = reinterpret_cast<const char *>(bufferView->buffer->GetPointer() + bufferView->byteOffset);
+                            draco::DecoderBuffer decoderBuffer;
+                            decoderBuffer.Init(bufferViewData, bufferView->byteLength);
+                            draco::Decoder decoder;
+                            auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
+                            if (!decodeResult.ok()) {
+                                // A corrupt Draco isn't actually fatal if the primitive data is also provided in a standard buffer, but does anyone do that?
+                                throw DeadlyImportError("GLTF: Invalid Draco mesh compression in mesh: ", name, " primitive: ", i, ": ", decodeResult.status().error_msg_string());
+                            }
 
-                        // Now we have a draco mesh
-                        const std::unique_ptr<draco::Mesh> &pDracoMesh = decodeResult.value();
+                            // Now we have a draco mesh
+                            pDracoMesh = std::move(decodeResult).value();
+                        }
 
                         // Redirect the accessors to the decoded data
 
@@ -2053,7 +2096,8 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
 
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        if (!mBodyBuffer->LoadFromMappedStream(stream, mBodyLength, mBodyOffset) &&
+                !mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
@@ -2075,6 +2119,12 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
         mDicts[i]->AttachToDocument(doc);
     }
 
+#ifdef ASSIMP_ENABLE_DRACO
+    if (extensionsUsed.KHR_draco_mesh_compression && nullptr != mThreadPool) {
+        DecodeDracoMeshes(doc);
+    }
+#endif
+
     // Read the "extensions" property, then add it to each scene's metadata.
     CustomExtension customExtensions;
     if (Value *extensionsObject = FindObject(doc, "extensions")) {
@@ -2113,8 +2163,92 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
     for (size_t i = 0; i < mDicts.size(); ++i) {
         mDicts[i]->DetachFromDocument();
     }
+#ifdef ASSIMP_ENABLE_DRACO
+    // meshes not referenced by the scene were decoded for nothing
+    mDecodedDraco.clear();
+#endif
 }
 
+#ifdef ASSIMP_ENABLE_DRACO
+inline void Asset::DecodeDracoMeshes(Document &doc) {
+    struct DracoJob {
+        const Value *extension;
+        const char *data;
+        size_t length;
+        std::unique_ptr<draco::Mesh> mesh;
+    };
+    std::vector<DracoJob> jobs;
+
+    // Collect the payloads the same way Mesh::Read() finds them. Resolving the buffer
+    // views touches the dictionaries, so this part stays serial.
+    Value *meshesArray = FindArray(doc, "meshes");
+    if (nullptr == meshesArray) {
+        return;
+    }
+    for (unsigned int m = 0; m < meshesArray->Size(); ++m) {
+        Value *primitives = FindArray((*meshesArray)[m], "primitives");
+        if (nullptr == primitives) {
+            continue;
+        }
+        for (unsigned int p = 0; p < primitives->Size(); ++p) {
+            Value &primitive = (*primitives)[p];
+            const PrimitiveMode mode = MemberOrDefault(primitive, "mode", PrimitiveMode_TRIANGLES);
+            if (mode != PrimitiveMode_TRIANGLES && mode != PrimitiveMode_TRIANGLE_STRIP) {
+                continue;
+            }
+            Value *extensions = FindObject(primitive, "extensions");
+            Value *dracoExt = extensions ? FindObject(*extensions, "KHR_draco_mesh_compression") : nullptr;
+            Value *bufView = dracoExt ? FindMember(*dracoExt, "bufferView") : nullptr;
+            if (nullptr == bufView || !bufView->IsUint()) {
+                continue;
+            }
+            Ref<BufferView> bufferView = bufferViews.Retrieve(bufView->GetUint());
+            if (!bufferView->buffer || nullptr == bufferView->buffer->GetPointer()) {
+                continue;
+            }
+            jobs.push_back({ dracoExt, reinterpret_cast<const char *>(bufferView->buffer->GetPointer() + bufferView->byteOffset),
+                    bufferView->byteLength, nullptr });
+        }
+    }
+    if (jobs.size() < 2) {
+        return;
+    }
+
+    // largest payloads first so the workers finish at about the same time
+    std::sort(jobs.begin(), jobs.end(), [](const DracoJob &a, const DracoJob &b) {
+        return a.length > b.length;
+    });
+
+    // Payloads that fail to decode are left to Mesh::Read(), which reports the error
+    mThreadPool->ParallelFor(jobs.size(), [&jobs](size_t i) {
+        draco::DecoderBuffer decoderBuffer;
+        decoderBuffer.Init(jobs[i].data, jobs[i].length);
+        draco::Decoder decoder;
+        auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
+        if (decodeResult.ok()) {
+            jobs[i].mesh = std::move(decodeResult).value();
+        }
+    });
+
+    for (DracoJob &job : jobs) {
+        if (job.mesh) {
+            mDecodedDraco[job.extension] = std::move(job.mesh);
+        }
+    }
+    ASSIMP_LOG_DEBUG("Decoded ", mDecodedDraco.size(), " Draco primitives on ", mThreadPool->GetNumThreads(), " threads");
+}
+
+inline std::unique_ptr<draco::Mesh> Asset::TakeDecodedDraco(const Value &dracoExt) {
+    auto it = mDecodedDraco.find(&dracoExt);
+    if (it == mDecodedDraco.end()) {
+        return nullptr;
+    }
+    std::unique_ptr<draco::Mesh> mesh = std::move(it->second);
+    mDecodedDraco.erase(it);
+    return mesh;
+}
+#endif
+
 inline bool Asset::CanRead(const std::string &pFile, bool isBinary) {
     try {
         shared_ptr<IOStream> stream(OpenFile(pFile.c_str(), "rb", true));
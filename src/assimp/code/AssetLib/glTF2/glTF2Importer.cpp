@@ -59,6 +59,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/Profiler.h>
 
 #include <memory>
 #include <unordered_map>
@@ -408,35 +409,36 @@ void glTF2Importer::ImportMaterials(Asset &r) {
     }
 }
 
-static inline void SetFaceAndAdvance1(aiFace *&face, unsigned int numVertices, unsigned int a) {
-    if (a >= numVertices) {
+// The index arrays are taken from the index pool of the mesh
+static inline void SetFaceAndAdvance1(aiMesh *mesh, aiFace *&face, unsigned int a) {
+    if (a >= mesh->mNumVertices) {
         return;
     }
     face->mNumIndices = 1;
-    face->mIndices = new unsigned int[1];
+    face->mIndices = mesh->AllocateFaceIndices(1);
     face->mIndices[0] = a;
     ++face;
 }
 
-static inline void SetFaceAndAdvance2(aiFace *&face, unsigned int numVertices,
+static inline void SetFaceAndAdvance2(aiMesh *mesh, aiFace *&face,
         unsigned int a, unsigned int b) {
-    if ((a >= numVertices) || (b >= numVertices)) {
+    if ((a >= mesh->mNumVertices) || (b >= mesh->mNumVertices)) {
         return;
     }
     face->mNumIndices = 2;
-    face->mIndices = new unsigned int[2];
+    face->mIndices = mesh->AllocateFaceIndices(2);
     face->mIndices[0] = a;
     face->mIndices[1] = b;
     ++face;
 }
 
-static inline void SetFaceAndAdvance3(aiFace *&face, unsigned int numVertices, unsigned int a,
+static inline void SetFaceAndAdvance3(aiMesh *mesh, aiFace *&face, unsigned int a,
         unsigned int b, unsigned int c) {
-    if ((a >= numVertices) || (b >= numVertices) || (c >= numVertices)) {
+    if ((a >= mesh->mNumVertices) || (b >= mesh->mNumVertices) || (c >= mesh->mNumVertices)) {
         return;
     }
     face->mNumIndices = 3;
-    face->mIndices = new unsigned int[3];
+    face->mIndices = mesh->AllocateFaceIndices(3);
     face->mIndices[0] = a;
     face->mIndices[1] = b;
     face->mIndices[2] = c;
@@ -727,7 +729,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     nFaces = count;
                     facePtr = faces = new aiFace[nFaces];
                     for (unsigned int i = 0; i < count; ++i) {
-                        SetFaceAndAdvance1(facePtr, aim->mNumVertices, indexBuffer[i]);
+                        SetFaceAndAdvance1(aim, facePtr, indexBuffer[i]);
                     }
                     break;
                 }
@@ -740,7 +742,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     }
                     facePtr = faces = new aiFace[nFaces];
                     for (unsigned int i = 0; i < count; i += 2) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1]);
+                        SetFaceAndAdvance2(aim, facePtr, indexBuffer[i], indexBuffer[i + 1]);
                     }
                     break;
                 }
@@ -749,12 +751,12 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 case PrimitiveMode_LINE_STRIP: {
                     nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
                     facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1]);
+                    SetFaceAndAdvance2(aim, facePtr, indexBuffer[0], indexBuffer[1]);
                     for (unsigned int i = 2; i < count; ++i) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i - 1], indexBuffer[i]);
+                        SetFaceAndAdvance2(aim, facePtr, indexBuffer[i - 1], indexBuffer[i]);
                     }
                     if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[static_cast<int>(count) - 1], faces[0].mIndices[0]);
+                        SetFaceAndAdvance2(aim, facePtr, indexBuffer[static_cast<int>(count) - 1], faces[0].mIndices[0]);
                     }
                     break;
                 }
@@ -767,7 +769,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     }
                     facePtr = faces = new aiFace[nFaces];
                     for (unsigned int i = 0; i < count; i += 3) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
+                        SetFaceAndAdvance3(aim, facePtr, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
                     }
                     break;
                 }
@@ -778,10 +780,10 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         // The ordering is to ensure that the triangles are all drawn with the same orientation
                         if ((i + 1) % 2 == 0) {
                             // For even n, vertices n + 1, n, and n + 2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i + 1], indexBuffer[i], indexBuffer[i + 2]);
+                            SetFaceAndAdvance3(aim, facePtr, indexBuffer[i + 1], indexBuffer[i], indexBuffer[i + 2]);
                         } else {
                             // For odd n, vertices n, n+1, and n+2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
+                            SetFaceAndAdvance3(aim, facePtr, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
                         }
                     }
                     break;
@@ -789,9 +791,9 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 case PrimitiveMode_TRIANGLE_FAN:
                     nFaces = count - 2;
                     facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1], indexBuffer[2]);
+                    SetFaceAndAdvance3(aim, facePtr, indexBuffer[0], indexBuffer[1], indexBuffer[2]);
                     for (unsigned int i = 1; i < nFaces; ++i) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[i + 1], indexBuffer[i + 2]);
+                        SetFaceAndAdvance3(aim, facePtr, indexBuffer[0], indexBuffer[i + 1], indexBuffer[i + 2]);
                     }
                     break;
                 }
@@ -805,7 +807,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     nFaces = count;
                     facePtr = faces = new aiFace[nFaces];
                     for (unsigned int i = 0; i < count; ++i) {
-                        SetFaceAndAdvance1(facePtr, aim->mNumVertices, i);
+                        SetFaceAndAdvance1(aim, facePtr, i);
                     }
                     break;
                 }
@@ -818,7 +820,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     }
                     facePtr = faces = new aiFace[nFaces];
                     for (unsigned int i = 0; i < count; i += 2) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, i, i + 1);
+                        SetFaceAndAdvance2(aim, facePtr, i, i + 1);
                     }
                     break;
                 }
@@ -827,12 +829,12 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 case PrimitiveMode_LINE_STRIP: {
                     nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
                     facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, 0, 1);
+                    SetFaceAndAdvance2(aim, facePtr, 0, 1);
                     for (unsigned int i = 2; i < count; ++i) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, i - 1, i);
+                        SetFaceAndAdvance2(aim, facePtr, i - 1, i);
                     }
                     if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, count - 1, 0);
+                        SetFaceAndAdvance2(aim, facePtr, count - 1, 0);
                     }
                     break;
                 }
@@ -845,7 +847,7 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                     }
                     facePtr = faces = new aiFace[nFaces];
                     for (unsigned int i = 0; i < count; i += 3) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
+                        SetFaceAndAdvance3(aim, facePtr, i, i + 1, i + 2);
                     }
                     break;
                 }
@@ -856,10 +858,10 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                         // The ordering is to ensure that the triangles are all drawn with the same orientation
                         if ((i + 1) % 2 == 0) {
                             // For even n, vertices n + 1, n, and n + 2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, i + 1, i, i + 2);
+                            SetFaceAndAdvance3(aim, facePtr, i + 1, i, i + 2);
                         } else {
                             // For odd n, vertices n, n+1, and n+2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
+                            SetFaceAndAdvance3(aim, facePtr, i, i + 1, i + 2);
                         }
                     }
                     break;
@@ -867,9 +869,9 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
                 case PrimitiveMode_TRIANGLE_FAN:
                     nFaces = count - 2;
                     facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, 1, 2);
+                    SetFaceAndAdvance3(aim, facePtr, 0, 1, 2);
                     for (unsigned int i = 1; i < nFaces; ++i) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, i + 1, i + 2);
+                        SetFaceAndAdvance3(aim, facePtr, 0, i + 1, i + 2);
                     }
                     break;
                 }
@@ -1708,16 +1710,20 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
     this->mScene = pScene;
 
     // read the asset file
+    Profiling::ProfileScope parse(m_profiler, "parse");
     glTF2::Asset asset(pIOHandler, static_cast<rapidjson::IRemoteSchemaDocumentProvider *>(mSchemaDocumentProvider));
+    asset.SetThreadPool(m_threadPool);
     asset.Load(pFile,
                CheckMagicToken(
                    pIOHandler, pFile, AI_GLB_MAGIC_NUMBER, 1, 0,
                    static_cast<unsigned int>(strlen(AI_GLB_MAGIC_NUMBER))));
+    parse.End();
     if (asset.scene) {
         pScene->mName = asset.scene->name;
     }
 
     // Copy the data out
+    Profiling::ProfileScope convert(m_profiler, "convert");
     ImportEmbeddedTextures(asset);
     ImportMaterials(asset);
 
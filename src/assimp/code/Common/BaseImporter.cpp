@@ -89,7 +89,7 @@ using namespace Assimp;
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 BaseImporter::BaseImporter() AI_NO_EXCEPT
-        : m_progress() {
+        : m_progress(), m_profiler(), m_threadPool() {
     // empty
 }
 
@@ -116,6 +116,8 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
     }
 
     ai_assert(m_progress);
+    m_profiler = pImp->Pimpl()->mProfiler;
+    m_threadPool = pImp->Pimpl()->mThreadPool;
 
     // Gather configuration properties for this run
     SetupProperties(pImp);
@@ -139,8 +141,12 @@ aiScene *BaseImporter::ReadFile(Importer *pImp, const std::string &pFile, IOSyst
         m_ErrorText = err.what();
         ASSIMP_LOG_ERROR(err.what());
         m_Exception = std::current_exception();
+        m_profiler = nullptr;
+        m_threadPool = nullptr;
         return nullptr;
     }
+    m_profiler = nullptr;
+    m_threadPool = nullptr;
 
     // return what we gathered from the import.
     return sc.release();
@@ -472,13 +478,22 @@ void BaseImporter::TextFileToBuffer(IOStream *stream,
         }
     }
 
+    const uint8_t *mapped = stream->GetMappedData();
     data.reserve(fileSize + 1);
-    data.resize(fileSize);
-    if (fileSize > 0) {
-        if (fileSize != stream->Read(&data[0], 1, fileSize)) {
+    if (nullptr != mapped) {
+        // copy straight out of the mapping, callers need a terminated and writable buffer.
+        // The mapping ignores the read cursor, so start where Read() would and consume the rest.
+        const size_t pos = stream->Tell();
+        ai_assert(pos <= fileSize);
+        data.assign(mapped + pos, mapped + fileSize);
+        stream->Seek(0, aiOrigin_END);
+    } else {
+        data.resize(fileSize);
+        if (fileSize > 0 && fileSize != stream->Read(&data[0], 1, fileSize)) {
             throw DeadlyImportError("File read error");
         }
-
+    }
+    if (fileSize > 0) {
         ConvertToUTF8(data);
     }
 
@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "ThreadPool.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
@@ -53,7 +54,8 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
-          progress() {
+          progress(),
+          threadPool() {
     // empty
 }
 
@@ -101,3 +103,22 @@ void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
 bool BaseProcess::RequireVerboseFormat() const {
     return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::IsMeshLocal() const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ForEachMesh(const aiScene *pScene, const std::function<void(unsigned int)> &func) {
+    if (threadPool != nullptr && IsMeshLocal()) {
+        threadPool->ParallelFor(pScene->mNumMeshes, [&func](size_t i) {
+            func(static_cast<unsigned int>(i));
+        });
+        return;
+    }
+
+    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        func(a);
+    }
+}
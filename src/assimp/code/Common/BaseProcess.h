@@ -45,20 +45,24 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/GenericProperty.h>
 
+#include <functional>
 #include <map>
+#include <mutex>
 
 struct aiScene;
 
 namespace Assimp {
 
 class Importer;
+class ThreadPool;
 
 // ---------------------------------------------------------------------------
 /** Helper class to allow post-processing steps to interact with each other.
  *
  *  The class maintains a simple property list that can be used by pp-steps
  *  to provide additional information to other steps. This is primarily
- *  intended for cross-step optimizations.
+ *  intended for cross-step optimizations. Access is serialized, as mesh-local
+ *  steps may query it from several threads at once.
  */
 class SharedPostProcessInfo {
 public:
@@ -101,6 +105,7 @@ public:
 
     //! Remove all stored properties from the table
     void Clean() {
+        std::lock_guard<std::mutex> lock(mutex);
         // invoke the virtual destructor for all stored properties
         for (PropertyMap::iterator it = pmap.begin(), end = pmap.end();
                 it != end; ++it) {
@@ -146,21 +151,27 @@ public:
 
     //! Remove a property of a specific type
     void RemoveProperty(const char *name) {
+        std::lock_guard<std::mutex> lock(mutex);
         SetGenericPropertyPtr<Base>(pmap, name, nullptr );
     }
 
 private:
     void AddProperty(const char *name, Base *data) {
+        std::lock_guard<std::mutex> lock(mutex);
         SetGenericPropertyPtr<Base>(pmap, name, data);
     }
 
     Base *GetPropertyInternal(const char *name) const {
+        std::lock_guard<std::mutex> lock(mutex);
         return GetGenericProperty<Base *>(pmap, name, nullptr );
     }
 
 private:
     //! Map of all stored properties
     PropertyMap pmap;
+
+    //! Guards pmap
+    mutable std::mutex mutex;
 };
 
 #define AI_SPP_SPATIAL_SORT "$Spat"
@@ -200,6 +211,14 @@ public:
      *  in verbose format. */
     virtual bool RequireVerboseFormat() const;
 
+    // -------------------------------------------------------------------
+    /** Check whether the step only ever touches one mesh at a time, so
+     *  ForEachMesh() may process several meshes concurrently. Steps
+     *  overriding this to return true must not modify shared state from
+     *  their per-mesh work other than through SharedPostProcessInfo and
+     *  the logger. */
+    virtual bool IsMeshLocal() const;
+
     // -------------------------------------------------------------------
     /**
      * @brief Executes the post processing step on the given imported data.
@@ -242,12 +261,33 @@ public:
         return shared;
     }
 
+    // -------------------------------------------------------------------
+    /** Assign the thread pool ForEachMesh() distributes meshes over.
+     * @param pool May be nullptr, meshes are then processed serially
+     */
+    inline void SetThreadPool(ThreadPool *pool) {
+        threadPool = pool;
+    }
+
 protected:
+    // -------------------------------------------------------------------
+    /** Calls func for every mesh index of the scene. Runs on the thread
+     *  pool when the step is mesh-local and a pool is assigned, otherwise
+     *  in order on the calling thread.
+     * @param pScene The scene whose meshes to visit.
+     * @param func The per-mesh work, receives the mesh index.
+     */
+    void ForEachMesh(const aiScene *pScene, const std::function<void(unsigned int)> &func);
+
+
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
     /** Currently active progress handler */
     ProgressHandler *progress;
+
+    /** Worker threads for mesh-local steps, may be nullptr */
+    ThreadPool *threadPool;
 };
 
 } // end of namespace Assimp
@@ -58,12 +58,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/NullLogger.hpp>
 #include <iostream>
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
 #include <mutex>
+#ifndef ASSIMP_BUILD_SINGLETHREADED
 #include <thread>
 std::mutex loggerMutex;
 #endif
 
+// Post-processing may log from its worker threads (AI_CONFIG_GLOB_NUM_THREADS) even in
+// single-threaded builds, so writing to the streams is always serialized.
+static std::mutex streamWriteMutex;
+
 namespace Assimp {
 
 // ----------------------------------------------------------------------------------
@@ -395,6 +399,8 @@ void DefaultLogger::WriteToStreams(const char *message, ErrorSeverity ErrorSev)
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
     std::lock_guard<std::mutex> lock(m_arrayMutex);
+#else
+    std::lock_guard<std::mutex> lock(streamWriteMutex);
 #endif
 
     // Check whether this is a repeated message
@@ -0,0 +1,673 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ImportCache.cpp
+ *  @brief Implementation of the ImportCache class.
+ */
+
+#include "ImportCache.h"
+#include "Common/Importer.h"
+#include "Common/ScenePrivate.h"
+
+#if !defined(ASSIMP_BUILD_NO_EXPORT) && !defined(ASSIMP_BUILD_NO_ASSBIN_EXPORTER) && !defined(ASSIMP_BUILD_NO_ASSBIN_IMPORTER)
+#define AI_IMPORT_CACHE_SUPPORTED
+#include "AssetLib/Assbin/AssbinFileWriter.h"
+#include "AssetLib/Assbin/AssbinLoader.h"
+#endif
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Hash.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/StringUtils.h>
+#include <assimp/config.h>
+#include <assimp/scene.h>
+#include <assimp/version.h>
+
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <set>
+#include <sstream>
+#include <vector>
+
+namespace Assimp {
+
+namespace {
+    // First line of every index file, change it when the layout of the cache changes
+    const char *const IndexHeader = "assimp import cache 2";
+
+    const uint64_t HashSeed = 14695981039346656037ull;
+
+    // ------------------------------------------------------------------------------------------------
+    // 64 bit FNV-1a, the 32 bit SuperFastHash() collides too often for thousands of files
+    uint64_t Hash(const void *data, size_t size, uint64_t hash) {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ p[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    template <class T>
+    uint64_t HashValue(const T &value, uint64_t hash) {
+        return Hash(&value, sizeof(T), hash);
+    }
+
+    template <>
+    uint64_t HashValue<std::string>(const std::string &value, uint64_t hash) {
+        return Hash(value.c_str(), value.length() + 1, hash);
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Hash the contents of a file, false if it can not be opened
+    bool HashFile(IOSystem *io, const std::string &path, uint64_t &hash) {
+        IOStream *stream = io->Open(path.c_str(), "rb");
+        if (nullptr == stream) {
+            return false;
+        }
+
+        hash = HashSeed;
+        if (const uint8_t *data = stream->GetMappedData()) {
+            hash = Hash(data, stream->FileSize(), hash);
+        } else {
+            std::vector<uint8_t> buffer(1 << 16);
+            size_t read;
+            while (0 != (read = stream->Read(buffer.data(), 1, buffer.size()))) {
+                hash = Hash(buffer.data(), read, hash);
+            }
+        }
+        io->Close(stream);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    std::string ToHex(uint64_t value) {
+        char buffer[17];
+        ai_snprintf(buffer, sizeof(buffer), "%08x%08x", static_cast<unsigned int>(value >> 32),
+                static_cast<unsigned int>(value & 0xffffffffu));
+        return buffer;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Properties which don't change the imported scene, or which ReadFile() sets itself
+    bool IsIgnoredProperty(ImporterPimpl::KeyType key) {
+        static const ImporterPimpl::KeyType ignored[] = {
+            SuperFastHash(AI_CONFIG_IMPORT_CACHE_DIR),
+            SuperFastHash(AI_CONFIG_GLOB_MEASURE_TIME),
+            SuperFastHash(AI_CONFIG_GLOB_NUM_THREADS),
+            SuperFastHash(AI_CONFIG_APP_SCALE_KEY),
+            SuperFastHash("importerIndex"),
+            SuperFastHash("sourceFilePath")
+        };
+        for (ImporterPimpl::KeyType k : ignored) {
+            if (k == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <class Map>
+    uint64_t HashProperties(const Map &properties, uint64_t hash) {
+        for (const auto &property : properties) {
+            if (!IsIgnoredProperty(property.first)) {
+                hash = HashValue(property.first, hash);
+                hash = HashValue(property.second, hash);
+            }
+        }
+        return hash;
+    }
+
+#ifdef AI_IMPORT_CACHE_SUPPORTED
+    // ------------------------------------------------------------------------------------------------
+    bool ReadTextFile(IOSystem *io, const std::string &path, std::string &text) {
+        IOStream *stream = io->Open(path.c_str(), "rb");
+        if (nullptr == stream) {
+            return false;
+        }
+        text.resize(stream->FileSize());
+        const bool ok = text.empty() || stream->Read(&text[0], 1, text.size()) == text.size();
+        io->Close(stream);
+        return ok;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // The metadata types assbin can store
+    bool IsSupported(const aiMetadata *metadata) {
+        for (unsigned int i = 0; nullptr != metadata && i < metadata->mNumProperties; ++i) {
+            switch (metadata->mValues[i].mType) {
+            case AI_BOOL:
+            case AI_INT32:
+            case AI_UINT64:
+            case AI_FLOAT:
+            case AI_DOUBLE:
+            case AI_AISTRING:
+            case AI_AIVECTOR3D:
+                break;
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IsSupported(const aiNode *node) {
+        if (!IsSupported(node->mMetaData)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            if (!IsSupported(node->mChildren[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // Returns what the assbin format can not hold of the scene, nullptr if it holds all of it
+    const char *FindUnsupportedData(const aiScene *scene) {
+        if (nullptr == scene->mRootNode) {
+            return "a missing root node";
+        }
+        if (0 != scene->mNumSkeletons) {
+            return "skeletons";
+        }
+        if (!IsSupported(scene->mMetaData) || !IsSupported(scene->mRootNode)) {
+            return "metadata types";
+        }
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            const aiMesh *mesh = scene->mMeshes[i];
+            if (0 != mesh->mNumAnimMeshes || aiMorphingMethod_UNKNOWN != mesh->mMethod) {
+                return "animation meshes";
+            }
+            if (nullptr != mesh->mTextureCoordsNames) {
+                return "texture coordinate names";
+            }
+            if (mesh->mAABB.mMin != aiVector3D() || mesh->mAABB.mMax != aiVector3D()) {
+                return "bounding boxes";
+            }
+            for (unsigned int n = 1; n < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++n) {
+                if (nullptr == mesh->mTextureCoords[n - 1] && nullptr != mesh->mTextureCoords[n]) {
+                    return "sparse texture coordinate sets";
+                }
+            }
+            for (unsigned int n = 1; n < AI_MAX_NUMBER_OF_COLOR_SETS; ++n) {
+                if (nullptr == mesh->mColors[n - 1] && nullptr != mesh->mColors[n]) {
+                    return "sparse color sets";
+                }
+            }
+            for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+                if (nullptr != mesh->mBones[b]->mArmature || nullptr != mesh->mBones[b]->mNode) {
+                    return "armature data";
+                }
+            }
+        }
+        for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+            if (0 != scene->mAnimations[i]->mNumMeshChannels || 0 != scene->mAnimations[i]->mNumMorphMeshChannels) {
+                return "mesh animations";
+            }
+        }
+        for (unsigned int i = 0; i < scene->mNumLights; ++i) {
+            if (0.f != scene->mLights[i]->mSize.x || 0.f != scene->mLights[i]->mSize.y) {
+                return "area lights";
+            }
+        }
+        for (unsigned int i = 0; i < scene->mNumCameras; ++i) {
+            if (0.f != scene->mCameras[i]->mOrthographicWidth) {
+                return "orthographic cameras";
+            }
+        }
+        return nullptr;
+    }
+
+    // ------------------------------------------------------------------------------------------------
+    // assbin keeps metadata on nodes only. While the scene is written, the scene name and metadata,
+    // the mesh names and the texture file names travel on two extra nodes above the root node.
+    class SceneWrapper {
+    public:
+        explicit SceneWrapper(aiScene *scene) :
+                mScene(scene), mRoot(scene->mRootNode) {
+            mNames.mMetaData = aiMetadata::Alloc(scene->mNumMeshes + scene->mNumTextures);
+            for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+                mNames.mMetaData->Set(i, "m" + std::to_string(i), scene->mMeshes[i]->mName);
+            }
+            for (unsigned int i = 0; i < scene->mNumTextures; ++i) {
+                mNames.mMetaData->Set(scene->mNumMeshes + i, "t" + std::to_string(i), scene->mTextures[i]->mFilename);
+            }
+
+            mChildren[0] = &mNames;
+            mChildren[1] = mRoot;
+            mOuter.mName = scene->mName;
+            mOuter.mMetaData = scene->mMetaData;
+            mOuter.mNumChildren = 2;
+            mOuter.mChildren = mChildren;
+            scene->mRootNode = &mOuter;
+        }
+
+        ~SceneWrapper() {
+            mScene->mRootNode = mRoot;
+            mOuter.mMetaData = nullptr;
+            mOuter.mNumChildren = 0;
+            mOuter.mChildren = nullptr;
+        }
+
+        // Restores a scene read from the cache, false if it was not written by a SceneWrapper
+        static bool Unwrap(aiScene *scene) {
+            aiNode *outer = scene->mRootNode;
+            if (nullptr == outer || 2 != outer->mNumChildren) {
+                return false;
+            }
+            const aiMetadata *names = outer->mChildren[0]->mMetaData;
+            const unsigned int numNames = scene->mNumMeshes + scene->mNumTextures;
+            if ((nullptr == names ? 0 : names->mNumProperties) != numNames) {
+                return false;
+            }
+            for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+                names->Get(i, scene->mMeshes[i]->mName);
+            }
+            for (unsigned int i = 0; i < scene->mNumTextures; ++i) {
+                names->Get(scene->mNumMeshes + i, scene->mTextures[i]->mFilename);
+            }
+
+            scene->mName = outer->mName;
+            delete scene->mMetaData;
+            scene->mMetaData = outer->mMetaData;
+            outer->mMetaData = nullptr;
+
+            scene->mRootNode = outer->mChildren[1];
+            scene->mRootNode->mParent = nullptr;
+            outer->mChildren[1] = nullptr;
+            delete outer;
+            return true;
+        }
+
+    private:
+        aiScene *mScene;
+        aiNode *mRoot;
+        aiNode mOuter;
+        aiNode mNames;
+        aiNode *mChildren[2];
+    };
+#endif // AI_IMPORT_CACHE_SUPPORTED
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Forwards everything to the IO handler of the import and remembers which files were read and
+// which were looked for in vain
+class ImportCache::Recorder : public IOSystem {
+public:
+    explicit Recorder(IOSystem *wrapped) :
+            mWrapped(wrapped) {
+        // empty
+    }
+
+    bool Exists(const char *pFile) const override {
+        const bool exists = mWrapped->Exists(pFile);
+        if (!exists) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mMissing.insert(pFile);
+        }
+        return exists;
+    }
+
+    char getOsSeparator() const override {
+        return mWrapped->getOsSeparator();
+    }
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        IOStream *stream = mWrapped->Open(pFile, pMode);
+        if (nullptr != pFile) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            (nullptr != stream ? mOpened : mMissing).insert(pFile);
+        }
+        return stream;
+    }
+
+    void Close(IOStream *pFile) override {
+        mWrapped->Close(pFile);
+    }
+
+    bool ComparePaths(const char *one, const char *second) const override {
+        return mWrapped->ComparePaths(one, second);
+    }
+
+    bool PushDirectory(const std::string &path) override {
+        return mWrapped->PushDirectory(path);
+    }
+
+    const std::string &CurrentDirectory() const override {
+        return mWrapped->CurrentDirectory();
+    }
+
+    size_t StackSize() const override {
+        return mWrapped->StackSize();
+    }
+
+    bool PopDirectory() override {
+        return mWrapped->PopDirectory();
+    }
+
+    bool CreateDirectory(const std::string &path) override {
+        return mWrapped->CreateDirectory(path);
+    }
+
+    bool ChangeDirectory(const std::string &path) override {
+        return mWrapped->ChangeDirectory(path);
+    }
+
+    bool DeleteFile(const std::string &file) override {
+        return mWrapped->DeleteFile(file);
+    }
+
+    IOSystem *mWrapped;
+    mutable std::mutex mMutex;
+    mutable std::set<std::string> mOpened;
+    mutable std::set<std::string> mMissing;
+};
+
+// ------------------------------------------------------------------------------------------------
+ImportCache::ImportCache(const std::string &directory, IOSystem *io) :
+        mDirectory(directory),
+        mIO(io),
+        mFile(),
+        mBase(),
+        mInputs(),
+        mKey(),
+        mFlags(0),
+        mRecorder() {
+    ai_assert(nullptr != io);
+
+    const char last = mDirectory.empty() ? '\0' : mDirectory.back();
+    if ('/' != last && '\\' != last) {
+        mDirectory += '/';
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportCache::~ImportCache() = default;
+
+// ------------------------------------------------------------------------------------------------
+bool ImportCache::ComputeKey(const std::string &file, unsigned int flags, const ImporterPimpl *pimpl) {
+    ai_assert(nullptr != pimpl);
+
+#ifndef AI_IMPORT_CACHE_SUPPORTED
+    ASSIMP_LOG_WARN("Import cache: not available without the assbin importer and exporter");
+    return false;
+#endif // AI_IMPORT_CACHE_SUPPORTED
+
+    // there is no telling what a pointer property stands for
+    if (!pimpl->mPointerProperties.empty()) {
+        ASSIMP_LOG_DEBUG("Import cache: not used with pointer properties");
+        return false;
+    }
+
+    // importers name nodes and meshes after the file, so its name is part of the key
+    const std::string::size_type separator = file.find_last_of("\\/");
+    const std::string name = file.substr(std::string::npos == separator ? 0 : separator + 1);
+    if (std::string::npos != name.find('\n')) {
+        return false;
+    }
+
+    uint64_t contentHash;
+    if (!HashFile(mIO, file, contentHash)) {
+        return false;
+    }
+
+    uint64_t properties = HashProperties(pimpl->mIntProperties, HashSeed);
+    properties = HashProperties(pimpl->mFloatProperties, properties);
+    properties = HashProperties(pimpl->mStringProperties, properties);
+    properties = HashProperties(pimpl->mMatrixProperties, properties);
+
+    // The key hashes these lines, which are also written to the index and compared by Load().
+    // The library version is part of them, so updates don't load stale scenes.
+    std::ostringstream inputs;
+    inputs << "v " << aiGetVersionMajor() << '.' << aiGetVersionMinor() << '.' << aiGetVersionRevision()
+           << ' ' << aiGetCompileFlags() << '\n'
+           << "k " << ToHex(contentHash) << ' ' << flags << ' ' << ToHex(properties) << ' ' << name << '\n';
+
+    mFile = file;
+    mInputs = inputs.str();
+    mKey = ToHex(HashValue(mInputs, HashValue(std::string(IndexHeader), HashSeed)));
+    mFlags = flags;
+
+    // files next to the source are stored relative to it, so a directory moved as a whole
+    // still hits the cache
+    mBase = std::string::npos == separator ? std::string() : file.substr(0, separator + 1);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene *ImportCache::Load(Importer *importer) {
+    ai_assert(!mKey.empty());
+
+#ifdef AI_IMPORT_CACHE_SUPPORTED
+    DefaultIOSystem io;
+    std::string index;
+    if (!ReadTextFile(&io, GetPath(".deps"), index) || !IsUpToDate(index)) {
+        return nullptr;
+    }
+
+    AssbinImporter loader;
+    aiScene *scene = loader.ReadFile(importer, GetPath(".assbin"), &io);
+    if (nullptr == scene || !SceneWrapper::Unwrap(scene)) {
+        ASSIMP_LOG_WARN("Import cache: ignoring unreadable entry ", GetPath(".assbin"));
+        delete scene;
+        return nullptr;
+    }
+    ScenePriv(scene)->mPPStepsApplied = mFlags;
+
+    ASSIMP_LOG_INFO("Import cache: loaded ", mFile, " from ", GetPath(".assbin"));
+    return scene;
+#else
+    (void)importer;
+    return nullptr;
+#endif // AI_IMPORT_CACHE_SUPPORTED
+}
+
+// ------------------------------------------------------------------------------------------------
+IOSystem *ImportCache::GetRecorder() {
+    if (!mRecorder) {
+        mRecorder.reset(new Recorder(mIO));
+    }
+    return mRecorder.get();
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImportCache::Store(aiScene *scene) {
+    ai_assert(nullptr != scene);
+    ai_assert(!mKey.empty());
+
+#ifdef AI_IMPORT_CACHE_SUPPORTED
+    if (const char *unsupported = FindUnsupportedData(scene)) {
+        ASSIMP_LOG_DEBUG("Import cache: not storing ", mFile, ", assbin does not support ", unsupported);
+        return;
+    }
+
+    const std::string index = BuildIndex();
+    if (index.empty()) {
+        return;
+    }
+
+    DefaultIOSystem io;
+    io.CreateDirectory(mDirectory);
+
+    // Write to temporary files first, concurrent imports of the same file must not see half
+    // a scene. The index goes last, it makes the entry visible.
+    std::random_device device;
+    const std::string temporary = GetPath(".") + ToHex((static_cast<uint64_t>(device()) << 32) ^ device()) + ".tmp";
+    try {
+        {
+            SceneWrapper wrapper(scene);
+            DumpSceneToAssbin(temporary.c_str(), "\0", &io, scene, false, false);
+        }
+        if (!Commit(GetPath(".assbin"), temporary)) {
+            return;
+        }
+
+        IOStream *stream = io.Open(temporary.c_str(), "wb");
+        if (nullptr == stream) {
+            ASSIMP_LOG_WARN("Import cache: unable to write ", temporary);
+            return;
+        }
+        const size_t written = stream->Write(index.c_str(), 1, index.length());
+        io.Close(stream);
+        if (written != index.length()) {
+            io.DeleteFile(temporary);
+            ASSIMP_LOG_WARN("Import cache: unable to write ", temporary);
+            return;
+        }
+        Commit(GetPath(".deps"), temporary);
+    } catch (const std::exception &e) {
+        io.DeleteFile(temporary);
+        ASSIMP_LOG_WARN("Import cache: unable to store ", mFile, ": ", e.what());
+    }
+#else
+    (void)scene;
+#endif // AI_IMPORT_CACHE_SUPPORTED
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::GetPath(const char *extension) const {
+    return mDirectory + mKey + extension;
+}
+
+// ------------------------------------------------------------------------------------------------
+// After the header and the key inputs, index lines are "f <hash> <r|a> <path>" for files the
+// import read and "m <r|a> <path>" for files it did not find, r paths are relative to the
+// directory of the source file
+bool ImportCache::IsUpToDate(const std::string &index) const {
+    std::istringstream lines(index);
+    std::string line;
+    if (!std::getline(lines, line) || line != IndexHeader) {
+        return false;
+    }
+
+    // the key inputs follow the header, a different import with the same key must not match
+    std::istringstream inputs(mInputs);
+    std::string expected;
+    while (std::getline(inputs, expected)) {
+        if (!std::getline(lines, line) || line != expected) {
+            ASSIMP_LOG_WARN("Import cache: ", GetPath(".deps"), " belongs to a different import");
+            return false;
+        }
+    }
+
+    while (std::getline(lines, line)) {
+        const bool read = 0 == line.compare(0, 2, "f ");
+        const std::string::size_type start = read ? 2 + 16 + 1 : 2;
+        if (line.length() < start + 2 || (!read && 0 != line.compare(0, 2, "m "))) {
+            return false;
+        }
+        const std::string path = ('r' == line[start] ? mBase : std::string()) + line.substr(start + 2);
+
+        if (read) {
+            uint64_t hash;
+            if (!HashFile(mIO, path, hash) || ToHex(hash) != line.substr(2, 16)) {
+                ASSIMP_LOG_DEBUG("Import cache: ", path, " has changed");
+                return false;
+            }
+        } else if (mIO->Exists(path.c_str())) {
+            ASSIMP_LOG_DEBUG("Import cache: ", path, " has been added");
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::BuildIndex() const {
+    std::string index = IndexHeader;
+    index += '\n';
+    index += mInputs;
+    if (!mRecorder) {
+        return index;
+    }
+
+    const auto appendPath = [this, &index](const std::string &path) {
+        if (!mBase.empty() && 0 == path.compare(0, mBase.length(), mBase)) {
+            index += "r " + path.substr(mBase.length());
+        } else {
+            index += "a " + path;
+        }
+        index += '\n';
+    };
+
+    for (const std::string &path : mRecorder->mOpened) {
+        // the source file itself is part of the key
+        uint64_t hash;
+        if (path == mFile) {
+            continue;
+        }
+        if (std::string::npos != path.find('\n') || !HashFile(mIO, path, hash)) {
+            return std::string();
+        }
+        index += "f " + ToHex(hash) + ' ';
+        appendPath(path);
+    }
+    for (const std::string &path : mRecorder->mMissing) {
+        if (std::string::npos != path.find('\n')) {
+            return std::string();
+        }
+        if (0 == mRecorder->mOpened.count(path)) {
+            index += "m ";
+            appendPath(path);
+        }
+    }
+    return index;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Move a finished temporary file into place
+bool ImportCache::Commit(const std::string &path, const std::string &temporary) const {
+    if (0 != std::rename(temporary.c_str(), path.c_str())) {
+        // not all platforms replace existing files
+        std::remove(path.c_str());
+        if (0 != std::rename(temporary.c_str(), path.c_str())) {
+            std::remove(temporary.c_str());
+            ASSIMP_LOG_WARN("Import cache: unable to write ", path);
+            return false;
+        }
+    }
+    return true;
+}
+
+} // Namespace Assimp
@@ -0,0 +1,122 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ImportCache.h
+ *  @brief On-disk cache of imported and post-processed scenes, enabled
+ *  with AI_CONFIG_IMPORT_CACHE_DIR.
+ */
+#pragma once
+#ifndef AI_IMPORTCACHE_H_INC
+#define AI_IMPORTCACHE_H_INC
+
+#include <assimp/IOSystem.hpp>
+
+#include <memory>
+#include <string>
+
+struct aiScene;
+
+namespace Assimp {
+
+class Importer;
+class ImporterPimpl;
+
+// ---------------------------------------------------------------------------
+/** @brief Stores imported scenes as assbin files, keyed by a hash of the
+ *  source file and its name, the post-processing flags and the importer
+ *  properties.
+ *
+ *  Next to every scene the cache keeps the list of files the import read
+ *  through the IOSystem (materials, textures, external buffers, ...) with
+ *  the hashes of their contents, and the files it looked for but did not
+ *  find. A cached scene is only used while all of them are unchanged.
+ *  Scenes with data the assbin format can not hold are not cached.
+ */
+class ImportCache {
+public:
+    /// @brief  Creates the cache for one ReadFile() call.
+    /// @param  directory   The cache directory, it is created if needed.
+    /// @param  io          The IO handler the file is imported with.
+    ImportCache(const std::string &directory, IOSystem *io);
+
+    ~ImportCache();
+
+    ImportCache(const ImportCache &) = delete;
+    ImportCache &operator=(const ImportCache &) = delete;
+
+    /// @brief  Computes the cache key of an import.
+    /// @return false if the import can not be cached, e.g. since the file
+    ///         can not be read.
+    bool ComputeKey(const std::string &file, unsigned int flags, const ImporterPimpl *pimpl);
+
+    /// @brief  Loads the scene stored for the key, if its dependencies are unchanged.
+    /// @return The post-processed scene, nullptr on a cache miss.
+    aiScene *Load(Importer *importer);
+
+    /// @brief  Returns an IO handler which records the files the import reads.
+    IOSystem *GetRecorder();
+
+    /// @brief  Stores the scene and the files recorded while importing it.
+    ///         Failures are logged, the import itself is not affected.
+    void Store(aiScene *scene);
+
+private:
+    std::string GetPath(const char *extension) const;
+    bool IsUpToDate(const std::string &index) const;
+    std::string BuildIndex() const;
+    bool Commit(const std::string &path, const std::string &temporary) const;
+
+private:
+    class Recorder;
+
+    std::string mDirectory;
+    IOSystem *mIO;
+    std::string mFile;
+    std::string mBase;
+    std::string mInputs;
+    std::string mKey;
+    unsigned int mFlags;
+    std::unique_ptr<Recorder> mRecorder;
+};
+
+} // Namespace Assimp
+
+#endif // AI_IMPORTCACHE_H_INC
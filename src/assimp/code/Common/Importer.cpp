@@ -65,9 +65,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/Importer.h"
 #include "Common/BaseProcess.h"
 #include "Common/DefaultProgressHandler.h"
+#include "Common/ImportCache.h"
 #include "PostProcessing/ProcessHelper.h"
 #include "Common/ScenePreprocessor.h"
 #include "Common/ScenePrivate.h"
+#include "Common/ThreadPool.h"
 
 #include <assimp/BaseImporter.h>
 #include <assimp/GenericProperty.h>
@@ -193,6 +195,12 @@ Importer::~Importer() {
     // Delete shared post-processing data
     delete pimpl->mPPShared;
 
+    // Stop the post-processing worker threads
+    delete pimpl->mThreadPool;
+
+    // Drop the measurements of the last import
+    delete pimpl->mProfiler;
+
     // and finally the pimpl itself
     delete pimpl;
 }
@@ -582,6 +590,66 @@ void WriteLogOpening(const std::string& file) {
     ASSIMP_LOG_DEBUG(stream.str());
 }
 
+// ------------------------------------------------------------------------------------------------
+// Index the material properties once the scene is complete, so lookups by the application
+// don't scan them. Materials which already have a valid index are skipped.
+static void BuildMaterialPropertyIndices(aiScene *scene) {
+    if (nullptr == scene) {
+        return;
+    }
+    for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+        if (nullptr != scene->mMaterials[i]) {
+            scene->mMaterials[i]->BuildPropertyIndex();
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// (Re)create the thread pool of importers and post-processing steps to match AI_CONFIG_GLOB_NUM_THREADS
+static ThreadPool *UpdateThreadPool(ImporterPimpl *pimpl, int configured) {
+    const unsigned int numThreads = ThreadPool::ResolveNumThreads(configured);
+    if (pimpl->mThreadPool && pimpl->mThreadPool->GetNumThreads() != numThreads) {
+        delete pimpl->mThreadPool;
+        pimpl->mThreadPool = nullptr;
+    }
+    if (!pimpl->mThreadPool && numThreads > 1) {
+        pimpl->mThreadPool = new ThreadPool(numThreads);
+    }
+    return pimpl->mThreadPool;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Create or drop the profiler to match AI_CONFIG_GLOB_MEASURE_TIME
+static Profiler *UpdateProfiler(ImporterPimpl *pimpl, bool enabled) {
+    if (!enabled) {
+        delete pimpl->mProfiler;
+        pimpl->mProfiler = nullptr;
+    } else if (!pimpl->mProfiler) {
+        pimpl->mProfiler = new Profiler();
+    }
+    return pimpl->mProfiler;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Replaces the IO handler of an importer until the end of the scope, nullptr keeps it
+class ScopedIOHandler {
+public:
+    ScopedIOHandler(ImporterPimpl *pimpl, IOSystem *io) :
+            mPimpl(pimpl), mOld(pimpl->mIOHandler) {
+        if (nullptr != io) {
+            pimpl->mIOHandler = io;
+        }
+    }
+
+    ~ScopedIOHandler() {
+        mPimpl->mIOHandler = mOld;
+    }
+
+private:
+    ImporterPimpl *mPimpl;
+    IOSystem *mOld;
+};
+
 // ------------------------------------------------------------------------------------------------
 // Reads the given file and returns its contents if successful.
 const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
@@ -602,6 +670,15 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
     try
 #endif // ! ASSIMP_CATCH_GLOBAL_EXCEPTIONS
     {
+        // Start a new profile report, or drop the last one if profiling is off
+        Profiler *profiler = UpdateProfiler(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) != 0);
+        if (profiler) {
+            profiler->Reset();
+        }
+
+        // The importer reads the pool from the pimpl, see BaseImporter::ReadFile()
+        UpdateThreadPool(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 1));
+
         // Check whether this Importer instance has already loaded
         // a scene. In this case we need to delete the old one
         if (pimpl->mScene)  {
@@ -618,7 +695,21 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             return nullptr;
         }
 
-        std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+        // Take the scene from the import cache if the file was imported with these settings before
+        std::unique_ptr<ImportCache> cache;
+        const std::string cacheDirectory = GetPropertyString(AI_CONFIG_IMPORT_CACHE_DIR, "");
+        if (!cacheDirectory.empty()) {
+            cache.reset(new ImportCache(cacheDirectory, pimpl->mIOHandler));
+            if (!cache->ComputeKey(pFile, pFlags, pimpl)) {
+                cache.reset();
+            } else if (aiScene *scene = cache->Load(this)) {
+                pimpl->mScene = scene;
+                SetPropertyString("sourceFilePath", pFile);
+                BuildMaterialPropertyIndices(pimpl->mScene);
+                return pimpl->mScene;
+            }
+        }
+
         if (profiler) {
             profiler->BeginRegion("total");
         }
@@ -702,6 +793,9 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         ASSIMP_LOG_INFO("Found a matching importer for this file format: ", ext, "." );
         pimpl->mProgressHandler->UpdateFileRead( 0, fileSize );
 
+        // The cache needs to know which files the import and the post-processing read
+        ScopedIOHandler recording(pimpl, cache ? cache->GetRecorder() : nullptr);
+
         if (profiler) {
             profiler->BeginRegion("import");
         }
@@ -710,6 +804,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         pimpl->mProgressHandler->UpdateFileRead( fileSize, fileSize );
 
         if (profiler) {
+            profiler->SetSceneOut(pimpl->mScene);
             profiler->EndRegion("import");
         }
 
@@ -738,17 +833,24 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             // Preprocess the scene and prepare it for post-processing
             if (profiler) {
                 profiler->BeginRegion("preprocess");
+                profiler->SetSceneIn(pimpl->mScene);
             }
 
             ScenePreprocessor pre(pimpl->mScene);
             pre.ProcessScene();
 
             if (profiler) {
+                profiler->SetSceneOut(pimpl->mScene);
                 profiler->EndRegion("preprocess");
             }
 
             // Ensure that the validation process won't be called twice
             ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+            BuildMaterialPropertyIndices(pimpl->mScene);
+
+            if (cache && pimpl->mScene) {
+                cache->Store(pimpl->mScene);
+            }
         }
         // if failed, extract the error string
         else if( !pimpl->mScene) {
@@ -760,6 +862,7 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
         pimpl->mPPShared->Clean();
 
         if (profiler) {
+            profiler->SetSceneOut(pimpl->mScene);
             profiler->EndRegion("total");
         }
     }
@@ -785,6 +888,59 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Name of a post-processing step in the profile report: the flags it responds to, joined by '+'
+static std::string GetStepName(const BaseProcess *process, unsigned int pFlags) {
+    static const struct {
+        unsigned int flag;
+        const char *name;
+    } stepFlags[] = {
+        { aiProcess_CalcTangentSpace, "CalcTangentSpace" },
+        { aiProcess_JoinIdenticalVertices, "JoinIdenticalVertices" },
+        { aiProcess_MakeLeftHanded, "MakeLeftHanded" },
+        { aiProcess_Triangulate, "Triangulate" },
+        { aiProcess_RemoveComponent, "RemoveComponent" },
+        { aiProcess_GenNormals, "GenNormals" },
+        { aiProcess_GenSmoothNormals, "GenSmoothNormals" },
+        { aiProcess_SplitLargeMeshes, "SplitLargeMeshes" },
+        { aiProcess_PreTransformVertices, "PreTransformVertices" },
+        { aiProcess_LimitBoneWeights, "LimitBoneWeights" },
+        { aiProcess_ValidateDataStructure, "ValidateDataStructure" },
+        { aiProcess_ImproveCacheLocality, "ImproveCacheLocality" },
+        { aiProcess_RemoveRedundantMaterials, "RemoveRedundantMaterials" },
+        { aiProcess_FixInfacingNormals, "FixInfacingNormals" },
+        { aiProcess_PopulateArmatureData, "PopulateArmatureData" },
+        { aiProcess_SortByPType, "SortByPType" },
+        { aiProcess_FindDegenerates, "FindDegenerates" },
+        { aiProcess_FindInvalidData, "FindInvalidData" },
+        { aiProcess_GenUVCoords, "GenUVCoords" },
+        { aiProcess_TransformUVCoords, "TransformUVCoords" },
+        { aiProcess_FindInstances, "FindInstances" },
+        { aiProcess_OptimizeMeshes, "OptimizeMeshes" },
+        { aiProcess_OptimizeGraph, "OptimizeGraph" },
+        { aiProcess_FlipUVs, "FlipUVs" },
+        { aiProcess_FlipWindingOrder, "FlipWindingOrder" },
+        { aiProcess_SplitByBoneCount, "SplitByBoneCount" },
+        { aiProcess_Debone, "Debone" },
+        { aiProcess_GlobalScale, "GlobalScale" },
+        { aiProcess_EmbedTextures, "EmbedTextures" },
+        { aiProcess_ForceGenNormals, "ForceGenNormals" },
+        { aiProcess_DropNormals, "DropNormals" },
+        { aiProcess_GenBoundingBoxes, "GenBoundingBoxes" }
+    };
+
+    std::string name;
+    for (const auto &entry : stepFlags) {
+        if ((pFlags & entry.flag) && process->IsActive(entry.flag)) {
+            if (!name.empty()) {
+                name += '+';
+            }
+            name += entry.name;
+        }
+    }
+    return name.empty() ? std::string("CustomStep") : name;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Apply post-processing to the currently bound scene
 const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
@@ -830,19 +986,31 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    // Steps applied later on also go into the report of the last ReadFile()
+    Profiler *profiler = GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? UpdateProfiler(pimpl, true) : nullptr;
+    if (profiler) {
+        profiler->BeginRegion("postprocess");
+        profiler->SetSceneIn(pimpl->mScene);
+    }
+    ThreadPool *threadPool = UpdateThreadPool(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 1));
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
+
+        // Probe the name first: some steps pick up options from the flags passed to IsActive()
+        const std::string stepName = profiler ? GetStepName(process, pFlags) : std::string();
         if( process->IsActive( pFlags)) {
+            process->SetThreadPool(threadPool);
             if (profiler) {
-                profiler->BeginRegion("postprocess");
+                profiler->BeginRegion(stepName);
+                profiler->SetSceneIn(pimpl->mScene);
             }
 
             process->ExecuteOnScene ( this );
 
             if (profiler) {
-                profiler->EndRegion("postprocess");
+                profiler->SetSceneOut(pimpl->mScene);
+                profiler->EndRegion(stepName);
             }
         }
         if( !pimpl->mScene) {
@@ -867,10 +1035,16 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     pimpl->mProgressHandler->UpdatePostProcess( static_cast<int>(pimpl->mPostProcessingSteps.size()),
         static_cast<int>(pimpl->mPostProcessingSteps.size()) );
 
+    if (profiler) {
+        profiler->SetSceneOut(pimpl->mScene);
+        profiler->EndRegion("postprocess");
+    }
+
     // update private scene flags
     if( pimpl->mScene ) {
       ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags;
     }
+    BuildMaterialPropertyIndices(pimpl->mScene);
 
     // clear any data allocated by post-process steps
     pimpl->mPPShared->Clean();
@@ -925,15 +1099,20 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    Profiler *profiler = GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? UpdateProfiler(pimpl, true) : nullptr;
 
     if ( profiler ) {
         profiler->BeginRegion( "postprocess" );
+        profiler->SetSceneIn( pimpl->mScene );
     }
 
+    // the step belongs to the caller, so don't leave it pointing at our pool
+    rootProcess->SetThreadPool(UpdateThreadPool(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 1)));
     rootProcess->ExecuteOnScene( this );
+    rootProcess->SetThreadPool(nullptr);
 
     if ( profiler ) {
+        profiler->SetSceneOut( pimpl->mScene );
         profiler->EndRegion( "postprocess" );
     }
 
@@ -950,6 +1129,8 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // no validation
 
+    BuildMaterialPropertyIndices(pimpl->mScene);
+
     // clear any data allocated by post-process steps
     pimpl->mPPShared->Clean();
     ASSIMP_LOG_INFO( "Leaving customized post processing pipeline" );
@@ -1277,3 +1458,12 @@ void Importer::GetMemoryRequirements(aiMemoryInfo& in) const {
 
     in.total += in.materials;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Get the measurements of the last import
+const ProfileReport &Importer::GetProfileReport() const {
+    ai_assert(nullptr != pimpl);
+
+    static const ProfileReport empty;
+    return pimpl->mProfiler ? pimpl->mProfiler->GetReport() : empty;
+}
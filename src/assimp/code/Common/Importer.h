@@ -58,6 +58,10 @@ namespace Assimp {
     class BaseImporter;
     class BaseProcess;
     class SharedPostProcessInfo;
+    class ThreadPool;
+    namespace Profiling {
+        class Profiler;
+    }
 
 
 //! @cond never
@@ -126,6 +130,12 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Workers for importers and mesh-local post-process steps, nullptr when running single-threaded */
+    ThreadPool* mThreadPool;
+
+    /** Measurements of the last import, nullptr unless AI_CONFIG_GLOB_MEASURE_TIME is set */
+    Profiling::Profiler* mProfiler;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 
@@ -149,7 +159,9 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mMatrixProperties(),
         mPointerProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mThreadPool( nullptr ),
+        mProfiler( nullptr ) {
     // empty
 }
 //! @endcond
@@ -0,0 +1,232 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file MMapIOSystem.cpp
+ *  @brief Implementation of the memory mapped IOSystem.
+ */
+
+#include <assimp/MMapIOSystem.h>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+#ifdef _WIN32
+static std::wstring Utf8ToWide(const char *in) {
+    int size = MultiByteToWideChar(CP_UTF8, 0, in, -1, nullptr, 0);
+    if (size <= 0) {
+        return std::wstring();
+    }
+    std::wstring out(static_cast<size_t>(size) - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, in, -1, &out[0], size);
+
+    return out;
+}
+#endif
+
+// ------------------------------------------------------------------------------------------------
+MMapIOStream::MMapIOStream(const char *strFilename) :
+        mData(nullptr),
+        mSize(0),
+        mPos(0)
+#ifdef _WIN32
+        ,
+        mFile(INVALID_HANDLE_VALUE),
+        mMapping(nullptr)
+#endif
+{
+    ai_assert(strFilename != nullptr);
+
+#ifdef _WIN32
+    const std::wstring name = Utf8ToWide(strFilename);
+    if (name.empty()) {
+        return;
+    }
+    mFile = ::CreateFileW(name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (mFile == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(mFile, &size) || size.QuadPart <= 0) {
+        return;
+    }
+    mMapping = ::CreateFileMappingW(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mMapping == nullptr) {
+        return;
+    }
+    mData = static_cast<const uint8_t *>(::MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    if (mData != nullptr) {
+        mSize = static_cast<size_t>(size.QuadPart);
+    }
+#else
+    const int fd = ::open(strFilename, O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat statbuf;
+    if (::fstat(fd, &statbuf) == 0 && S_ISREG(statbuf.st_mode) && statbuf.st_size > 0) {
+        void *data = ::mmap(nullptr, static_cast<size_t>(statbuf.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            mData = static_cast<const uint8_t *>(data);
+            mSize = static_cast<size_t>(statbuf.st_size);
+        }
+    }
+    // the mapping keeps the file referenced
+    ::close(fd);
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+MMapIOStream::~MMapIOStream() {
+#ifdef _WIN32
+    if (mData != nullptr) {
+        ::UnmapViewOfFile(mData);
+    }
+    if (mMapping != nullptr) {
+        ::CloseHandle(mMapping);
+    }
+    if (mFile != INVALID_HANDLE_VALUE) {
+        ::CloseHandle(mFile);
+    }
+#else
+    if (mData != nullptr) {
+        ::munmap(const_cast<uint8_t *>(mData), mSize);
+    }
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MMapIOStream::Read(void *pvBuffer, size_t pSize, size_t pCount) {
+    ai_assert(nullptr != pvBuffer);
+    if (0 == pSize) {
+        return 0;
+    }
+
+    const size_t cnt = std::min(pCount, (mSize - mPos) / pSize);
+    const size_t ofs = pSize * cnt;
+
+    ::memcpy(pvBuffer, mData + mPos, ofs);
+    mPos += ofs;
+
+    return cnt;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MMapIOStream::Write(const void * /*pvBuffer*/, size_t /*pSize*/, size_t /*pCount*/) {
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------
+aiReturn MMapIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    if (aiOrigin_SET == pOrigin) {
+        if (pOffset > mSize) {
+            return AI_FAILURE;
+        }
+        mPos = pOffset;
+    } else if (aiOrigin_END == pOrigin) {
+        if (pOffset > mSize) {
+            return AI_FAILURE;
+        }
+        mPos = mSize - pOffset;
+    } else {
+        if (pOffset + mPos > mSize) {
+            return AI_FAILURE;
+        }
+        mPos += pOffset;
+    }
+    return AI_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MMapIOStream::Tell() const {
+    return mPos;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t MMapIOStream::FileSize() const {
+    return mSize;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MMapIOStream::Flush() {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+const uint8_t *MMapIOStream::GetMappedData() const {
+    return mData;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool MMapIOStream::IsOpen() const {
+    return mData != nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+IOStream *MMapIOSystem::Open(const char *strFile, const char *strMode) {
+    ai_assert(strFile != nullptr);
+    ai_assert(strMode != nullptr);
+
+    const bool readOnly = ::strpbrk(strMode, "wa+") == nullptr;
+    if (readOnly) {
+        MMapIOStream *stream = new MMapIOStream(strFile);
+        if (stream->IsOpen()) {
+            return stream;
+        }
+        delete stream;
+    }
+
+    return DefaultIOSystem::Open(strFile, strMode);
+}
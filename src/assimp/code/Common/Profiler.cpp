@@ -0,0 +1,271 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/** @file Profiler.cpp
+ *  @brief Implementation of the hierarchical import profiler and its report.
+ */
+
+#include <assimp/Profiler.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/scene.h>
+
+#include <locale>
+#include <sstream>
+
+#if defined(_WIN32)
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#   include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#   include <sys/resource.h>
+#endif
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+void CountScene(const aiScene *scene, unsigned int &vertices, unsigned int &faces) {
+    vertices = faces = 0;
+    if (nullptr == scene || nullptr == scene->mMeshes) {
+        return;
+    }
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        if (nullptr != scene->mMeshes[i]) {
+            vertices += scene->mMeshes[i]->mNumVertices;
+            faces += scene->mMeshes[i]->mNumFaces;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            static const char hex[] = "0123456789abcdef";
+            out << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+// ------------------------------------------------------------------------------------------------
+void WriteJsonRegions(std::ostream &out, const std::vector<ProfileRegion> &regions) {
+    out << '[';
+    for (size_t i = 0; i < regions.size(); ++i) {
+        const ProfileRegion &region = regions[i];
+        if (i) {
+            out << ',';
+        }
+        out << "{\"name\":";
+        WriteJsonString(out, region.mName);
+        out << ",\"calls\":" << region.mCalls
+            << ",\"seconds\":" << region.mSeconds
+            << ",\"peakMemory\":" << region.mPeakMemory
+            << ",\"peakMemoryIncrease\":" << region.mPeakMemoryIncrease
+            << ",\"verticesIn\":" << region.mVerticesIn
+            << ",\"verticesOut\":" << region.mVerticesOut
+            << ",\"facesIn\":" << region.mFacesIn
+            << ",\"facesOut\":" << region.mFacesOut
+            << ",\"children\":";
+        WriteJsonRegions(out, region.mChildren);
+        out << '}';
+    }
+    out << ']';
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+const ProfileRegion *ProfileRegion::FindChild(const std::string &name) const {
+    for (const ProfileRegion &child : mChildren) {
+        if (child.mName == name) {
+            return &child;
+        }
+    }
+    return nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+const ProfileRegion *ProfileReport::Find(const std::string &path) const {
+    const std::vector<ProfileRegion> *regions = &mRegions;
+    const ProfileRegion *found = nullptr;
+    std::string::size_type begin = 0;
+    while (begin <= path.size()) {
+        std::string::size_type end = path.find('/', begin);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        const std::string name = path.substr(begin, end - begin);
+        found = nullptr;
+        for (const ProfileRegion &region : *regions) {
+            if (region.mName == name) {
+                found = &region;
+                break;
+            }
+        }
+        if (nullptr == found) {
+            return nullptr;
+        }
+        regions = &found->mChildren;
+        begin = end + 1;
+    }
+    return found;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ProfileReport::ToJson() const {
+    std::ostringstream out;
+    out.imbue(std::locale::classic());
+    out.precision(9);
+    WriteJsonRegions(out, mRegions);
+    return out.str();
+}
+
+namespace Profiling {
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::BeginRegion(const std::string &region) {
+    std::vector<ProfileRegion> &siblings = mOpen.empty() ? mReport.mRegions : mOpen.back().region->mChildren;
+    ProfileRegion *entry = nullptr;
+    for (ProfileRegion &sibling : siblings) {
+        if (sibling.mName == region) {
+            entry = &sibling;
+            break;
+        }
+    }
+    if (nullptr == entry) {
+        // Only the children of the innermost open region grow, so pointers to the open
+        // regions further up stay valid
+        siblings.emplace_back();
+        entry = &siblings.back();
+        entry->mName = region;
+    }
+    ++entry->mCalls;
+
+    ASSIMP_LOG_DEBUG("START `", region, "`");
+    mOpen.push_back({ entry, std::chrono::steady_clock::now(), GetPeakMemory() });
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::EndRegion(const std::string &region) {
+    size_t index = mOpen.size();
+    while (index > 0 && mOpen[index - 1].region->mName != region) {
+        --index;
+    }
+    if (index == 0) {
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const size_t peakMemory = GetPeakMemory();
+    while (mOpen.size() >= index) {
+        const OpenRegion &open = mOpen.back();
+        const std::chrono::duration<double> elapsedSeconds = now - open.start;
+        open.region->mSeconds += elapsedSeconds.count();
+        open.region->mPeakMemory = peakMemory;
+        if (peakMemory > open.peakMemory) {
+            open.region->mPeakMemoryIncrease += peakMemory - open.peakMemory;
+        }
+        ASSIMP_LOG_DEBUG("END   `", open.region->mName, "`, dt= ", elapsedSeconds.count(), " s");
+        mOpen.pop_back();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::SetSceneIn(const aiScene *scene) {
+    if (mOpen.empty() || mOpen.back().region->mCalls > 1) {
+        return;
+    }
+    ProfileRegion *region = mOpen.back().region;
+    CountScene(scene, region->mVerticesIn, region->mFacesIn);
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::SetSceneOut(const aiScene *scene) {
+    if (mOpen.empty()) {
+        return;
+    }
+    ProfileRegion *region = mOpen.back().region;
+    CountScene(scene, region->mVerticesOut, region->mFacesOut);
+}
+
+// ------------------------------------------------------------------------------------------------
+void Profiler::Reset() {
+    mOpen.clear();
+    mReport.mRegions.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t Profiler::GetPeakMemory() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<size_t>(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#elif defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (0 != getrusage(RUSAGE_SELF, &usage)) {
+        return 0;
+    }
+#   ifdef __APPLE__
+    // bytes on macOS ...
+    return static_cast<size_t>(usage.ru_maxrss);
+#   else
+    // ... kilobytes everywhere else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024u;
+#   endif
+#else
+    return 0;
+#endif
+}
+
+} // namespace Profiling
+} // namespace Assimp
@@ -45,6 +45,8 @@ the 3ds loader handling smooth groups correctly  */
 
 #include <assimp/SGSpatialSort.h>
 
+#include <algorithm>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
@@ -69,6 +71,16 @@ void SGSpatialSort::Prepare()
 {
     // now sort the array ascending by distance.
     std::sort( this->mPositions.begin(), this->mPositions.end());
+
+    // Sort crowded positions into the grid as well, see SpatialGrid
+    mGrid.Clear();
+    const bool forceGrid = mBackend == SpatialSortBackend::Grid;
+    if (forceGrid || (mBackend == SpatialSortBackend::Automatic && mPositions.size() >= SpatialGrid::MinimumEntries)) {
+        if (!mPositions.empty() && mGrid.Setup(&mPositions[0].mPosition, mPositions.size(), sizeof(Entry)) &&
+                (forceGrid || !mGrid.UsePlaneInstead(mPositions))) {
+            mGrid.Build(&mPositions[0].mPosition, mPositions.size(), sizeof(Entry));
+        }
+    }
 }
 // ------------------------------------------------------------------------------------------------
 // Returns an iterator for all positions close to the given position.
@@ -84,6 +96,27 @@ void SGSpatialSort::FindPositions( const aiVector3D& pPosition,
     // clear the array
     poResults.clear();
 
+    // small radius on the grid: same tests as the scans below, results in the same order
+    if (!mGrid.Empty() && mGrid.FindCandidates(pPosition, pRadius, poResults))
+    {
+        const float squareEpsilon = pRadius * pRadius;
+        size_t found = 0;
+        for (const unsigned int entry : poResults)
+        {
+            const Entry& e = mPositions[entry];
+            if (e.mDistance < minDist || e.mDistance >= maxDist ||
+                (e.mPosition - pPosition).SquareLength() >= squareEpsilon)
+                continue;
+            if (exactMatch ? e.mSmoothGroups == pSG : (!pSG || e.mSmoothGroups & pSG || !e.mSmoothGroups))
+                poResults[found++] = entry;
+        }
+        poResults.resize(found);
+        std::sort(poResults.begin(), poResults.end());
+        for (unsigned int& entry : poResults)
+            entry = mPositions[entry].mIndex;
+        return;
+    }
+
     // quick check for positions outside the range
     if( mPositions.empty() )
         return;
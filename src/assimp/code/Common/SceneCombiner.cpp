@@ -888,6 +888,8 @@ void SceneCombiner::MergeMeshes(aiMesh **_out, unsigned int /*flags*/,
 
         unsigned int ofs = 0;
         for (std::vector<aiMesh *>::const_iterator it = begin; it != end; ++it) {
+            // the index arrays are moved, keep pooled ones alive
+            out->ShareFaceIndices(**it);
             for (unsigned int m = 0; m < (*it)->mNumFaces; ++m, ++pf2) {
                 aiFace &face = (*it)->mFaces[m];
                 pf2->mNumIndices = face.mNumIndices;
@@ -1079,6 +1081,9 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
     // get a flat copy
     *dest = *src;
 
+    // the face copies below own their index arrays
+    dest->mPrivate = nullptr;
+
     // and reallocate all arrays
     GetArrayCopy(dest->mVertices, dest->mNumVertices);
     GetArrayCopy(dest->mNormals, dest->mNumVertices);
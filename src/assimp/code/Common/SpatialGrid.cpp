@@ -0,0 +1,206 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the uniform grid behind SpatialSort and SGSpatialSort */
+
+#include <assimp/SpatialGrid.h>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace Assimp;
+
+namespace {
+
+// 21 bits per axis in a cell key
+constexpr unsigned int MaxCellsPerAxis = 1u << 21;
+
+// ------------------------------------------------------------------------------------------------
+inline const aiVector3D &PositionAt(const aiVector3D *pPositions, size_t index, size_t pElementOffset) {
+    return *reinterpret_cast<const aiVector3D *>(reinterpret_cast<const char *>(pPositions) + index * pElementOffset);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool SpatialGrid::Setup(const aiVector3D *pPositions, size_t pNumPositions, size_t pElementOffset) {
+    Clear();
+    if (0 == pNumPositions) {
+        return false;
+    }
+
+    // NaNs fail every comparison and stay out of the bounds
+    mMin = aiVector3D(std::numeric_limits<ai_real>::max());
+    mMax = aiVector3D(-std::numeric_limits<ai_real>::max());
+    for (size_t i = 0; i < pNumPositions; ++i) {
+        const aiVector3D &p = PositionAt(pPositions, i, pElementOffset);
+        for (unsigned int axis = 0; axis < 3; ++axis) {
+            if (p[axis] < mMin[axis]) {
+                mMin[axis] = p[axis];
+            }
+            if (p[axis] > mMax[axis]) {
+                mMax[axis] = p[axis];
+            }
+        }
+    }
+
+    const aiVector3D extent = mMax - mMin;
+    ai_real maxExtent = 0;
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+        if (!std::isfinite(extent[axis])) {
+            return false;
+        }
+        maxExtent = std::max(maxExtent, extent[axis]);
+    }
+
+    // Aim at two positions per cell over the axes the positions actually spread along
+    double volume = 1.0;
+    unsigned int dimensions = 0;
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+        if (extent[axis] > maxExtent * ai_real(1e-6)) {
+            volume *= extent[axis];
+            ++dimensions;
+        }
+    }
+    double cellSize = 1.0;
+    if (dimensions > 0) {
+        cellSize = std::pow(volume * 2.0 / double(pNumPositions), 1.0 / dimensions);
+        cellSize = std::max(cellSize, double(maxExtent) / (MaxCellsPerAxis - 1));
+    }
+    mCellSize = static_cast<ai_real>(cellSize);
+    if (!(mCellSize > 0) || !std::isfinite(mCellSize)) {
+        return false;
+    }
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+        mNumCells[axis] = std::min(MaxCellsPerAxis, static_cast<unsigned int>(extent[axis] / mCellSize) + 1u);
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int SpatialGrid::CellCoord(ai_real value, unsigned int axis) const {
+    const ai_real cell = (value - mMin[axis]) / mCellSize;
+    if (!(cell > 0)) {
+        return 0;
+    }
+    if (cell >= static_cast<ai_real>(mNumCells[axis] - 1)) {
+        return mNumCells[axis] - 1;
+    }
+    return static_cast<unsigned int>(cell);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialGrid::Build(const aiVector3D *pPositions, size_t pNumPositions, size_t pElementOffset) {
+    std::vector<uint64_t> keys(pNumPositions);
+    std::vector<unsigned int> entries(pNumPositions);
+    uint64_t allBits = 0;
+    for (size_t i = 0; i < pNumPositions; ++i) {
+        const aiVector3D &p = PositionAt(pPositions, i, pElementOffset);
+        keys[i] = CellKey(CellCoord(p.x, 0), CellCoord(p.y, 1), CellCoord(p.z, 2));
+        entries[i] = static_cast<unsigned int>(i);
+        allBits |= keys[i];
+    }
+
+    // LSD radix sort by key, one byte per pass. Bytes that are zero in every key are skipped.
+    mKeys.resize(pNumPositions);
+    mEntries.resize(pNumPositions);
+    for (unsigned int shift = 0; shift < 64; shift += 8) {
+        if (0 == ((allBits >> shift) & 0xff)) {
+            continue;
+        }
+        size_t offsets[257] = {};
+        for (size_t i = 0; i < pNumPositions; ++i) {
+            ++offsets[((keys[i] >> shift) & 0xff) + 1];
+        }
+        for (unsigned int b = 0; b < 256; ++b) {
+            offsets[b + 1] += offsets[b];
+        }
+        for (size_t i = 0; i < pNumPositions; ++i) {
+            const size_t target = offsets[(keys[i] >> shift) & 0xff]++;
+            mKeys[target] = keys[i];
+            mEntries[target] = entries[i];
+        }
+        keys.swap(mKeys);
+        entries.swap(mEntries);
+    }
+    mKeys.swap(keys);
+    mEntries.swap(entries);
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialGrid::Clear() {
+    mKeys.clear();
+    mEntries.clear();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SpatialGrid::FindCandidates(const aiVector3D &pPosition, ai_real pRadius,
+        std::vector<unsigned int> &poCandidates) const {
+    ai_assert(!Empty());
+    unsigned int lo[3], hi[3];
+    size_t numCells = 1;
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+        const ai_real low = pPosition[axis] - pRadius, high = pPosition[axis] + pRadius;
+        if (high < mMin[axis] || low > mMax[axis]) {
+            return true;
+        }
+        lo[axis] = CellCoord(low, axis);
+        hi[axis] = CellCoord(high, axis);
+        numCells *= hi[axis] - lo[axis] + 1;
+    }
+    if (numCells > MaximumQueryCells) {
+        return false;
+    }
+
+    // z is the lowest part of the key, so each row of cells along z is one contiguous range
+    for (unsigned int x = lo[0]; x <= hi[0]; ++x) {
+        for (unsigned int y = lo[1]; y <= hi[1]; ++y) {
+            const uint64_t last = CellKey(x, y, hi[2]);
+            std::vector<uint64_t>::const_iterator it = std::lower_bound(mKeys.begin(), mKeys.end(), CellKey(x, y, lo[2]));
+            for (; it != mKeys.end() && *it <= last; ++it) {
+                poCandidates.push_back(mEntries[it - mKeys.begin()]);
+            }
+        }
+    }
+    return true;
+}
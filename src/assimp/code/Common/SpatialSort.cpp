@@ -44,6 +44,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/SpatialSort.h>
 #include <assimp/ai_assert.h>
 
+#include <algorithm>
+
 using namespace Assimp;
 
 // CHAR_BIT seems to be defined under MVSC, but not under GCC. Pray that the correct value is 8.
@@ -59,7 +61,8 @@ const aiVector3D PlaneInit(0.8523f, 0.34321f, 0.5736f);
 // in the hope that no model spreads all its vertices along this plane.
 SpatialSort::SpatialSort(const aiVector3D *pPositions, unsigned int pNumPositions, unsigned int pElementOffset) :
         mPlaneNormal(PlaneInit),
-        mFinalized(false) {
+        mFinalized(false),
+        mBackend(SpatialSortBackend::Automatic) {
     mPlaneNormal.Normalize();
     Fill(pPositions, pNumPositions, pElementOffset);
 }
@@ -67,7 +70,8 @@ SpatialSort::SpatialSort(const aiVector3D *pPositions, unsigned int pNumPosition
 // ------------------------------------------------------------------------------------------------
 SpatialSort::SpatialSort() :
         mPlaneNormal(PlaneInit),
-        mFinalized(false) {
+        mFinalized(false),
+        mBackend(SpatialSortBackend::Automatic) {
     mPlaneNormal.Normalize();
 }
 
@@ -76,6 +80,7 @@ void SpatialSort::Fill(const aiVector3D *pPositions, unsigned int pNumPositions,
         unsigned int pElementOffset,
         bool pFinalize /*= true */) {
     mPositions.clear();
+    mGrid.Clear();
     mFinalized = false;
     Append(pPositions, pNumPositions, pElementOffset, pFinalize);
     mFinalized = pFinalize;
@@ -96,6 +101,16 @@ void SpatialSort::Finalize() {
         mPositions[i].mDistance = CalculateDistance(mPositions[i].mPosition);
     }
     std::sort(mPositions.begin(), mPositions.end());
+
+    // Sort crowded positions into the grid as well, see SpatialGrid
+    mGrid.Clear();
+    const bool forceGrid = mBackend == SpatialSortBackend::Grid;
+    if (forceGrid || (mBackend == SpatialSortBackend::Automatic && mPositions.size() >= SpatialGrid::MinimumEntries)) {
+        if (!mPositions.empty() && mGrid.Setup(&mPositions[0].mPosition, mPositions.size(), sizeof(Entry)) &&
+                (forceGrid || !mGrid.UsePlaneInstead(mPositions))) {
+            mGrid.Build(&mPositions[0].mPosition, mPositions.size(), sizeof(Entry));
+        }
+    }
     mFinalized = true;
 }
 
@@ -130,6 +145,22 @@ void SpatialSort::FindPositions(const aiVector3D &pPosition,
     // clear the array
     poResults.clear();
 
+    // small radius on the grid: same test as the scan below, results in the same order
+    if (!mGrid.Empty() && mGrid.FindCandidates(pPosition, pRadius, poResults)) {
+        const ai_real pSquared = pRadius * pRadius;
+        size_t found = 0;
+        for (const unsigned int entry : poResults) {
+            const Entry &e = mPositions[entry];
+            if (e.mDistance >= minDist && e.mDistance < maxDist && (e.mPosition - pPosition).SquareLength() < pSquared)
+                poResults[found++] = entry;
+        }
+        poResults.resize(found);
+        std::sort(poResults.begin(), poResults.end());
+        for (unsigned int &entry : poResults)
+            entry = mPositions[entry].mIndex;
+        return;
+    }
+
     // quick check for positions outside the range
     if (mPositions.size() == 0)
         return;
@@ -272,6 +303,24 @@ void SpatialSort::FindIdenticalPositions(const aiVector3D &pPosition, std::vecto
     // the array which we want to avoid
     poResults.resize(0);
 
+    // On the grid, identical positions are in the cell of the given one or, right at a border,
+    // in a neighbouring cell. Same tests as the scan below, results in the same order.
+    if (!mGrid.Empty() && mGrid.FindCandidates(pPosition, mGrid.GetCellSize() / 1024, poResults)) {
+        size_t found = 0;
+        for (const unsigned int entry : poResults) {
+            const Entry &e = mPositions[entry];
+            const BinFloat distBinary = ToBinary(e.mDistance);
+            if (distBinary >= minDistBinary && distBinary < maxDistBinary &&
+                    distance3DToleranceInULPs >= ToBinary((e.mPosition - pPosition).SquareLength()))
+                poResults[found++] = entry;
+        }
+        poResults.resize(found);
+        std::sort(poResults.begin(), poResults.end());
+        for (unsigned int &entry : poResults)
+            entry = mPositions[entry].mIndex;
+        return;
+    }
+
     // do a binary search for the minimal distance to start the iteration there
     unsigned int index = (unsigned int)mPositions.size() / 2;
     unsigned int binaryStepSize = (unsigned int)mPositions.size() / 4;
@@ -0,0 +1,186 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ThreadPool.cpp
+ *  @brief Implementation of the ThreadPool class.
+ */
+
+#include "ThreadPool.h"
+
+namespace Assimp {
+
+namespace {
+    // Set while a thread executes ParallelFor() items, nested jobs then run inline
+    thread_local bool tInsideJob = false;
+}
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::ThreadPool(unsigned int numThreads) :
+        mWorkers(),
+        mJob(nullptr),
+        mCount(0),
+        mNext(0),
+        mBusy(0),
+        mGeneration(0),
+        mStop(false),
+        mError() {
+    if (numThreads == 0) {
+        numThreads = ResolveNumThreads(0);
+    }
+    for (unsigned int i = 1; i < numThreads; ++i) {
+        mWorkers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mWake.notify_all();
+    for (std::thread &worker : mWorkers) {
+        worker.join();
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::GetNumThreads() const {
+    return static_cast<unsigned int>(mWorkers.size()) + 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int ThreadPool::ResolveNumThreads(int configured) {
+    if (configured > 0) {
+        return static_cast<unsigned int>(configured);
+    }
+    const unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)> &func) {
+    if (count == 0) {
+        return;
+    }
+    if (mWorkers.empty() || count == 1 || tInsideJob) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJob = &func;
+        mCount = count;
+        mNext = 0;
+        mBusy = static_cast<unsigned int>(mWorkers.size());
+        mError = nullptr;
+        ++mGeneration;
+    }
+    mWake.notify_all();
+
+    RunItems();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this] { return mBusy == 0; });
+        mJob = nullptr;
+        error = mError;
+        mError = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::WorkerLoop() {
+    unsigned long long seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWake.wait(lock, [this, seen] { return mStop || mGeneration != seen; });
+            if (mStop) {
+                return;
+            }
+            seen = mGeneration;
+        }
+
+        RunItems();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (--mBusy == 0) {
+            mDone.notify_one();
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void ThreadPool::RunItems() {
+    tInsideJob = true;
+    for (;;) {
+        size_t item;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mNext >= mCount) {
+                break;
+            }
+            item = mNext++;
+        }
+
+        try {
+            (*mJob)(item);
+        } catch (...) {
+            // keep the first error and let everyone run out of items
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mError) {
+                mError = std::current_exception();
+            }
+            mNext = mCount;
+        }
+    }
+    tInsideJob = false;
+}
+
+} // Namespace Assimp
@@ -0,0 +1,118 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ThreadPool.h
+ *  @brief Small fixed-size worker pool used to run independent work items,
+ *  such as per-mesh post-processing, concurrently.
+ */
+#pragma once
+#ifndef AI_THREADPOOL_H_INC
+#define AI_THREADPOOL_H_INC
+
+#include <assimp/defs.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief A fixed set of worker threads that execute ParallelFor() jobs.
+ *
+ *  The calling thread takes part in every job, so a pool of N threads owns
+ *  N-1 workers. A pool of one thread runs everything inline. Only one job
+ *  runs at a time; a ParallelFor() issued from inside a job runs serially
+ *  on the calling thread instead of deadlocking.
+ */
+class ASSIMP_API ThreadPool {
+public:
+    /// @brief  Creates the pool.
+    /// @param  numThreads  Total number of threads including the caller,
+    ///                     0 selects std::thread::hardware_concurrency().
+    explicit ThreadPool(unsigned int numThreads);
+
+    /// @brief  Joins all workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// @brief  Returns the number of threads work is spread over.
+    unsigned int GetNumThreads() const;
+
+    /// @brief  Calls func(i) for every i in [0, count) and returns once all
+    ///         calls have finished. Items are handed out one by one, so
+    ///         uneven work sizes balance themselves.
+    /// @param  count   The number of work items.
+    /// @param  func    The work item callback, must be safe to call concurrently.
+    /// @throw  The first exception thrown by any call is rethrown here after
+    ///         the remaining items have been skipped.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func);
+
+    /// @brief  Maps a AI_CONFIG_GLOB_NUM_THREADS value to a thread count.
+    /// @param  configured  The property value, <= 0 means all hardware threads.
+    static unsigned int ResolveNumThreads(int configured);
+
+private:
+    void WorkerLoop();
+    void RunItems();
+
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::condition_variable mDone;
+    const std::function<void(size_t)> *mJob;
+    size_t mCount;
+    size_t mNext;
+    unsigned int mBusy;
+    unsigned long long mGeneration;
+    bool mStop;
+    std::exception_ptr mError;
+};
+
+} // Namespace Assimp
+
+#endif // AI_THREADPOOL_H_INC
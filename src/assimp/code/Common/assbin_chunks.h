@@ -89,7 +89,9 @@ short       1 if the data after the header is compressed with the DEFLATE algori
 byte[256]   Zero-terminated source file name, UTF-8
 byte[128]   Zero-terminated command line parameters passed to assimp_cmd, UTF-8
 
-byte[64]    Reserved for future use
+integer     ASSBIN_BYTE_ORDER_MARK, to detect files written on machines with
+            another byte order. Older files have 0xcdcdcdcd here.
+byte[60]    Reserved for future use
 ---> Total length: 512 bytes
 
 -------------------------------------------------------------------------------
@@ -169,6 +171,7 @@ The general 'rule' to get from Assimp headers to the serialized layout is:
 
 
 #define ASSBIN_HEADER_LENGTH 512
+#define ASSBIN_BYTE_ORDER_MARK 0x01020304
 
 // these are the magic chunk identifiers for the binary ASS file format
 #define ASSBIN_CHUNK_AICAMERA                   0x1234
@@ -50,10 +50,88 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/material.h>
 #include <assimp/types.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <vector>
 
 using namespace Assimp;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Lookup index of a material, stored in aiMaterial::mPrivate. The properties are sorted by key,
+// so all keys starting with the key of a query form one range, and a hash table maps each
+// distinct key to the start of its range. The index describes one state of the property array;
+// all members of aiMaterial which modify the array drop it.
+struct MaterialPropertyIndex {
+    const aiMaterialProperty *const *mProperties = nullptr;
+    unsigned int mNumProperties = 0;
+
+    // property positions, sorted by key and then by position
+    std::vector<unsigned int> mSorted;
+
+    // open addressing hash table of sorted positions, UINT_MAX marks empty slots
+    std::vector<unsigned int> mSlots;
+
+    bool IsValidFor(const aiMaterial *pMat) const {
+        return mProperties == pMat->mProperties && mNumProperties == pMat->mNumProperties;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+void DropPropertyIndex(aiMaterial *pMat) {
+    delete static_cast<MaterialPropertyIndex *>(pMat->mPrivate);
+    pMat->mPrivate = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Finds the first property whose key starts with pKey, the same as the linear scan does
+const aiMaterialProperty *FindIndexedProperty(const MaterialPropertyIndex &index, const char *pKey,
+        unsigned int type, unsigned int idx) {
+    const aiMaterialProperty *const *props = index.mProperties;
+    const size_t length = strlen(pKey);
+
+    // an exact match of the key gives the start of the range directly ...
+    const unsigned int invalid = UINT_MAX;
+    const uint32_t mask = static_cast<uint32_t>(index.mSlots.size() - 1);
+    unsigned int start = invalid;
+    for (uint32_t slot = SuperFastHash(pKey, static_cast<uint32_t>(length)) & mask;; slot = (slot + 1) & mask) {
+        const unsigned int pos = index.mSlots[slot];
+        if (invalid == pos) {
+            break;
+        }
+        if (0 == strcmp(props[index.mSorted[pos]]->mKey.data, pKey)) {
+            start = pos;
+            break;
+        }
+    }
+
+    // ... otherwise there may still be keys with pKey as prefix
+    if (invalid == start) {
+        start = static_cast<unsigned int>(std::lower_bound(index.mSorted.begin(), index.mSorted.end(), pKey,
+                                                  [props](unsigned int a, const char *key) {
+                                                      return strcmp(props[a]->mKey.data, key) < 0;
+                                                  }) -
+                                          index.mSorted.begin());
+    }
+
+    unsigned int best = invalid;
+    for (unsigned int pos = start; pos < index.mSorted.size(); ++pos) {
+        const unsigned int i = index.mSorted[pos];
+        const aiMaterialProperty *prop = props[i];
+        if (0 != strncmp(prop->mKey.data, pKey, length)) {
+            break;
+        }
+        if (i < best && (UINT_MAX == type || prop->mSemantic == type) && (UINT_MAX == idx || prop->mIndex == idx)) {
+            best = i;
+        }
+    }
+    return invalid == best ? nullptr : props[best];
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Get a specific property from a material
 aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
@@ -65,10 +143,15 @@ aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
     ai_assert(pKey != nullptr);
     ai_assert(pPropOut != nullptr);
 
-    /*  Just search for a property with exactly this name ..
-     *  could be improved by hashing, but it's possibly
-     *  no worth the effort (we're bound to C structures,
-     *  thus std::map or derivates are not applicable. */
+    // Use the lookup index if there is one and the properties haven't changed behind its back
+    const MaterialPropertyIndex *propIndex = static_cast<const MaterialPropertyIndex *>(pMat->mPrivate);
+    if (nullptr != propIndex && propIndex->IsValidFor(pMat)) {
+        *pPropOut = FindIndexedProperty(*propIndex, pKey, type, index);
+        return nullptr != *pPropOut ? AI_SUCCESS : AI_FAILURE;
+    }
+
+    /*  Otherwise just search for a property with this name. Note that
+     *  any key starting with pKey matches, the index preserves this. */
     for (unsigned int i = 0; i < pMat->mNumProperties; ++i) {
         aiMaterialProperty *prop = pMat->mProperties[i];
 
@@ -483,7 +566,7 @@ static const unsigned int DefaultNumAllocated = 5;
 // ------------------------------------------------------------------------------------------------
 // Construction. Actually the one and only way to get an aiMaterial instance
 aiMaterial::aiMaterial() :
-        mProperties(nullptr), mNumProperties(0), mNumAllocated(DefaultNumAllocated) {
+        mProperties(nullptr), mNumProperties(0), mNumAllocated(DefaultNumAllocated), mPrivate(nullptr) {
     // Allocate 5 entries by default
     mProperties = new aiMaterialProperty *[DefaultNumAllocated];
 }
@@ -491,6 +574,7 @@ aiMaterial::aiMaterial() :
 // ------------------------------------------------------------------------------------------------
 aiMaterial::~aiMaterial() {
     Clear();
+    DropPropertyIndex(this);
 
     delete[] mProperties;
 }
@@ -505,6 +589,7 @@ aiString aiMaterial::GetName() const {
 
 // ------------------------------------------------------------------------------------------------
 void aiMaterial::Clear() {
+    DropPropertyIndex(this);
     for (unsigned int i = 0; i < mNumProperties; ++i) {
         // delete this entry
         delete mProperties[i];
@@ -518,6 +603,7 @@ void aiMaterial::Clear() {
 // ------------------------------------------------------------------------------------------------
 aiReturn aiMaterial::RemoveProperty(const char *pKey, unsigned int type, unsigned int index) {
     ai_assert(nullptr != pKey);
+    DropPropertyIndex(this);
 
     for (unsigned int i = 0; i < mNumProperties; ++i) {
         aiMaterialProperty *prop = mProperties[i];
@@ -553,6 +639,7 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
     if (0 == pSizeInBytes) {
         return AI_FAILURE;
     }
+    DropPropertyIndex(this);
 
     // first search the list whether there is already an entry with this key
     unsigned int iOutIndex(UINT_MAX);
@@ -655,6 +742,7 @@ void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
     ai_assert(nullptr != pcSrc);
     ai_assert(pcDest->mNumProperties <= pcDest->mNumAllocated);
     ai_assert(pcSrc->mNumProperties <= pcSrc->mNumAllocated);
+    DropPropertyIndex(pcDest);
 
     const unsigned int iOldNum = pcDest->mNumProperties;
     pcDest->mNumAllocated += pcSrc->mNumAllocated;
@@ -706,3 +794,48 @@ void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
         memcpy(prop->mData, propSrc->mData, prop->mDataLength);
     }
 }
+
+// ------------------------------------------------------------------------------------------------
+void aiMaterial::BuildPropertyIndex() {
+    const MaterialPropertyIndex *current = static_cast<const MaterialPropertyIndex *>(mPrivate);
+    if (nullptr != current && current->IsValidFor(this)) {
+        return;
+    }
+    DropPropertyIndex(this);
+    for (unsigned int i = 0; i < mNumProperties; ++i) {
+        if (nullptr == mProperties[i]) {
+            return;
+        }
+    }
+
+    std::unique_ptr<MaterialPropertyIndex> index(new MaterialPropertyIndex());
+    index->mProperties = mProperties;
+    index->mNumProperties = mNumProperties;
+
+    const aiMaterialProperty *const *props = mProperties;
+    index->mSorted.resize(mNumProperties);
+    std::iota(index->mSorted.begin(), index->mSorted.end(), 0u);
+    std::stable_sort(index->mSorted.begin(), index->mSorted.end(), [props](unsigned int a, unsigned int b) {
+        return strcmp(props[a]->mKey.data, props[b]->mKey.data) < 0;
+    });
+
+    // at most half of the slots are used
+    size_t numSlots = 2;
+    while (numSlots < 2 * static_cast<size_t>(mNumProperties)) {
+        numSlots *= 2;
+    }
+    index->mSlots.assign(numSlots, UINT_MAX);
+    const uint32_t mask = static_cast<uint32_t>(numSlots - 1);
+    for (unsigned int pos = 0; pos < mNumProperties; ++pos) {
+        const char *key = props[index->mSorted[pos]]->mKey.data;
+        if (pos > 0 && 0 == strcmp(props[index->mSorted[pos - 1]]->mKey.data, key)) {
+            continue;
+        }
+        uint32_t slot = SuperFastHash(key, static_cast<uint32_t>(strlen(key))) & mask;
+        while (UINT_MAX != index->mSlots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        index->mSlots[slot] = pos;
+    }
+    mPrivate = index.release();
+}
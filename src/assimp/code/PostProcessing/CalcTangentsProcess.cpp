@@ -51,6 +51,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/TinyFormatter.h>
 #include <assimp/qnan.h>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
@@ -66,6 +68,11 @@ bool CalcTangentsProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_CalcTangentSpace) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool CalcTangentsProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void CalcTangentsProcess::SetupProperties(const Importer *pImp) {
@@ -86,10 +93,10 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+    std::atomic<bool> bHas(false);
+    ForEachMesh(pScene, [&](unsigned int a) {
         if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
-    }
+    });
 
     if (bHas) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
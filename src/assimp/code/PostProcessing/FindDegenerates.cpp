@@ -240,9 +240,7 @@ bool FindDegeneratesProcess::ExecuteOnMesh(aiMesh *mesh) {
                 }
             } else {
                 // Otherwise delete it if we don't need this face
-                delete[] face_src.mIndices;
-                face_src.mIndices = nullptr;
-                face_src.mNumIndices = 0;
+                mesh->ReleaseFaceIndices(face_src);
             }
         }
         // Just leave the rest of the array unreferenced, we don't care for now
@@ -47,8 +47,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "FindInstancesProcess.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <memory>
 #include <stdio.h>
+#include <string>
+#include <unordered_map>
 
 using namespace Assimp;
 
@@ -56,6 +61,7 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 FindInstancesProcess::FindInstancesProcess()
 :   configSpeedFlag (false)
+,   configRigidFlag (false)
 {}
 
 // ------------------------------------------------------------------------------------------------
@@ -73,6 +79,9 @@ void FindInstancesProcess::SetupProperties(const Importer* pImp)
 {
     // AI_CONFIG_FAVOUR_SPEED
     configSpeedFlag = (0 != pImp->GetPropertyInteger(AI_CONFIG_FAVOUR_SPEED,0));
+
+    // AI_CONFIG_PP_FI_RIGID_INSTANCES
+    configRigidFlag = pImp->GetPropertyBool(AI_CONFIG_PP_FI_RIGID_INSTANCES,false);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -91,23 +100,260 @@ bool CompareBones(const aiMesh* orig, const aiMesh* inst)
         // compare weight per weight ---
         for (unsigned int n = 0; n < aha->mNumWeights;++n) {
             if  (aha->mWeights[n].mVertexId != oha->mWeights[n].mVertexId ||
-                (aha->mWeights[n].mWeight - oha->mWeights[n].mWeight) < 10e-3f) {
+                std::abs(aha->mWeights[n].mWeight - oha->mWeights[n].mWeight) >= 10e-3f) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compare the parts of two meshes which don't depend on their placement: colors, UV coordinates
+// and the vertex format, which *must* match due to the (brilliant) construction of the hash
+static bool CompareLayout(const aiMesh* orig, const aiMesh* inst)
+{
+    // check for hash collision
+    if (orig->mNumBones       != inst->mNumBones      ||
+        orig->mNumFaces       != inst->mNumFaces      ||
+        orig->mNumVertices    != inst->mNumVertices   ||
+        orig->mMaterialIndex  != inst->mMaterialIndex ||
+        orig->mPrimitiveTypes != inst->mPrimitiveTypes)
+        return false;
+
+    // use a constant epsilon for colors and UV coordinates
+    static const float uvEpsilon = 10e-4f;
+    for (unsigned int j = 0, end = orig->GetNumUVChannels(); j < end; ++j) {
+        if (orig->mTextureCoords[j] &&
+                !CompareArrays(orig->mTextureCoords[j],inst->mTextureCoords[j],orig->mNumVertices,uvEpsilon)) {
+            return false;
+        }
+    }
+    for (unsigned int j = 0, end = orig->GetNumColorChannels(); j < end; ++j) {
+        if (orig->mColors[j] &&
+                !CompareArrays(orig->mColors[j],inst->mColors[j],orig->mNumVertices,uvEpsilon)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Compare vertex positions, normals, tangents and bitangents using the given epsilon
+static bool CompareGeometry(const aiMesh* orig, const aiMesh* inst, float epsilon)
+{
+    if (orig->HasPositions()) {
+        if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
+            return false;
+    }
+    if (orig->HasNormals()) {
+        if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
+            return false;
+    }
+    if (orig->HasTangentsAndBitangents()) {
+        if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
+            !CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
+            return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Orthonormal frame spanned by three points, as the columns of a matrix
+static aiMatrix3x3 GetFrame(const aiVector3D& p0, const aiVector3D& p1, const aiVector3D& p2)
+{
+    aiVector3D e1 = p1 - p0;
+    aiVector3D e2 = p2 - p0;
+    e1.Normalize();
+    e2 -= e1 * (e1 * e2);
+    e2.Normalize();
+    const aiVector3D e3 = e1 ^ e2;
+    return aiMatrix3x3(e1.x, e2.x, e3.x,
+                       e1.y, e2.y, e3.y,
+                       e1.z, e2.z, e3.z);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Check whether inst is orig moved by a rotation and a translation, and return that transformation.
+// The vertices correspond by index, so three of them which span a plane determine it; all others
+// must match within epsilon.
+static bool FindRigidTransform(const aiMesh* orig, const aiMesh* inst, float epsilon, aiMatrix4x4& out)
+{
+    if (!orig->HasPositions() || orig->mNumBones || orig->mNumAnimMeshes || inst->mNumAnimMeshes) {
+        return false;
+    }
+
+    // two vertices far apart and a third one far away from the line through them
+    const aiVector3D* pos = orig->mVertices;
+    unsigned int i1 = 0, i2 = 0;
+    ai_real best = 0;
+    for (unsigned int v = 1; v < orig->mNumVertices; ++v) {
+        const ai_real d = (pos[v] - pos[0]).SquareLength();
+        if (d > best) {
+            best = d;
+            i1 = v;
+        }
+    }
+    if (best <= epsilon) {
+        return false;
+    }
+    const aiVector3D axis = aiVector3D(pos[i1] - pos[0]).Normalize();
+    best = 0;
+    for (unsigned int v = 1; v < orig->mNumVertices; ++v) {
+        const ai_real d = (axis ^ (pos[v] - pos[0])).SquareLength();
+        if (d > best) {
+            best = d;
+            i2 = v;
+        }
+    }
+    if (best <= epsilon) {
+        // all vertices on one line, the rotation about it is undetermined
+        return false;
+    }
+
+    const aiVector3D* ipos = inst->mVertices;
+    aiMatrix3x3 rotation = GetFrame(ipos[0], ipos[i1], ipos[i2]) * GetFrame(pos[0], pos[i1], pos[i2]).Transpose();
+    const aiVector3D translation = ipos[0] - rotation * pos[0];
+
+    for (unsigned int v = 0; v < orig->mNumVertices; ++v) {
+        if ((rotation * pos[v] + translation - ipos[v]).SquareLength() >= epsilon) {
+            return false;
+        }
+    }
+    const auto compareRotated = [&](const aiVector3D* first, const aiVector3D* second) {
+        for (unsigned int v = 0; v < orig->mNumVertices; ++v) {
+            if ((rotation * first[v] - second[v]).SquareLength() >= epsilon) {
                 return false;
             }
         }
+        return true;
+    };
+    if (orig->HasNormals() && !compareRotated(orig->mNormals, inst->mNormals)) {
+        return false;
+    }
+    if (orig->HasTangentsAndBitangents() && (!compareRotated(orig->mTangents, inst->mTangents) ||
+            !compareRotated(orig->mBitangents, inst->mBitangents))) {
+        return false;
     }
+
+    out = aiMatrix4x4(rotation);
+    out.a4 = translation.x;
+    out.b4 = translation.y;
+    out.c4 = translation.z;
     return true;
 }
 
 // ------------------------------------------------------------------------------------------------
-// Update mesh indices in the node graph
-void UpdateMeshIndices(aiNode* node, unsigned int* lookup)
+// Mean squared distance of the vertices from their centroid, which a rigid transformation keeps
+static ai_real GetSpread(const aiMesh* mesh)
 {
-    for (unsigned int n = 0; n < node->mNumMeshes;++n)
-        node->mMeshes[n] = lookup[node->mMeshes[n]];
+    if (!mesh->HasPositions() || !mesh->mNumVertices) {
+        return 0;
+    }
+    aiVector3D centroid;
+    for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+        centroid += mesh->mVertices[v];
+    }
+    centroid /= static_cast<ai_real>(mesh->mNumVertices);
+    ai_real spread = 0;
+    for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+        spread += (mesh->mVertices[v] - centroid).SquareLength();
+    }
+    return spread / mesh->mNumVertices;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Update mesh indices in the node graph. Rigid instances are moved to a child node which
+// applies their transformation to the shared mesh.
+void UpdateMeshIndices(aiNode* node, const unsigned int* lookup, const std::map<unsigned int, aiMatrix4x4>& transforms)
+{
+    std::vector<aiNode*> instances;
+    unsigned int kept = 0;
+    for (unsigned int n = 0; n < node->mNumMeshes;++n) {
+        const unsigned int mesh = node->mMeshes[n];
+        const auto it = transforms.find(mesh);
+        if (it == transforms.end()) {
+            node->mMeshes[kept++] = lookup[mesh];
+            continue;
+        }
+        aiNode* child = new aiNode();
+        child->mName = node->mName;
+        child->mName.Append(("_instance" + std::to_string(instances.size())).c_str());
+        child->mTransformation = it->second;
+        child->mNumMeshes = 1;
+        child->mMeshes = new unsigned int[1];
+        child->mMeshes[0] = lookup[mesh];
+        instances.push_back(child);
+    }
+    node->mNumMeshes = kept;
+    if (!kept) {
+        delete[] node->mMeshes;
+        node->mMeshes = nullptr;
+    }
 
     for (unsigned int n = 0; n < node->mNumChildren;++n)
-        UpdateMeshIndices(node->mChildren[n],lookup);
+        UpdateMeshIndices(node->mChildren[n],lookup,transforms);
+
+    if (!instances.empty()) {
+        node->addChildren(static_cast<unsigned int>(instances.size()), instances.data());
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Check whether inst is an instance of orig, possibly under a rigid transformation
+bool FindInstancesProcess::IsInstance(const aiMesh* orig, const aiMesh* inst, float epsilon,
+        ai_real spreadOrig, ai_real spreadInst, bool& rigid, aiMatrix4x4& transform) const
+{
+    if (!CompareLayout(orig, inst)) {
+        return false;
+    }
+
+    // up to now the meshes are equal. Now compare vertex positions, normals,
+    // tangents and bitangents using this epsilon.
+    rigid = !CompareGeometry(orig, inst, epsilon);
+    if (rigid) {
+        if (!configRigidFlag) {
+            return false;
+        }
+
+        // the spread is cheap to compare and rules out most candidates
+        const ai_real tolerance = 4 * std::sqrt(epsilon * std::max(spreadOrig, spreadInst)) + epsilon;
+        if (std::abs(spreadOrig - spreadInst) > tolerance || !FindRigidTransform(orig, inst, epsilon, transform)) {
+            return false;
+        }
+    }
+
+    // These two checks are actually quite expensive and almost *never* required.
+    // Almost. That's why they're still here. But there's no reason to do them
+    // in speed-targeted imports.
+    if (!configSpeedFlag) {
+
+        // It seems to be strange, but we really need to check whether the
+        // bones are identical too. Although it's extremely unprobable
+        // that they're not if control reaches here, we need to deal
+        // with unprobable cases, too. It could still be that there are
+        // equal shapes which are deformed differently.
+        if (!CompareBones(orig,inst))
+            return false;
+
+        // For completeness ... compare even the index buffers for equality
+        // face order & winding order doesn't care. Input data is in verbose format.
+        std::unique_ptr<unsigned int[]> ftbl_orig(new unsigned int[orig->mNumVertices]);
+        std::unique_ptr<unsigned int[]> ftbl_inst(new unsigned int[orig->mNumVertices]);
+
+        for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
+            aiFace& f = orig->mFaces[tt];
+            for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
+                ftbl_orig[f.mIndices[nn]] = tt;
+
+            aiFace& f2 = inst->mFaces[tt];
+            for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
+                ftbl_inst[f2.mIndices[nn]] = tt;
+        }
+        if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
+            return false;
+    }
+    return true;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -122,130 +368,57 @@ void FindInstancesProcess::Execute( aiScene* pScene)
         // in the pipeline, so we could, depending on the file format,
         // have several thousand small meshes. That's too much for a brute
         // everyone-against-everyone check involving up to 10 comparisons
-        // each.
-        std::unique_ptr<uint64_t[]> hashes (new uint64_t[pScene->mNumMeshes]);
+        // each, so the meshes we keep are bucketed by their hash and each
+        // mesh is only compared against its own bucket.
+        std::unordered_map<uint64_t, std::vector<unsigned int>> buckets;
         std::unique_ptr<unsigned int[]> remapping (new unsigned int[pScene->mNumMeshes]);
 
+        // transformation from the shared mesh to each rigid instance
+        std::map<unsigned int, aiMatrix4x4> transforms;
+        std::vector<ai_real> spreads(configRigidFlag ? pScene->mNumMeshes : 0);
+
         unsigned int numMeshesOut = 0;
         for (unsigned int i = 0; i < pScene->mNumMeshes; ++i) {
 
             aiMesh* inst = pScene->mMeshes[i];
-            hashes[i] = GetMeshHash(inst);
+            std::vector<unsigned int>& bucket = buckets[GetMeshHash(inst)];
 
             // Find an appropriate epsilon
             // to compare position differences against
             float epsilon = ComputePositionEpsilon(inst);
             epsilon *= epsilon;
 
-            for (int a = i-1; a >= 0; --a) {
-                if (hashes[i] == hashes[a])
-                {
-                    aiMesh* orig = pScene->mMeshes[a];
-                    if (!orig)
-                        continue;
-
-                    // check for hash collision .. we needn't check
-                    // the vertex format, it *must* match due to the
-                    // (brilliant) construction of the hash
-                    if (orig->mNumBones       != inst->mNumBones      ||
-                        orig->mNumFaces       != inst->mNumFaces      ||
-                        orig->mNumVertices    != inst->mNumVertices   ||
-                        orig->mMaterialIndex  != inst->mMaterialIndex ||
-                        orig->mPrimitiveTypes != inst->mPrimitiveTypes)
-                        continue;
-
-                    // up to now the meshes are equal. Now compare vertex positions, normals,
-                    // tangents and bitangents using this epsilon.
-                    if (orig->HasPositions()) {
-                        if(!CompareArrays(orig->mVertices,inst->mVertices,orig->mNumVertices,epsilon))
-                            continue;
-                    }
-                    if (orig->HasNormals()) {
-                        if(!CompareArrays(orig->mNormals,inst->mNormals,orig->mNumVertices,epsilon))
-                            continue;
-                    }
-                    if (orig->HasTangentsAndBitangents()) {
-                        if (!CompareArrays(orig->mTangents,inst->mTangents,orig->mNumVertices,epsilon) ||
-                            !CompareArrays(orig->mBitangents,inst->mBitangents,orig->mNumVertices,epsilon))
-                            continue;
-                    }
-
-                    // use a constant epsilon for colors and UV coordinates
-                    static const float uvEpsilon = 10e-4f;
-                    {
-                        unsigned int j, end = orig->GetNumUVChannels();
-                        for(j = 0; j < end; ++j) {
-                            if (!orig->mTextureCoords[j]) {
-                                continue;
-                            }
-                            if(!CompareArrays(orig->mTextureCoords[j],inst->mTextureCoords[j],orig->mNumVertices,uvEpsilon)) {
-                                break;
-                            }
-                        }
-                        if (j != end) {
-                            continue;
-                        }
-                    }
-                    {
-                        unsigned int j, end = orig->GetNumColorChannels();
-                        for(j = 0; j < end; ++j) {
-                            if (!orig->mColors[j]) {
-                                continue;
-                            }
-                            if(!CompareArrays(orig->mColors[j],inst->mColors[j],orig->mNumVertices,uvEpsilon)) {
-                                break;
-                            }
-                        }
-                        if (j != end) {
-                            continue;
-                        }
-                    }
-
-                    // These two checks are actually quite expensive and almost *never* required.
-                    // Almost. That's why they're still here. But there's no reason to do them
-                    // in speed-targeted imports.
-                    if (!configSpeedFlag) {
-
-                        // It seems to be strange, but we really need to check whether the
-                        // bones are identical too. Although it's extremely unprobable
-                        // that they're not if control reaches here, we need to deal
-                        // with unprobable cases, too. It could still be that there are
-                        // equal shapes which are deformed differently.
-                        if (!CompareBones(orig,inst))
-                            continue;
-
-                        // For completeness ... compare even the index buffers for equality
-                        // face order & winding order doesn't care. Input data is in verbose format.
-                        std::unique_ptr<unsigned int[]> ftbl_orig(new unsigned int[orig->mNumVertices]);
-                        std::unique_ptr<unsigned int[]> ftbl_inst(new unsigned int[orig->mNumVertices]);
-
-                        for (unsigned int tt = 0; tt < orig->mNumFaces;++tt) {
-                            aiFace& f = orig->mFaces[tt];
-                            for (unsigned int nn = 0; nn < f.mNumIndices;++nn)
-                                ftbl_orig[f.mIndices[nn]] = tt;
-
-                            aiFace& f2 = inst->mFaces[tt];
-                            for (unsigned int nn = 0; nn < f2.mNumIndices;++nn)
-                                ftbl_inst[f2.mIndices[nn]] = tt;
-                        }
-                        if (0 != ::memcmp(ftbl_inst.get(),ftbl_orig.get(),orig->mNumVertices*sizeof(unsigned int)))
-                            continue;
-                    }
-
-                    // We're still here. Or in other words: 'inst' is an instance of 'orig'.
-                    // Place a marker in our list that we can easily update mesh indices.
-                    remapping[i] = remapping[a];
-
-                    // Delete the instanced mesh, we don't need it anymore
-                    delete inst;
-                    pScene->mMeshes[i] = nullptr;
-                    break;
+            if (configRigidFlag) {
+                spreads[i] = GetSpread(inst);
+            }
+
+            // the most recent candidates first
+            for (auto it = bucket.rbegin(); it != bucket.rend(); ++it) {
+                const unsigned int a = *it;
+                bool rigid = false;
+                aiMatrix4x4 transform;
+                if (!IsInstance(pScene->mMeshes[a], inst, epsilon, configRigidFlag ? spreads[a] : 0,
+                            configRigidFlag ? spreads[i] : 0, rigid, transform)) {
+                    continue;
                 }
+
+                // We're still here. Or in other words: 'inst' is an instance of 'orig'.
+                // Place a marker in our list that we can easily update mesh indices.
+                remapping[i] = remapping[a];
+                if (rigid) {
+                    transforms[i] = transform;
+                }
+
+                // Delete the instanced mesh, we don't need it anymore
+                delete inst;
+                pScene->mMeshes[i] = nullptr;
+                break;
             }
 
             // If we didn't find a match for the current mesh: keep it
             if (pScene->mMeshes[i]) {
                 remapping[i] = numMeshesOut++;
+                bucket.push_back(i);
             }
         }
         ai_assert(0 != numMeshesOut);
@@ -258,11 +431,13 @@ void FindInstancesProcess::Execute( aiScene* pScene)
             }
 
             // And update the node graph with our nice lookup table
-            UpdateMeshIndices(pScene->mRootNode,remapping.get());
+            UpdateMeshIndices(pScene->mRootNode,remapping.get(),transforms);
 
             // write to log
             if (!DefaultLogger::isNullLogger()) {
-                ASSIMP_LOG_INFO( "FindInstancesProcess finished. Found ", (pScene->mNumMeshes - numMeshesOut), " instances" );
+                ASSIMP_LOG_INFO( "FindInstancesProcess finished. Found ", (pScene->mNumMeshes - numMeshesOut), " instances (",
+                        transforms.size(), " under rigid transformations), instancing ratio ",
+                        static_cast<float>(pScene->mNumMeshes) / numMeshesOut );
             }
             pScene->mNumMeshes = numMeshesOut;
         } else {
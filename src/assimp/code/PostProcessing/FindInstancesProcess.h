@@ -105,7 +105,7 @@ inline bool CompareArrays(const aiColor4D* first, const aiColor4D* second,
 // ---------------------------------------------------------------------------
 /** @brief A post-processing steps to search for instanced meshes
 */
-class FindInstancesProcess : public BaseProcess {
+class ASSIMP_API FindInstancesProcess : public BaseProcess {
 public:
     FindInstancesProcess();
     ~FindInstancesProcess() override = default;
@@ -122,8 +122,21 @@ public:
     // Setup properties prior to executing the process
     void SetupProperties(const Importer* pImp) override;
 
+    // -------------------------------------------------------------------
+    /// @brief Enables finding instances under rigid transformations, see
+    ///        #AI_CONFIG_PP_FI_RIGID_INSTANCES.
+    /// @param enabled true for enabled.
+    void EnableRigidInstances(bool enabled) { configRigidFlag = enabled; }
+
 private:
+    // -------------------------------------------------------------------
+    // Check whether inst is an instance of orig. rigid is set if it is
+    // one under the rigid transformation returned in transform.
+    bool IsInstance(const aiMesh* orig, const aiMesh* inst, float epsilon,
+            ai_real spreadOrig, ai_real spreadInst, bool& rigid, aiMatrix4x4& transform) const;
+
     bool configSpeedFlag;
+    bool configRigidFlag;
 }; // ! end class FindInstancesProcess
 
 }  // ! end namespace Assimp
@@ -73,6 +73,10 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsMeshLocal(). */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
     * The function is a request to the process to update its configuration
@@ -43,7 +43,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * <br>
  * The algorithm is roughly basing on this paper:
  * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
- *   .. although overdraw reduction isn't implemented yet ...
+ * Faces are reordered with Tipsify, then split into clusters which are sorted by a view
+ * independent occlusion estimate to reduce overdraw (section 5 of the paper). Finally the
+ * vertices are renumbered in the order the faces first use them.
  */
 
 // internal headers
@@ -54,15 +56,171 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
+#include <limits>
 #include <stdio.h>
 #include <stack>
+#include <vector>
 
 namespace Assimp {
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Simulates a FIFO post-transform vertex cache of a given size
+class FifoCache {
+public:
+    explicit FifoCache(unsigned int size) :
+            mEntries(size, std::numeric_limits<unsigned int>::max()), mCursor(0) {
+        // empty
+    }
+
+    void Clear() {
+        std::fill(mEntries.begin(), mEntries.end(), std::numeric_limits<unsigned int>::max());
+        mCursor = 0;
+    }
+
+    // Returns true if the vertex was in the cache, otherwise it is added
+    bool Access(unsigned int vertex) {
+        for (unsigned int entry : mEntries) {
+            if (entry == vertex) {
+                return true;
+            }
+        }
+        mEntries[mCursor] = vertex;
+        if (++mCursor == mEntries.size()) {
+            mCursor = 0;
+        }
+        return false;
+    }
+
+private:
+    std::vector<unsigned int> mEntries;
+    size_t mCursor;
+};
+
+// ------------------------------------------------------------------------------------------------
+unsigned int countCacheMisses(const aiMesh *pMesh, unsigned int configCacheDepth) {
+    FifoCache cache(configCacheDepth);
+    unsigned int iCacheMisses = 0;
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        const aiFace &face = pMesh->mFaces[a];
+        for (unsigned int qq = 0; qq < face.mNumIndices; ++qq) {
+            if (!cache.Access(face.mIndices[qq])) {
+                ++iCacheMisses;
+            }
+        }
+    }
+    return iCacheMisses;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int countReferencedVertices(const aiMesh *pMesh) {
+    std::vector<bool> used(pMesh->mNumVertices, false);
+    unsigned int count = 0;
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        const aiFace &face = pMesh->mFaces[a];
+        for (unsigned int qq = 0; qq < face.mNumIndices; ++qq) {
+            if (!used[face.mIndices[qq]]) {
+                used[face.mIndices[qq]] = true;
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Moves element i of the array to remap[i]
+template <typename T>
+void permuteStream(T *data, const std::vector<unsigned int> &remap) {
+    if (nullptr == data) {
+        return;
+    }
+    const std::vector<T> copy(data, data + remap.size());
+    for (size_t i = 0; i < remap.size(); ++i) {
+        data[remap[i]] = copy[i];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Renumbers the vertices of a mesh in the order they are first referenced by its faces.
+// Unreferenced vertices are kept behind all others. Returns false if the order did not change.
+bool optimizeVertexFetch(aiMesh *pMesh, std::vector<unsigned int> &remap) {
+    const unsigned int invalid = std::numeric_limits<unsigned int>::max();
+    remap.assign(pMesh->mNumVertices, invalid);
+    unsigned int next = 0;
+    bool changed = false;
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        const aiFace &face = pMesh->mFaces[a];
+        for (unsigned int qq = 0; qq < face.mNumIndices; ++qq) {
+            unsigned int &target = remap[face.mIndices[qq]];
+            if (invalid == target) {
+                changed = changed || next != face.mIndices[qq];
+                target = next++;
+            }
+        }
+    }
+    for (unsigned int i = 0; i < pMesh->mNumVertices; ++i) {
+        if (invalid == remap[i]) {
+            changed = changed || next != i;
+            remap[i] = next++;
+        }
+    }
+    if (!changed) {
+        return false;
+    }
+
+    for (unsigned int a = 0; a < pMesh->mNumFaces; ++a) {
+        aiFace &face = pMesh->mFaces[a];
+        for (unsigned int qq = 0; qq < face.mNumIndices; ++qq) {
+            face.mIndices[qq] = remap[face.mIndices[qq]];
+        }
+    }
+
+    permuteStream(pMesh->mVertices, remap);
+    permuteStream(pMesh->mNormals, remap);
+    permuteStream(pMesh->mTangents, remap);
+    permuteStream(pMesh->mBitangents, remap);
+    for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        permuteStream(pMesh->mColors[c], remap);
+    }
+    for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+        permuteStream(pMesh->mTextureCoords[c], remap);
+    }
+    for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; ++a) {
+        aiAnimMesh *anim = pMesh->mAnimMeshes[a];
+        if (anim->mNumVertices != pMesh->mNumVertices) {
+            continue;
+        }
+        permuteStream(anim->mVertices, remap);
+        permuteStream(anim->mNormals, remap);
+        permuteStream(anim->mTangents, remap);
+        permuteStream(anim->mBitangents, remap);
+        for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+            permuteStream(anim->mColors[c], remap);
+        }
+        for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+            permuteStream(anim->mTextureCoords[c], remap);
+        }
+    }
+    for (unsigned int a = 0; a < pMesh->mNumBones; ++a) {
+        aiBone *bone = pMesh->mBones[a];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            bone->mWeights[w].mVertexId = remap[bone->mWeights[w].mVertexId];
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 ImproveCacheLocalityProcess::ImproveCacheLocalityProcess() :
-        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE) {
+        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE),
+        mConfigOverdrawThreshold(PP_ICL_OVERDRAW_THRESHOLD),
+        mConfigOptimizeFetch(true) {
     // empty
 }
 
@@ -72,11 +230,18 @@ bool ImproveCacheLocalityProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_ImproveCacheLocality) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool ImproveCacheLocalityProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Setup configuration
 void ImproveCacheLocalityProcess::SetupProperties(const Importer *pImp) {
     // AI_CONFIG_PP_ICL_PTCACHE_SIZE controls the target cache size for the optimizer
     mConfigCacheDepth = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, PP_ICL_PTCACHE_SIZE);
+    mConfigOverdrawThreshold = pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, PP_ICL_OVERDRAW_THRESHOLD);
+    mConfigOptimizeFetch = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_FETCH, true);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -89,105 +254,99 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
 
-    float out = 0.f;
-    unsigned int numf = 0, numm = 0;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        const float res = ProcessMesh(pScene->mMeshes[a], a);
-        if (res) {
-            numf += pScene->mMeshes[a]->mNumFaces;
-            out += res;
-            ++numm;
-        }
-    }
-    if (!DefaultLogger::isNullLogger()) {
-        if (numf > 0) {
-            ASSIMP_LOG_INFO("Cache relevant are ", numm, " meshes (", numf, " faces). Average output ACMR is ", out / numf);
-        }
-        ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess finished. ");
-    }
-}
-
-// ------------------------------------------------------------------------------------------------
-static ai_real calculateInputACMR(aiMesh *pMesh, const aiFace *const pcEnd,
-        unsigned int configCacheDepth, unsigned int meshNum) {
-    ai_real fACMR = 0.0f;
-    unsigned int *piFIFOStack = new unsigned int[configCacheDepth];
-    memset(piFIFOStack, 0xff, configCacheDepth * sizeof(unsigned int));
-    unsigned int *piCur = piFIFOStack;
-    const unsigned int *const piCurEnd = piFIFOStack + configCacheDepth;
-
-    // count the number of cache misses
-    unsigned int iCacheMisses = 0;
-    for (const aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
-        for (unsigned int qq = 0; qq < 3; ++qq) {
-            bool bInCache = false;
-            for (unsigned int *pp = piFIFOStack; pp < piCurEnd; ++pp) {
-                if (*pp == pcFace->mIndices[qq]) {
-                    // the vertex is in cache
-                    bInCache = true;
-                    break;
-                }
-            }
-            if (!bInCache) {
-                ++iCacheMisses;
-                if (piCurEnd == piCur) {
-                    piCur = piFIFOStack;
+    // skeleton bones reference vertices as well, so keep the new vertex order of each mesh for them
+    const bool keepRemap = mConfigOptimizeFetch && pScene->HasSkeletons();
+    std::vector<std::vector<unsigned int>> remaps(keepRemap ? pScene->mNumMeshes : 0);
+
+    // per-mesh results are summed in mesh order afterwards, so the statistics don't depend on threading
+    std::vector<MeshStatistics> results(pScene->mNumMeshes);
+    std::vector<char> processed(pScene->mNumMeshes, 0);
+    ForEachMesh(pScene, [&](unsigned int a) {
+        processed[a] = ProcessMesh(pScene->mMeshes[a], a, results[a], keepRemap ? &remaps[a] : nullptr);
+    });
+
+    if (keepRemap) {
+        for (unsigned int s = 0; s < pScene->mNumSkeletons; ++s) {
+            const aiSkeleton *skeleton = pScene->mSkeletons[s];
+            for (unsigned int b = 0; b < skeleton->mNumBones; ++b) {
+                aiSkeletonBone *bone = skeleton->mBones[b];
+                for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+                    if (bone->mMeshId != pScene->mMeshes[a] || remaps[a].empty()) {
+                        continue;
+                    }
+                    for (unsigned int w = 0; w < bone->mNumnWeights; ++w) {
+                        bone->mWeights[w].mVertexId = remaps[a][bone->mWeights[w].mVertexId];
+                    }
                 }
-                *piCur++ = pcFace->mIndices[qq];
             }
         }
     }
-    delete[] piFIFOStack;
-    fACMR = (ai_real)iCacheMisses / pMesh->mNumFaces;
-    if (3.0 == fACMR) {
-        char szBuff[128]; // should be sufficiently large in every case
 
-        // the JoinIdenticalVertices process has not been executed on this
-        // mesh, otherwise this value would normally be at least minimally
-        // smaller than 3.0 ...
-        ai_snprintf(szBuff, 128, "Mesh %u: Not suitable for vcache optimization", meshNum);
-        ASSIMP_LOG_WARN(szBuff);
-        return static_cast<ai_real>(0.f);
+    if (!DefaultLogger::isNullLogger()) {
+        MeshStatistics total;
+        unsigned int numm = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            if (processed[a] && results[a].mNumFaces) {
+                total.mNumFaces += results[a].mNumFaces;
+                total.mNumReferencedVertices += results[a].mNumReferencedVertices;
+                total.mCacheMissesIn += results[a].mCacheMissesIn;
+                total.mCacheMissesOut += results[a].mCacheMissesOut;
+                ++numm;
+            }
+        }
+        if (total.mNumFaces > 0) {
+            const float faces = static_cast<float>(total.mNumFaces);
+            const float vertices = static_cast<float>(total.mNumReferencedVertices);
+            ASSIMP_LOG_INFO("Cache relevant are ", numm, " meshes (", total.mNumFaces, " faces). Average ACMR in: ",
+                    total.mCacheMissesIn / faces, " out: ", total.mCacheMissesOut / faces,
+                    ", ATVR in: ", total.mCacheMissesIn / vertices, " out: ", total.mCacheMissesOut / vertices);
+        }
+        ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess finished. ");
     }
-    return fACMR;
 }
 
 // ------------------------------------------------------------------------------------------------
 // Improves the cache coherency of a specific mesh
-ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshNum) {
-    // TODO: rewrite this to use std::vector or boost::shared_array
+bool ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshNum, MeshStatistics &stats,
+        std::vector<unsigned int> *vertexRemap) {
     ai_assert(nullptr != pMesh);
 
     // Check whether the input data is valid
     // - there must be vertices and faces
     // - all faces must be triangulated or we can't operate on them
     if (!pMesh->HasFaces() || !pMesh->HasPositions())
-        return static_cast<ai_real>(0.f);
+        return false;
 
     if (pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
         ASSIMP_LOG_ERROR("This algorithm works on triangle meshes only");
-        return static_cast<ai_real>(0.f);
+        return false;
     }
 
     if (pMesh->mNumVertices <= mConfigCacheDepth) {
-        return static_cast<ai_real>(0.f);
+        return false;
     }
 
-    ai_real fACMR = 3.f;
     const aiFace *const pcEnd = pMesh->mFaces + pMesh->mNumFaces;
 
-    // Input ACMR is for logging purposes only
-    if (!DefaultLogger::isNullLogger()) {
-        fACMR = calculateInputACMR(pMesh, pcEnd, mConfigCacheDepth, meshNum);
+    // Input statistics are for logging purposes only
+    const bool gatherStats = !DefaultLogger::isNullLogger();
+    if (gatherStats) {
+        stats.mNumFaces = pMesh->mNumFaces;
+        stats.mNumReferencedVertices = countReferencedVertices(pMesh);
+        stats.mCacheMissesIn = countCacheMisses(pMesh, mConfigCacheDepth);
+        if (stats.mCacheMissesIn == 3 * pMesh->mNumFaces) {
+            // the JoinIdenticalVertices process has not been executed on this
+            // mesh, otherwise this value would normally be at least minimally
+            // smaller than 3.0 ...
+            ASSIMP_LOG_WARN("Mesh ", meshNum, ": Not suitable for vcache optimization");
+        }
     }
 
     // first we need to build a vertex-triangle adjacency list
     VertexTriangleAdjacency adj(pMesh->mFaces, pMesh->mNumFaces, pMesh->mNumVertices, true);
 
     // build a list to store per-vertex caching time stamps
-    std::vector<unsigned int> piCachingStamps;
-    piCachingStamps.resize(pMesh->mNumVertices);
-    memset(&piCachingStamps[0], 0x0, pMesh->mNumVertices * sizeof(unsigned int));
+    std::vector<unsigned int> piCachingStamps(pMesh->mNumVertices, 0u);
 
     // allocate an empty output index buffer. We store the output indices in one large array.
     // Since the number of triangles won't change the input faces can be reused. This is how
@@ -197,6 +356,9 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     piIBOutput.resize(iIdxCnt);
     std::vector<unsigned int>::iterator piCSIter = piIBOutput.begin();
 
+    // face offsets in the output where the fanning sequence had to restart
+    std::vector<unsigned int> hardBoundaries(1, 0u);
+
     // allocate the flag array to hold the information
     // whether a face has already been emitted or not
     std::vector<bool> abEmitted(pMesh->mNumFaces, false);
@@ -220,7 +382,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     ai_assert(iMaxRefTris > 0);
     std::vector<unsigned int> piCandidates;
     piCandidates.resize(iMaxRefTris * 3);
-    unsigned int iCacheMisses = 0;
 
     // ...................................................................................
     /** PSEUDOCODE for the algorithm
@@ -292,7 +453,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
                     // if the vertex is not yet in cache, set its cache count
                     if (iStampCnt - piCachingStamps[dp] > mConfigCacheDepth) {
                         piCachingStamps[dp] = iStampCnt++;
-                        ++iCacheMisses;
                     }
                 }
                 // flag triangle as emitted
@@ -328,6 +488,13 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
         }
         // did we reach a dead end?
         if (-1 == ivdx) {
+            // the fanning sequence restarts here, which is a natural cluster boundary
+            // for the overdraw reduction
+            const unsigned int iEmitted = static_cast<unsigned int>((piCSIter - piIBOutput.begin()) / 3);
+            if (hardBoundaries.back() != iEmitted) {
+                hardBoundaries.push_back(iEmitted);
+            }
+
             // need to get a non-local vertex for which we have a good chance that it is still
             // in the cache ...
             while (!sDeadEndVStack.empty()) {
@@ -342,8 +509,7 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
             if (-1 == ivdx) {
                 // well, there isn't such a vertex. Simply get the next vertex in input order and
                 // hope it is not too bad ...
-                while (ics < (int)pMesh->mNumVertices) {
-                    ++ics;
+                for (; ics < (int)pMesh->mNumVertices; ++ics) {
                     if (piNumTriPtr[ics] > 0) {
                         ivdx = ics;
                         break;
@@ -352,15 +518,9 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
             }
         }
     }
-    ai_real fACMR2 = 0.0f;
-    if (!DefaultLogger::isNullLogger()) {
-        fACMR2 = static_cast<ai_real>(iCacheMisses / pMesh->mNumFaces);
-        const ai_real averageACMR = ((fACMR - fACMR2) / fACMR) * 100.f;
-        // very intense verbose logging ... prepare for much text if there are many meshes
-        if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
-            ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, "| ACMR in: ", fACMR, " out: ", fACMR2, " | average ACMR ", averageACMR);
-        }
-        fACMR2 *= pMesh->mNumFaces;
+
+    if (mConfigOverdrawThreshold > 0.f && hardBoundaries.size() > 1) {
+        ReduceOverdraw(pMesh, piIBOutput, hardBoundaries);
     }
 
     // sort the output index buffer back to the input array
@@ -376,8 +536,116 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
             ind[2] = *piCSIter++;
     }
 
-    return fACMR2;
+    if (mConfigOptimizeFetch) {
+        std::vector<unsigned int> remap;
+        if (optimizeVertexFetch(pMesh, remap) && nullptr != vertexRemap) {
+            vertexRemap->swap(remap);
+        }
+    }
+
+    if (gatherStats) {
+        stats.mCacheMissesOut = countCacheMisses(pMesh, mConfigCacheDepth);
+
+        // very intense verbose logging ... prepare for much text if there are many meshes
+        if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
+            const ai_real faces = static_cast<ai_real>(stats.mNumFaces);
+            const ai_real vertices = static_cast<ai_real>(stats.mNumReferencedVertices);
+            ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, "| ACMR in: ", stats.mCacheMissesIn / faces,
+                    " out: ", stats.mCacheMissesOut / faces, " | ATVR in: ", stats.mCacheMissesIn / vertices,
+                    " out: ", stats.mCacheMissesOut / vertices);
+        }
+    }
+    return true;
 }
 
-} // namespace Assimp
+// ------------------------------------------------------------------------------------------------
+// Splits the Tipsify output into clusters and sorts them by their occlusion potential
+void ImproveCacheLocalityProcess::ReduceOverdraw(const aiMesh *pMesh, std::vector<unsigned int> &indices,
+        const std::vector<unsigned int> &hardBoundaries) const {
+    const unsigned int numFaces = static_cast<unsigned int>(indices.size() / 3);
 
+    // the ACMR Tipsify achieved is the reference for splitting the clusters further
+    FifoCache cache(mConfigCacheDepth);
+    unsigned int iCacheMisses = 0;
+    for (unsigned int idx : indices) {
+        if (!cache.Access(idx)) {
+            ++iCacheMisses;
+        }
+    }
+    const float limit = mConfigOverdrawThreshold * iCacheMisses / numFaces;
+
+    // Within a hard cluster, simulate the cache starting empty and close a cluster as soon as
+    // its own ACMR is low enough that flushing the cache here is affordable
+    std::vector<unsigned int> clusters;
+    for (size_t h = 0; h < hardBoundaries.size(); ++h) {
+        const unsigned int end = (h + 1 < hardBoundaries.size()) ? hardBoundaries[h + 1] : numFaces;
+        unsigned int start = hardBoundaries[h];
+        clusters.push_back(start);
+        cache.Clear();
+        unsigned int misses = 0;
+        for (unsigned int f = start; f < end; ++f) {
+            for (unsigned int qq = 0; qq < 3; ++qq) {
+                if (!cache.Access(indices[f * 3 + qq])) {
+                    ++misses;
+                }
+            }
+            if (f + 1 < end && misses < limit * (f + 1 - start)) {
+                start = f + 1;
+                clusters.push_back(start);
+                cache.Clear();
+                misses = 0;
+            }
+        }
+    }
+    if (clusters.size() < 2) {
+        return;
+    }
+    clusters.push_back(numFaces);
+
+    // Area weighted centroid and normal of each cluster, and the centroid of the whole mesh
+    const size_t numClusters = clusters.size() - 1;
+    std::vector<aiVector3D> centroids(numClusters), normals(numClusters);
+    aiVector3D meshCentroid;
+    ai_real meshArea = 0.0;
+    for (size_t c = 0; c < numClusters; ++c) {
+        aiVector3D centroid, normal;
+        ai_real area = 0.0;
+        for (unsigned int f = clusters[c]; f < clusters[c + 1]; ++f) {
+            const aiVector3D &p0 = pMesh->mVertices[indices[f * 3]];
+            const aiVector3D &p1 = pMesh->mVertices[indices[f * 3 + 1]];
+            const aiVector3D &p2 = pMesh->mVertices[indices[f * 3 + 2]];
+            const aiVector3D n = (p1 - p0) ^ (p2 - p0);
+            const ai_real a = n.Length();
+            centroid += (p0 + p1 + p2) * (a / static_cast<ai_real>(3.0));
+            normal += n;
+            area += a;
+        }
+        meshCentroid += centroid;
+        meshArea += area;
+        centroids[c] = area > 0.0 ? centroid / area : centroid;
+        normals[c] = normal.NormalizeSafe();
+    }
+    if (meshArea > 0.0) {
+        meshCentroid /= meshArea;
+    }
+
+    // Clusters facing away from the center are likely to occlude others, so they come first
+    std::vector<ai_real> score(numClusters);
+    std::vector<unsigned int> order(numClusters);
+    for (size_t c = 0; c < numClusters; ++c) {
+        score[c] = (centroids[c] - meshCentroid) * normals[c];
+        order[c] = static_cast<unsigned int>(c);
+    }
+    std::stable_sort(order.begin(), order.end(), [&score](unsigned int a, unsigned int b) {
+        return score[a] > score[b];
+    });
+
+    std::vector<unsigned int> sorted;
+    sorted.reserve(indices.size());
+    for (unsigned int c : order) {
+        sorted.insert(sorted.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+    }
+    indices.swap(sorted);
+}
+
+} // namespace Assimp
@@ -48,6 +48,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/types.h>
 
+#include <vector>
+
 struct aiMesh;
 
 namespace Assimp {
@@ -55,11 +57,14 @@ namespace Assimp {
 // ---------------------------------------------------------------------------
 /** The ImproveCacheLocalityProcess reorders all faces for improved vertex
  *  cache locality. It tries to arrange all faces to fans and to render
- *  faces which share vertices directly one after the other.
+ *  faces which share vertices directly one after the other (Tipsify).
+ *  The result is then split into clusters which are sorted to reduce
+ *  overdraw, and the vertices are renumbered in the order of their first
+ *  use to improve vertex fetch locality.
  *
  *  @note This step expects triagulated input data.
  */
-class ImproveCacheLocalityProcess : public BaseProcess {
+class ASSIMP_API ImproveCacheLocalityProcess : public BaseProcess {
 public:
     // -------------------------------------------------------------------
     /// The default class constructor / destructor.
@@ -70,6 +75,10 @@ public:
     // Check whether the pp step is active
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsMeshLocal(). */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     // Executes the pp step on a given scene
     void Execute( aiScene* pScene) override;
@@ -78,20 +87,72 @@ public:
     // Configures the pp step
     void SetupProperties(const Importer* pImp) override;
 
+    // -------------------------------------------------------------------
+    /// @brief Sets the ACMR threshold for the overdraw clusters, see
+    ///        #AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD.
+    /// @param threshold The threshold, 0 disables overdraw reduction.
+    void SetOverdrawThreshold(float threshold);
+
+    // -------------------------------------------------------------------
+    /// @brief Enables renumbering the vertices in first use order, see
+    ///        #AI_CONFIG_PP_ICL_OPTIMIZE_FETCH.
+    /// @param enabled true for enabled.
+    void EnableFetchOptimization(bool enabled);
+
 protected:
+    // -------------------------------------------------------------------
+    /** Cache statistics of a single mesh. They are only gathered if
+     *  logging is enabled. */
+    struct MeshStatistics {
+        unsigned int mNumFaces = 0;
+        unsigned int mNumReferencedVertices = 0;
+        unsigned int mCacheMissesIn = 0;
+        unsigned int mCacheMissesOut = 0;
+    };
+
     // -------------------------------------------------------------------
     /** Executes the postprocessing step on the given mesh
      * @param pMesh The mesh to process.
      * @param meshNum Index of the mesh to process
+     * @param stats Receives the cache statistics of the mesh
+     * @param vertexRemap If not nullptr, receives the new index of each
+     *   vertex if the vertices have been renumbered
+     * @return false if the mesh was not processed
+     */
+    bool ProcessMesh( aiMesh* pMesh, unsigned int meshNum, MeshStatistics &stats,
+            std::vector<unsigned int> *vertexRemap);
+
+    // -------------------------------------------------------------------
+    /** Splits the face order created by Tipsify into clusters and sorts
+     *  them to reduce overdraw.
+     * @param pMesh The mesh the indices belong to.
+     * @param indices Output of Tipsify, three indices per face.
+     * @param hardBoundaries Face offsets where Tipsify had to restart.
      */
-    ai_real ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
+    void ReduceOverdraw(const aiMesh *pMesh, std::vector<unsigned int> &indices,
+            const std::vector<unsigned int> &hardBoundaries) const;
 
 private:
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int mConfigCacheDepth;
+
+    //! Configuration parameter: ACMR threshold for the overdraw
+    //! clusters, 0 disables overdraw reduction.
+    float mConfigOverdrawThreshold;
+
+    //! Configuration parameter: renumber the vertices in first use order.
+    bool mConfigOptimizeFetch;
 };
 
+inline void ImproveCacheLocalityProcess::SetOverdrawThreshold(float threshold) {
+    mConfigOverdrawThreshold = threshold;
+}
+
+inline void ImproveCacheLocalityProcess::EnableFetchOptimization(bool enabled) {
+    mConfigOptimizeFetch = enabled;
+}
+
 } // end of namespace Assimp
 
 #endif // AI_IMPROVECACHELOCALITY_H_INC
@@ -51,6 +51,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/TinyFormatter.h>
 
 #include <stdio.h>
+#include <atomic>
+#include <cstring>
 #include <unordered_set>
 #include <unordered_map>
 #include <memory>
@@ -63,6 +65,18 @@ using namespace Assimp;
 bool JoinVerticesProcess::IsActive( unsigned int pFlags) const {
     return (pFlags & aiProcess_JoinIdenticalVertices) != 0;
 }
+
+// ------------------------------------------------------------------------------------------------
+bool JoinVerticesProcess::IsMeshLocal() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::SetupProperties(const Importer *pImp) {
+    // Get the current value of AI_CONFIG_PP_JIV_EXACT_HASH
+    mConfigExactHash = (0 != pImp->GetPropertyInteger(AI_CONFIG_PP_JIV_EXACT_HASH, 0));
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void JoinVerticesProcess::Execute( aiScene* pScene) {
@@ -77,10 +91,10 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
     }
 
     // execute the step
-    int iNumVertices = 0;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+    std::atomic<int> iNumVertices(0);
+    ForEachMesh(pScene, [&](unsigned int a) {
         iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
-    }
+    });
 
     pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
 
@@ -93,7 +107,7 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
 
         // Show statistics
         ASSIMP_LOG_INFO("JoinVerticesProcess finished | Verts in: ", iNumOldVertices,
-            " out: ", iNumVertices, " | ~",
+            " out: ", iNumVertices.load(), " | ~",
             ((iNumOldVertices - iNumVertices) / (float)iNumOldVertices) * 100.f );
     }
 }
@@ -156,6 +170,162 @@ void updateXMeshVertices(XMesh *pMesh, std::vector<int> &uniqueVertices) {
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Collects the per-vertex arrays of a mesh (or anim mesh) that make up the hashed vertex key
+template<class XMesh>
+void appendKeyStreams(const XMesh *pMesh, std::vector<std::pair<const ai_real *, unsigned int>> &streams) {
+    if (pMesh->mVertices) {
+        streams.emplace_back(&pMesh->mVertices[0].x, 3u);
+    }
+    if (pMesh->mNormals) {
+        streams.emplace_back(&pMesh->mNormals[0].x, 3u);
+    }
+    if (pMesh->mTangents) {
+        streams.emplace_back(&pMesh->mTangents[0].x, 3u);
+    }
+    if (pMesh->mBitangents) {
+        streams.emplace_back(&pMesh->mBitangents[0].x, 3u);
+    }
+    for (unsigned int a = 0; pMesh->HasTextureCoords(a); a++) {
+        streams.emplace_back(&pMesh->mTextureCoords[a][0].x, 3u);
+    }
+    for (unsigned int a = 0; pMesh->HasVertexColors(a); a++) {
+        streams.emplace_back(&pMesh->mColors[a][0].r, 4u);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+inline uint64_t hashBytes(uint64_t hash, const void *data, size_t size) {
+    // FNV-1a, 64 bit
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Finds bit-identical vertices with an open-addressing hash table over the complete vertex:
+// all attribute arrays of the mesh and its anim meshes plus the bone weights. Fills the same
+// outputs as the ordered-map search in ProcessMesh(), in the same order.
+void findUniqueVerticesHashed(const aiMesh *pMesh, const std::vector<bool> &usedVertexIndicesMask,
+        std::vector<int> &uniqueVertices, std::vector<unsigned int> &replaceIndex, unsigned int joinedMark) {
+    const unsigned int numVertices = pMesh->mNumVertices;
+
+    std::vector<std::pair<const ai_real *, unsigned int>> streams;
+    appendKeyStreams(pMesh, streams);
+    for (unsigned int a = 0; a < pMesh->mNumAnimMeshes; a++) {
+        if (pMesh->mAnimMeshes[a]->mNumVertices == numVertices) {
+            appendKeyStreams(pMesh->mAnimMeshes[a], streams);
+        }
+    }
+    size_t keySize = 0;
+    for (const auto &stream : streams) {
+        keySize += stream.second;
+    }
+
+    // Interleave the keys, so each comparison is a single memcmp. 0 and -0 compare equal as
+    // floats and must hash the same.
+    std::vector<ai_real> keys(numVertices * keySize);
+    for (unsigned int v = 0; v < numVertices; v++) {
+        ai_real *key = &keys[v * keySize];
+        for (const auto &stream : streams) {
+            const ai_real *src = stream.first + static_cast<size_t>(v) * stream.second;
+            for (unsigned int c = 0; c < stream.second; c++) {
+                *key++ = src[c] == ai_real(0) ? ai_real(0) : src[c];
+            }
+        }
+    }
+
+    // Bone weights per vertex, ordered by bone since the bones are visited in order
+    std::vector<unsigned int> weightOffsets;
+    std::vector<std::pair<unsigned int, ai_real>> weights;
+    if (pMesh->mNumBones > 0) {
+        weightOffsets.assign(numVertices + 1, 0);
+        for (unsigned int b = 0; b < pMesh->mNumBones; b++) {
+            const aiBone *bone = pMesh->mBones[b];
+            for (unsigned int w = 0; bone->mWeights && w < bone->mNumWeights; w++) {
+                if (bone->mWeights[w].mVertexId < numVertices) {
+                    ++weightOffsets[bone->mWeights[w].mVertexId + 1];
+                }
+            }
+        }
+        for (unsigned int v = 0; v < numVertices; v++) {
+            weightOffsets[v + 1] += weightOffsets[v];
+        }
+        weights.resize(weightOffsets[numVertices]);
+        std::vector<unsigned int> fill(weightOffsets.begin(), weightOffsets.end() - 1);
+        for (unsigned int b = 0; b < pMesh->mNumBones; b++) {
+            const aiBone *bone = pMesh->mBones[b];
+            for (unsigned int w = 0; bone->mWeights && w < bone->mNumWeights; w++) {
+                const aiVertexWeight &weight = bone->mWeights[w];
+                if (weight.mVertexId < numVertices) {
+                    weights[fill[weight.mVertexId]++] = std::make_pair(b, weight.mWeight == ai_real(0) ? ai_real(0) : weight.mWeight);
+                }
+            }
+        }
+    }
+
+    auto hashVertex = [&](unsigned int v) {
+        uint64_t hash = hashBytes(0xcbf29ce484222325ull, &keys[v * keySize], keySize * sizeof(ai_real));
+        if (!weightOffsets.empty()) {
+            for (unsigned int w = weightOffsets[v]; w < weightOffsets[v + 1]; w++) {
+                hash = hashBytes(hash, &weights[w].first, sizeof(unsigned int));
+                hash = hashBytes(hash, &weights[w].second, sizeof(ai_real));
+            }
+        }
+        return hash;
+    };
+    auto sameVertex = [&](unsigned int a, unsigned int b) {
+        if (0 != memcmp(&keys[a * keySize], &keys[b * keySize], keySize * sizeof(ai_real))) {
+            return false;
+        }
+        if (weightOffsets.empty()) {
+            return true;
+        }
+        const unsigned int count = weightOffsets[a + 1] - weightOffsets[a];
+        if (count != weightOffsets[b + 1] - weightOffsets[b]) {
+            return false;
+        }
+        for (unsigned int w = 0; w < count; w++) {
+            const auto &wa = weights[weightOffsets[a] + w], &wb = weights[weightOffsets[b] + w];
+            if (wa.first != wb.first || 0 != memcmp(&wa.second, &wb.second, sizeof(ai_real))) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Linear probing in a power-of-two table at most half full. A slot holds the hash and the
+    // first vertex seen with that key.
+    size_t tableSize = 16;
+    while (tableSize < 2 * static_cast<size_t>(numVertices)) {
+        tableSize *= 2;
+    }
+    const size_t mask = tableSize - 1;
+    static constexpr unsigned int EMPTY_SLOT = 0xffffffffu;
+    std::vector<std::pair<uint64_t, unsigned int>> table(tableSize, std::make_pair(uint64_t(0), EMPTY_SLOT));
+
+    int newIndex = 0;
+    for (unsigned int a = 0; a < numVertices; a++) {
+        if (!usedVertexIndicesMask[a]) {
+            continue;
+        }
+        const uint64_t hash = hashVertex(a);
+        size_t slot = static_cast<size_t>(hash ^ (hash >> 32)) & mask;
+        while (table[slot].second != EMPTY_SLOT && (table[slot].first != hash || !sameVertex(table[slot].second, a))) {
+            slot = (slot + 1) & mask;
+        }
+        if (table[slot].second == EMPTY_SLOT) {
+            table[slot] = std::make_pair(hash, a);
+            replaceIndex[a] = newIndex++;
+            uniqueVertices.push_back(a);
+        } else {
+            replaceIndex[a] = replaceIndex[table[slot].second] | joinedMark;
+        }
+    }
+}
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -207,12 +377,19 @@ int JoinVerticesProcess::ProcessMesh( aiMesh* pMesh, unsigned int meshIndex) {
             uniqueAnimatedVertices[animMeshIndex].reserve(pMesh->mNumVertices);
         }
     }
+    if (mConfigExactHash) {
+        findUniqueVerticesHashed(pMesh, usedVertexIndicesMask, uniqueVertices, replaceIndex, JOINED_VERTICES_MARK);
+        for (unsigned int animMeshIndex = 0; animMeshIndex < pMesh->mNumAnimMeshes; animMeshIndex++) {
+            uniqueAnimatedVertices[animMeshIndex] = uniqueVertices;
+        }
+    }
+
     // a map that maps a vertex to its new index
     std::map<Vertex, int> vertex2Index = {};
     // we can not end up with more vertices than we started with
     // Now check each vertex if it brings something new to the table
     int newIndex = 0;
-    for( unsigned int a = 0; a < pMesh->mNumVertices; a++)  {
+    for( unsigned int a = 0; !mConfigExactHash && a < pMesh->mNumVertices; a++)  {
         // if the vertex is unused Do nothing
         if (!usedVertexIndicesMask[a]) {
             continue;
@@ -67,6 +67,13 @@ public:
     JoinVerticesProcess() = default;
     ~JoinVerticesProcess() override = default;
 
+    // -------------------------------------------------------------------
+    /** Called prior to ExecuteOnScene().
+     * The function is a request to the process to update its configuration
+     * basing on the Importer's configuration property list.
+     */
+    void SetupProperties(const Importer *pImp) override;
+
     // -------------------------------------------------------------------
     /** Returns whether the processing step is present in the given flag field.
      * @param pFlags The processing flags the importer was called with. A bitwise
@@ -75,6 +82,10 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsMeshLocal(). */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     /** Executes the post processing step on the given imported data.
     * At the moment a process is not supposed to fail.
@@ -88,8 +99,31 @@ public:
      * @param meshIndex Index of the mesh to process
      */
     int ProcessMesh( aiMesh* pMesh, unsigned int meshIndex);
+
+    // -------------------------------------------------------------------
+    /// @brief Enables the hashed comparison of complete vertices, see
+    ///        #AI_CONFIG_PP_JIV_EXACT_HASH.
+    /// @param enabled true for enabled.
+    void EnableExactHash(bool enabled);
+
+    // -------------------------------------------------------------------
+    /// @brief Check whether the hashed comparison is enabled.
+    /// @return The hash state.
+    bool IsExactHash() const;
+
+private:
+    //! Configuration option: find duplicates by hashing the complete vertex
+    bool mConfigExactHash = false;
 };
 
+inline void JoinVerticesProcess::EnableExactHash(bool enabled) {
+    mConfigExactHash = enabled;
+}
+
+inline bool JoinVerticesProcess::IsExactHash() const {
+    return mConfigExactHash;
+}
+
 } // end of namespace Assimp
 
 #endif // AI_CALCTANGENTSPROCESS_H_INC
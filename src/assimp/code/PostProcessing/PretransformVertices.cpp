@@ -225,6 +225,9 @@ void PretransformVertices::CollectData(const aiScene *pcScene, const aiNode *pcN
 			// now we need to copy all faces. since we will delete the source mesh afterwards,
 			// we don't need to reallocate the array of indices except if this mesh is
 			// referenced multiple times.
+			if (!num_ref) {
+				pcMeshOut->ShareFaceIndices(*pcMesh);
+			}
 			for (unsigned int planck = 0; planck < pcMesh->mNumFaces; ++planck) {
 				aiFace &f_src = pcMesh->mFaces[planck];
 				aiFace &f_dst = pcMeshOut->mFaces[aiCurrent[AI_PTVS_FACE] + planck];
@@ -217,6 +217,9 @@ void SortByPTypeProcess::Execute(aiScene *pScene) {
             out->mNumFaces = aiNumPerPType[real];
             aiFace *outFaces = out->mFaces = new aiFace[out->mNumFaces];
 
+            // the index arrays are moved over below, keep pooled ones alive
+            out->ShareFaceIndices(*mesh);
+
             out->mNumVertices = (3 == real ? numPolyVerts : out->mNumFaces * (real + 1));
 
             aiVector3D *vert(nullptr), *nor(nullptr), *tan(nullptr), *bit(nullptr);
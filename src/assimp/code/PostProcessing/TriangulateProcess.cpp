@@ -64,6 +64,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/PolyTools.h"
 #include "contrib/earcut-hpp/earcut.hpp"
 
+#include <atomic>
 #include <memory>
 #include <cstdint>
 
@@ -180,20 +181,24 @@ bool TriangulateProcess::IsActive( unsigned int pFlags) const {
     return (pFlags & aiProcess_Triangulate) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+bool TriangulateProcess::IsMeshLocal() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void TriangulateProcess::Execute( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("TriangulateProcess begin");
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-    {
+    std::atomic<bool> bHas(false);
+    ForEachMesh(pScene, [&](unsigned int a) {
         if (pScene->mMeshes[ a ]) {
             if ( TriangulateMesh( pScene->mMeshes[ a ] ) ) {
                 bHas = true;
             }
         }
-    }
+    });
     if ( bHas ) {
         ASSIMP_LOG_INFO( "TriangulateProcess finished. All polygons have been triangulated." );
     } else {
@@ -487,8 +492,7 @@ bool TriangulateProcess::TriangulateMesh( aiMesh* pMesh) {
             ++f;
         }
 
-        delete[] face.mIndices;
-        face.mIndices = nullptr;
+        pMesh->ReleaseFaceIndices(face);
     }
 
 #ifdef AI_BUILD_TRIANGULATE_DEBUG_POLYS
@@ -73,6 +73,10 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsMeshLocal(). */
+    bool IsMeshLocal() const override;
+
     // -------------------------------------------------------------------
     /** Executes the post processing step on the given imported data.
     * At the moment a process is not supposed to fail.
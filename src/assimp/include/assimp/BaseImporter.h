@@ -69,6 +69,10 @@ class IOSystem;
 class BaseProcess;
 class SharedPostProcessInfo;
 class IOStream;
+class ThreadPool;
+namespace Profiling {
+class Profiler;
+}
 
 // utility to do char4 to uint32 in a portable manner
 #define AI_MAKE_MAGIC(string) ((uint32_t)((string[0] << 24) + \
@@ -405,6 +409,12 @@ protected:
     std::exception_ptr m_Exception;
     /// Currently set progress handler.
     ProgressHandler *m_progress;
+    /// Profiler of the running import, nullptr unless AI_CONFIG_GLOB_MEASURE_TIME is set.
+    /// Importers report their "read", "parse" and "convert" phases to it via Profiling::ProfileScope.
+    Profiling::Profiler *m_profiler;
+    /// Worker threads of the Importer, nullptr unless AI_CONFIG_GLOB_NUM_THREADS allows more than one.
+    /// Importers may spread independent parts of their work over it with ThreadPool::ParallelFor().
+    ThreadPool *m_threadPool;
 };
 
 } // end of namespace Assimp
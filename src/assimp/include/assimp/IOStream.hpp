@@ -124,6 +124,19 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the whole file as one block of memory, if the
+     *  stream keeps it in memory anyway (e.g. a memory mapping).
+     *
+     *  Readers may parse the block in place instead of copying it with
+     *  Read(). It holds FileSize() bytes, is independent of the read
+     *  cursor and stays valid until the stream is closed.
+     *  @return The file contents or nullptr if they are only available
+     *    through Read(). */
+    virtual const uint8_t *GetMappedData() const {
+        return nullptr;
+    }
 }; //! class IOStream
 
 } //!namespace Assimp
@@ -51,6 +51,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/types.h>
 #include <assimp/IOStream.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace Assimp {
@@ -58,6 +59,9 @@ namespace Assimp {
 // ---------------------------------------------------------------------------
 /**
  *  Implementation of a cached stream buffer.
+ *
+ *  Streams which expose their contents through IOStream::GetMappedData()
+ *  are read in place, block by block, without a cache copy.
  */
 template <class T>
 class IOStreamBuffer {
@@ -116,6 +120,16 @@ public:
     /// @return true if successful.
     bool getNextBlock(std::vector<T> &buffer);
 
+    /// @brief  Returns true if the stream is read in place from its mapped data.
+    bool isMapped() const;
+
+    /// @brief  Returns the unread rest of a mapped stream without copying it and
+    ///         consumes it. Only valid if isMapped() is true.
+    /// @param  data        Receives the pointer to the rest of the data.
+    /// @param  size        Receives the number of elements left.
+    /// @return true if successful.
+    bool getRemainingData(const T *&data, size_t &size);
+
 private:
     IOStream *m_stream;
     size_t m_filesize;
@@ -125,6 +139,8 @@ private:
     std::vector<T> m_cache;
     size_t m_cachePos;
     size_t m_filePos;
+    const T *m_mapped;
+    const T *m_block;
 };
 
 template <class T>
@@ -135,9 +151,10 @@ AI_FORCE_INLINE IOStreamBuffer<T>::IOStreamBuffer(size_t cache) :
         m_numBlocks(0),
         m_blockIdx(0),
         m_cachePos(0),
-        m_filePos(0) {
-    m_cache.resize(cache);
-    std::fill(m_cache.begin(), m_cache.end(), '\n');
+        m_filePos(0),
+        m_mapped(nullptr),
+        m_block(nullptr) {
+    // empty
 }
 
 template <class T>
@@ -157,9 +174,17 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::open(IOStream *stream) {
     if (m_filesize == 0) {
         return false;
     }
+
+    // Blocks of a mapped stream point into the mapping instead of the cache
+    m_mapped = reinterpret_cast<const T *>(m_stream->GetMappedData());
     if (m_filesize < m_cacheSize) {
         m_cacheSize = m_filesize;
     }
+    if (nullptr == m_mapped) {
+        // one element more than a block, as line scans may look one past its end
+        m_cache.resize(m_cacheSize + 1);
+        std::fill(m_cache.begin(), m_cache.end(), '\n');
+    }
 
     m_numBlocks = m_filesize / m_cacheSize;
     if ((m_filesize % m_cacheSize) > 0) {
@@ -182,6 +207,8 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::close() {
     m_blockIdx = 0;
     m_cachePos = 0;
     m_filePos = 0;
+    m_mapped = nullptr;
+    m_block = nullptr;
 
     return true;
 }
@@ -202,8 +229,15 @@ AI_FORCE_INLINE
 
 template <class T>
 AI_FORCE_INLINE bool IOStreamBuffer<T>::readNextBlock() {
-    m_stream->Seek(m_filePos, aiOrigin_SET);
-    size_t readLen = m_stream->Read(&m_cache[0], sizeof(T), m_cacheSize);
+    size_t readLen = 0;
+    if (nullptr != m_mapped) {
+        readLen = m_filePos < m_filesize ? std::min(m_cacheSize, m_filesize - m_filePos) : 0;
+        m_block = m_mapped + m_filePos;
+    } else {
+        m_stream->Seek(m_filePos, aiOrigin_SET);
+        readLen = m_stream->Read(&m_cache[0], sizeof(T), m_cacheSize);
+        m_block = &m_cache[0];
+    }
     if (readLen == 0) {
         return false;
     }
@@ -243,17 +277,21 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextDataLine(std::vector<T> &buffer,
 
     size_t i = 0;
     for (;;) {
-        if (continuationToken == m_cache[m_cachePos] && IsLineEnd(m_cache[m_cachePos + 1])) {
+        if (continuationToken == m_block[m_cachePos] && m_cachePos + 1 < m_cacheSize && IsLineEnd(m_block[m_cachePos + 1])) {
+            // skip the line end, the line goes on after it
             ++m_cachePos;
-            while (m_cache[m_cachePos] != '\n') {
+            while (m_cachePos < m_cacheSize && m_block[m_cachePos] != '\n') {
                 ++m_cachePos;
             }
             ++m_cachePos;
-        } else if (IsLineEnd(m_cache[m_cachePos])) {
+            if (m_cachePos >= m_cacheSize && !readNextBlock()) {
+                break;
+            }
+        } else if (IsLineEnd(m_block[m_cachePos])) {
             break;
         }
 
-        buffer[i] = m_cache[m_cachePos];
+        buffer[i] = m_block[m_cachePos];
         ++m_cachePos;
         ++i;
 
@@ -290,7 +328,7 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextLine(std::vector<T> &buffer) {
         }
     }
 
-    if (IsLineEnd(m_cache[m_cachePos])) {
+    if (IsLineEnd(m_block[m_cachePos])) {
         // skip line end
         do {
             ++m_cachePos;
@@ -298,12 +336,12 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextLine(std::vector<T> &buffer) {
                 return false;
             }
         }
-        while (m_cache[m_cachePos] != '\n');
+        while (m_block[m_cachePos] != '\n');
     }
 
     size_t i(0);
-    while (!IsLineEnd(m_cache[m_cachePos])) {
-        buffer[i] = m_cache[m_cachePos];
+    while (!IsLineEnd(m_block[m_cachePos])) {
+        buffer[i] = m_block[m_cachePos];
         ++m_cachePos;
         ++i;
 
@@ -318,7 +356,7 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextLine(std::vector<T> &buffer) {
         }
     }
     buffer[i] = '\n';
-    while (m_cachePos < m_cacheSize && (m_cache[m_cachePos] == '\r' || m_cache[m_cachePos] == '\n')) {
+    while (m_cachePos < m_cacheSize && (m_block[m_cachePos] == '\r' || m_block[m_cachePos] == '\n')) {
         ++m_cachePos;
     }
 
@@ -328,17 +366,42 @@ AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextLine(std::vector<T> &buffer) {
 template <class T>
 AI_FORCE_INLINE bool IOStreamBuffer<T>::getNextBlock(std::vector<T> &buffer) {
     // Return the last block-value if getNextLine was used before
-    if (0 != m_cachePos) {
-        buffer = std::vector<T>(m_cache.begin() + m_cachePos, m_cache.end());
+    if (0 != m_cachePos && m_cachePos < m_cacheSize) {
+        buffer = std::vector<T>(m_block + m_cachePos, m_block + m_cacheSize);
         m_cachePos = 0;
     } else {
         if (!readNextBlock()) {
             return false;
         }
 
-        buffer = std::vector<T>(m_cache.begin(), m_cache.end());
+        buffer = std::vector<T>(m_block, m_block + m_cacheSize);
+    }
+
+    return true;
+}
+
+template <class T>
+AI_FORCE_INLINE bool IOStreamBuffer<T>::isMapped() const {
+    return nullptr != m_mapped;
+}
+
+template <class T>
+AI_FORCE_INLINE bool IOStreamBuffer<T>::getRemainingData(const T *&data, size_t &size) {
+    if (nullptr == m_mapped) {
+        return false;
     }
 
+    // m_filePos is the end of the current block
+    const size_t pos = 0 == m_filePos ? 0 : m_filePos - m_cacheSize + std::min(m_cachePos, m_cacheSize);
+    if (pos >= m_filesize) {
+        return false;
+    }
+    data = m_mapped + pos;
+    size = m_filesize - pos;
+
+    m_filePos = m_filesize;
+    m_cachePos = m_cacheSize;
+
     return true;
 }
 
@@ -81,6 +81,9 @@ class BatchLoader;
 // =======================================================================
 // Holy stuff, only for members of the high council of the Jedi.
 class ImporterPimpl;
+
+// Profiler.h
+struct ProfileReport;
 } // namespace Assimp
 
 #define AI_PROPERTY_WAS_NOT_EXISTING 0xffffffff
@@ -638,6 +641,18 @@ public:
      *   is (naturally) not included.*/
     void GetMemoryRequirements(aiMemoryInfo &in) const;
 
+    // -------------------------------------------------------------------
+    /** Returns the measurements of the last import.
+     *
+     * Only collected if #AI_CONFIG_GLOB_MEASURE_TIME is set, the report
+     * is empty otherwise. It holds the time, call count, peak memory and
+     * vertex/face counts of the importer phases and of every post-processing
+     * step, see ProfileRegion. Steps applied later on by ApplyPostProcessing()
+     * are added to the same report. Include <assimp/Profiler.h> to read it;
+     * ProfileReport::ToJson() writes it as JSON.
+     * @return The report, valid until the next ReadFile() call. */
+    const ProfileReport &GetProfileReport() const;
+
     // -------------------------------------------------------------------
     /** Enables "extra verbose" mode.
      *
@@ -0,0 +1,132 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+
+/**
+ *  @file MMapIOSystem.h
+ *  @brief IOSystem which maps files into memory for reading.
+ */
+#pragma once
+#ifndef AI_MMAPIOSYSTEM_H_INC
+#define AI_MMAPIOSYSTEM_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+//! @class  MMapIOStream
+//! @brief  Read-only stream over a file mapped into memory. Read() copies out of
+//!         the mapping, GetMappedData() exposes it directly.
+class ASSIMP_API MMapIOStream : public IOStream {
+    friend class MMapIOSystem;
+
+protected:
+    /// @brief  Maps the file, check IsOpen() for the result.
+    /// @param  strFilename The file name in UTF-8.
+    explicit MMapIOStream(const char *strFilename);
+
+public:
+    /** Destructor public to allow simple deletion to close the file. */
+    ~MMapIOStream() override;
+
+    // -------------------------------------------------------------------
+    /// Copy from the mapping
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Always fails, the stream is read-only
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Seek specific position
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+
+    // -------------------------------------------------------------------
+    /// Get current seek position
+    size_t Tell() const override;
+
+    // -------------------------------------------------------------------
+    /// Get size of file
+    size_t FileSize() const override;
+
+    // -------------------------------------------------------------------
+    /// Nothing to flush
+    void Flush() override;
+
+    // -------------------------------------------------------------------
+    /// The mapped file contents
+    const uint8_t *GetMappedData() const override;
+
+    // -------------------------------------------------------------------
+    /// Returns true if the file could be mapped
+    bool IsOpen() const;
+
+private:
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mPos;
+#ifdef _WIN32
+    void *mFile;
+    void *mMapping;
+#endif
+};
+
+// ---------------------------------------------------------------------------
+/** IOSystem which opens files for reading as memory mappings, so importers
+ *  can parse them in place (see IOStream::GetMappedData()). Files opened for
+ *  writing, empty files and files which can't be mapped fall back to
+ *  DefaultIOSystem. */
+class ASSIMP_API MMapIOSystem : public DefaultIOSystem {
+public:
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+};
+
+} //!ns Assimp
+
+#endif //AI_MMAPIOSYSTEM_H_INC
@@ -40,7 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 /** @file Profiler.h
- *  @brief Utility to measure the respective runtime of each import step
+ *  @brief Utility to measure the runtime, memory and geometry of each import step
  */
 #pragma once
 #ifndef AI_INCLUDED_PROFILER_H
@@ -50,51 +50,153 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #   pragma GCC system_header
 #endif
 
+#include <assimp/defs.h>
+
 #include <chrono>
-#include <assimp/DefaultLogger.hpp>
-#include <assimp/TinyFormatter.h>
+#include <string>
+#include <vector>
 
-#include <map>
+struct aiScene;
 
 namespace Assimp {
-namespace Profiling {
 
-using namespace Formatter;
+// ------------------------------------------------------------------------------------------------
+/** @brief Measurements for one named region of an import, see Importer::GetProfileReport().
+ *
+ *  Regions nest: ReadFile() records "total" with "import" (and the importer's own "read",
+ *  "parse" and "convert" phases), "preprocess" and "postprocess" below it, and every
+ *  post-processing step as a child of "postprocess". A region that is entered more than once
+ *  below the same parent is merged into one entry.
+ */
+struct ProfileRegion {
+    /** Name of the region, e.g. "parse" or "JoinIdenticalVertices" */
+    std::string mName;
+
+    /** How often the region was entered */
+    unsigned int mCalls = 0;
+
+    /** Wall-clock time spent in the region over all calls, in seconds (steady clock) */
+    double mSeconds = 0.0;
+
+    /** Peak resident memory of the process when the region was last left, in bytes.
+     *  0 if the platform does not report it. */
+    size_t mPeakMemory = 0;
+
+    /** How much the region raised the peak resident memory, in bytes */
+    size_t mPeakMemoryIncrease = 0;
+
+    /** Vertices and faces over all meshes of the scene when the region was first entered
+     *  and when it was last left. Only set for regions that see a scene. */
+    unsigned int mVerticesIn = 0;
+    unsigned int mVerticesOut = 0;
+    unsigned int mFacesIn = 0;
+    unsigned int mFacesOut = 0;
+
+    /** Regions opened while this one was open */
+    std::vector<ProfileRegion> mChildren;
+
+    /** Returns the direct child with the given name or nullptr */
+    ASSIMP_API const ProfileRegion *FindChild(const std::string &name) const;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** @brief Everything measured during the last import, see Importer::GetProfileReport(). */
+struct ProfileReport {
+    /** Top-level regions in the order they were first entered */
+    std::vector<ProfileRegion> mRegions;
+
+    /** Returns true if nothing was measured */
+    bool Empty() const { return mRegions.empty(); }
+
+    /** Looks up a region by its path of names separated by '/', e.g. "total/postprocess/Triangulate".
+     *  Returns nullptr if there is no such region. */
+    ASSIMP_API const ProfileRegion *Find(const std::string &path) const;
+
+    /** Writes the report as JSON: an array of regions, each an object with "name", "calls",
+     *  "seconds", "peakMemory", "peakMemoryIncrease", "verticesIn", "verticesOut", "facesIn",
+     *  "facesOut" and "children". */
+    ASSIMP_API std::string ToJson() const;
+};
+
+namespace Profiling {
 
 // ------------------------------------------------------------------------------------------------
-/** Simple wrapper around boost::timer to simplify reporting. Timings are automatically
- *  dumped to the log file.
+/** Collects a hierarchy of named regions into a ProfileReport. Begin and end times are also
+ *  written to the log. A region opened by BeginRegion() becomes a child of the innermost region
+ *  that is still open.
  */
-class Profiler {
+class ASSIMP_API Profiler {
 public:
     Profiler() = default;
 
+    /** Open a named region below the innermost open one */
+    void BeginRegion(const std::string &region);
 
-    /** Start a named timer */
-    void BeginRegion(const std::string& region) {
-        regions[region] = std::chrono::system_clock::now();
-        ASSIMP_LOG_DEBUG("START `",region,"`");
-    }
+    /** Close a named region and write its duration to the log. Regions opened inside it and not
+     *  closed yet are closed as well; a name that is not open is ignored. */
+    void EndRegion(const std::string &region);
+
+    /** Record the size of the scene as input of the innermost open region. Only the first
+     *  call per region is kept. */
+    void SetSceneIn(const aiScene *scene);
+
+    /** Record the size of the scene as output of the innermost open region */
+    void SetSceneOut(const aiScene *scene);
+
+    /** Discard all measurements and open regions */
+    void Reset();
+
+    /** Returns what was measured since the last Reset() */
+    const ProfileReport &GetReport() const { return mReport; }
 
+    /** Peak resident memory of the process in bytes, 0 if the platform does not report it */
+    static size_t GetPeakMemory();
 
-    /** End a specific named timer and write its end time to the log */
-    void EndRegion(const std::string& region) {
-        RegionMap::const_iterator it = regions.find(region);
-        if (it == regions.end()) {
-            return;
+private:
+    struct OpenRegion {
+        ProfileRegion *region;
+        std::chrono::steady_clock::time_point start;
+        size_t peakMemory;
+    };
+
+    ProfileReport mReport;
+    std::vector<OpenRegion> mOpen;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Keeps a region open for the lifetime of the object. Does nothing if the profiler is nullptr,
+ *  so importers can use it without checking whether profiling is enabled.
+ */
+class ProfileScope {
+public:
+    ProfileScope(Profiler *profiler, const char *region) :
+            mProfiler(profiler), mRegion(region) {
+        if (mProfiler) {
+            mProfiler->BeginRegion(mRegion);
         }
+    }
+
+    ~ProfileScope() {
+        End();
+    }
 
-        std::chrono::duration<double> elapsedSeconds = std::chrono::system_clock::now() - regions[region];
-        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", elapsedSeconds.count()," s");
+    /** Close the region before the object goes out of scope */
+    void End() {
+        if (mProfiler) {
+            mProfiler->EndRegion(mRegion);
+            mProfiler = nullptr;
+        }
     }
 
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
 private:
-    typedef std::map<std::string,std::chrono::time_point<std::chrono::system_clock>> RegionMap;
-    RegionMap regions;
+    Profiler *mProfiler;
+    const char *mRegion;
 };
 
-}
-}
+} // namespace Profiling
+} // namespace Assimp
 
 #endif // AI_INCLUDED_PROFILER_H
-
@@ -49,6 +49,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #   pragma GCC system_header
 #endif
 
+#include <assimp/SpatialGrid.h>
 #include <assimp/types.h>
 #include <vector>
 #include <stdint.h>
@@ -86,6 +87,17 @@ public:
      */
     void Prepare();
 
+    // -------------------------------------------------------------------
+    /** Selects the search structure, takes effect at the next Prepare().
+     *  See SpatialSort::SetBackend(). */
+    void SetBackend(SpatialSortBackend backend) { mBackend = backend; }
+
+    // -------------------------------------------------------------------
+    /** Returns the search structure in use since the last Prepare() */
+    SpatialSortBackend GetBackend() const {
+        return mGrid.Empty() ? SpatialSortBackend::Plane : SpatialSortBackend::Grid;
+    }
+
     /** Destructor */
     ~SGSpatialSort() = default;
 
@@ -145,6 +157,12 @@ protected:
 
     // all positions, sorted by distance to the sorting plane
     std::vector<Entry> mPositions;
+
+    /// Requested search structure
+    SpatialSortBackend mBackend = SpatialSortBackend::Automatic;
+
+    /// Grid over mPositions, its entries are indices into mPositions. Empty if not used.
+    SpatialGrid mGrid;
 };
 
 } // end of namespace Assimp
@@ -0,0 +1,163 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** Uniform grid used by SpatialSort and SGSpatialSort for crowded position sets */
+#pragma once
+#ifndef AI_SPATIALGRID_H_INC
+#define AI_SPATIALGRID_H_INC
+
+#ifdef __GNUC__
+#pragma GCC system_header
+#endif
+
+#include <assimp/types.h>
+#include <stdint.h>
+#include <vector>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+/** Search structure behind SpatialSort::FindPositions() and SGSpatialSort::FindPositions().
+ *  Automatic picks the grid if the positions crowd the sorting plane, see SpatialGrid. */
+enum class SpatialSortBackend {
+    Automatic,
+    Plane,
+    Grid
+};
+
+// ------------------------------------------------------------------------------------------------
+/** A uniform grid over a set of positions. The cell size is chosen from the bounds so that a
+ * cell holds about two positions if they are spread evenly; flat axes collapse to a single
+ * cell. Cells are addressed by a 63 bit key (21 bits per axis) and the entries are radix sorted
+ * by key, so the entries of a row of cells along z are contiguous.
+ *
+ * The sorting plane of SpatialSort degrades towards O(n) per query when many positions share
+ * one plane distance, e.g. in planar or grid-like architectural models. The grid does not, so
+ * the spatial sorts switch to it when the positions crowd the plane (see UsePlaneInstead()).
+ * It is only used for small query radii; a query that covers too many cells falls back to the
+ * plane. */
+// ------------------------------------------------------------------------------------------------
+class ASSIMP_API SpatialGrid {
+public:
+    /// Below this number of positions the sorting plane is always fast enough
+    static constexpr size_t MinimumEntries = 1024;
+
+    /// Queries touching more cells than this are left to the sorting plane
+    static constexpr size_t MaximumQueryCells = 64;
+
+    // ------------------------------------------------------------------------------------
+    /** Computes the bounds and the cell size for the given positions.
+     * @param pPositions Pointer to the first position.
+     * @param pNumPositions Number of positions.
+     * @param pElementOffset Offset in bytes from one position to the next.
+     * @return false if the positions have no finite bounds; the grid can't be used then. */
+    bool Setup(const aiVector3D *pPositions, size_t pNumPositions, size_t pElementOffset);
+
+    // ------------------------------------------------------------------------------------
+    /** Sorts the positions into the cells, call Setup() first. Entry i refers to the i-th
+     *  position. */
+    void Build(const aiVector3D *pPositions, size_t pNumPositions, size_t pElementOffset);
+
+    /** Drops all entries */
+    void Clear();
+
+    /** Returns true if Build() has not been called since the last Clear() */
+    bool Empty() const { return mKeys.empty(); }
+
+    /** Edge length of a cell, valid after Setup() */
+    ai_real GetCellSize() const { return mCellSize; }
+
+    // ------------------------------------------------------------------------------------
+    /** Appends the entries of all cells overlapping the cube of the given radius around the
+     *  position, in key order. Nothing is appended if the cube misses the grid.
+     * @return false if the cube covers more than MaximumQueryCells cells and the caller has
+     *  to search differently. */
+    bool FindCandidates(const aiVector3D &pPosition, ai_real pRadius,
+            std::vector<unsigned int> &poCandidates) const;
+
+    // ------------------------------------------------------------------------------------
+    /** Decides between the sorting plane and the grid, given the distances of the positions
+     *  to the sorting plane in ascending order. The plane stays if a window of one cell size
+     *  along the plane normal holds only a few positions on average - a plane query then
+     *  visits not many more candidates than a grid query. */
+    template <class TEntry>
+    bool UsePlaneInstead(const std::vector<TEntry> &pSortedByDistance) const;
+
+private:
+    uint64_t CellKey(unsigned int x, unsigned int y, unsigned int z) const {
+        return (uint64_t(x) << 42) | (uint64_t(y) << 21) | uint64_t(z);
+    }
+    unsigned int CellCoord(ai_real value, unsigned int axis) const;
+
+    aiVector3D mMin;
+    aiVector3D mMax;
+    ai_real mCellSize = 1;
+    unsigned int mNumCells[3] = { 1, 1, 1 };
+    std::vector<uint64_t> mKeys;        ///< Cell key per entry, ascending
+    std::vector<unsigned int> mEntries; ///< Entry index, parallel to mKeys
+};
+
+// ------------------------------------------------------------------------------------------------
+template <class TEntry>
+inline bool SpatialGrid::UsePlaneInstead(const std::vector<TEntry> &pSortedByDistance) const {
+    // Positions sharing a cell with an evenly spread one; above this many plane candidates
+    // per grid candidate the grid pays for its binary searches
+    static constexpr double CrowdingFactor = 16.0;
+    static constexpr double CellOccupancy = 2.0;
+
+    // mean number of positions in [distance, distance + cell size) - two pointers, O(n)
+    const size_t count = pSortedByDistance.size();
+    size_t sum = 0;
+    for (size_t i = 0, j = 0; i < count; ++i) {
+        if (j < i) {
+            j = i;
+        }
+        while (j < count && pSortedByDistance[j].mDistance - pSortedByDistance[i].mDistance < mCellSize) {
+            ++j;
+        }
+        sum += j - i;
+    }
+    return count == 0 || double(sum) / double(count) < CrowdingFactor * CellOccupancy;
+}
+
+} // end of namespace Assimp
+
+#endif // AI_SPATIALGRID_H_INC
@@ -48,6 +48,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma GCC system_header
 #endif
 
+#include <assimp/SpatialGrid.h>
 #include <assimp/types.h>
 #include <vector>
 #include <limits>
@@ -60,7 +61,9 @@ namespace Assimp {
  * by their indices and sorts them by their distance to an arbitrary chosen plane.
  * You can then query the instance for all vertices close to a given position in an average O(log n)
  * time, with O(n) worst case complexity when all vertices lay on the plane. The plane is chosen
- * so that it avoids common planes in usual data sets. */
+ * so that it avoids common planes in usual data sets. If the vertices crowd the plane anyway,
+ * #Finalize() additionally sorts them into a SpatialGrid, which answers queries with small radii
+ * in O(1). Both return the same results in the same order. */
 // ------------------------------------------------------------------------------------------------
 class ASSIMP_API SpatialSort {
 public:
@@ -110,6 +113,19 @@ public:
      *  can be called to query the spatial sort.*/
     void Finalize();
 
+    // ------------------------------------------------------------------------------------
+    /** Selects the search structure for #FindPositions() and #FindIdenticalPositions().
+     *  Takes effect at the next #Finalize(). The default, SpatialSortBackend::Automatic,
+     *  picks the grid for large position sets that crowd the sorting plane. */
+    void SetBackend(SpatialSortBackend backend) { mBackend = backend; }
+
+    // ------------------------------------------------------------------------------------
+    /** Returns the search structure in use since the last #Finalize(), either
+     *  SpatialSortBackend::Plane or SpatialSortBackend::Grid. */
+    SpatialSortBackend GetBackend() const {
+        return mGrid.Empty() ? SpatialSortBackend::Plane : SpatialSortBackend::Grid;
+    }
+
     // ------------------------------------------------------------------------------------
     /** Returns an iterator for all positions close to the given position.
      * @param pPosition The position to look for vertices.
@@ -182,6 +198,12 @@ protected:
 
     /// false until the Finalize method is called.
     bool mFinalized;
+
+    /// Requested search structure
+    SpatialSortBackend mBackend;
+
+    /// Grid over mPositions, its entries are indices into mPositions. Empty if not used.
+    SpatialGrid mGrid;
 };
 
 } // end of namespace Assimp
@@ -92,6 +92,7 @@ public:
             mCurrent(nullptr),
             mEnd(nullptr),
             mLimit(nullptr),
+            mOwnsBuffer(true),
             mLe(le) {
         ai_assert(stream);
         InternBegin();
@@ -104,6 +105,7 @@ public:
             mCurrent(nullptr),
             mEnd(nullptr),
             mLimit(nullptr),
+            mOwnsBuffer(true),
             mLe(le) {
         ai_assert(nullptr != stream);
         InternBegin();
@@ -111,7 +113,9 @@ public:
 
     // ---------------------------------------------------------------------
     ~StreamReader() {
-        delete[] mBuffer;
+        if (mOwnsBuffer) {
+            delete[] mBuffer;
+        }
     }
 
     // deprecated, use overloaded operator>> instead
@@ -309,6 +313,14 @@ private:
             throw DeadlyImportError("StreamReader: File is empty or EOF is already reached");
         }
 
+        // mapped streams are read in place; the reader never writes through mBuffer
+        if (const uint8_t *mapped = mStream->GetMappedData()) {
+            mCurrent = mBuffer = reinterpret_cast<int8_t *>(const_cast<uint8_t *>(mapped)) + mStream->Tell();
+            mEnd = mLimit = mBuffer + filesize;
+            mOwnsBuffer = false;
+            return;
+        }
+
         mCurrent = mBuffer = new int8_t[filesize];
         const size_t read = mStream->Read(mCurrent, 1, filesize);
         // (read < s) can only happen if the stream was opened in text mode, in which case FileSize() is not reliable
@@ -322,6 +334,7 @@ private:
     int8_t *mCurrent;
     int8_t *mEnd;
     int8_t *mLimit;
+    bool mOwnsBuffer;
     bool mLe;
 };
 
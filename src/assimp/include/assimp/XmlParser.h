@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define INCLUDED_AI_IRRXML_WRAPPER
 
 #include <assimp/ai_assert.h>
+#include <assimp/ParsingUtils.h>
 #include <assimp/StringUtils.h>
 #include <assimp/DefaultLogger.hpp>
 
@@ -50,7 +51,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "IOStream.hpp"
 
 #include <pugixml.hpp>
+#include <algorithm>
+#include <cstring>
 #include <istream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -129,6 +133,12 @@ public:
     /// @return true, if the parsing was successful, false if not.
     bool parse(IOStream *stream);
 
+    /// @brief  Will parse an xml-file held in memory. The parser takes over the buffer and
+    ///         parses it in place.
+    /// @param[in] buffer      The xml text.
+    /// @return true, if the parsing was successful, false if not.
+    bool parse(std::vector<char> &&buffer);
+
     /// @brief  Will parse an xml-file from a stringstream.
     /// @param[in] str      The input istream (note: not "const" to match pugixml param)
     /// @return true, if the parsing was successful, false if not.
@@ -217,6 +227,15 @@ public:
     /// @return true, if the value can be read out.
     static inline bool getValueAsString(XmlNode &node, std::string &text);
 
+    /// @brief Gives access to the text of the node without copying it, for large
+    ///        payloads such as number arrays. Leading and trailing whitespace is skipped.
+    /// @param[in]  node    The node to search in.
+    /// @param[out] begin   The first character of the text.
+    /// @param[out] end     Behind the last character of the text. The range stays valid
+    ///                     as long as the document.
+    /// @return true, if the node has a value.
+    static inline bool getValueAsText(XmlNode &node, const char *&begin, const char *&end);
+
     /// @brief Will try to get the value of the node as a real.
     /// @param[in]  node   The node to search in.
     /// @param[out] v      The value as a ai_real.
@@ -310,14 +329,29 @@ bool TXmlParser<TNodeType>::parse(IOStream *stream) {
     }
 
     const size_t len = stream->FileSize();
-    mData.resize(len + 1);
-    memset(&mData[0], '\0', len + 1);
-    stream->Read(&mData[0], 1, len);
+    std::vector<char> data(len + 1, '\0');
+    stream->Read(&data[0], 1, len);
+
+    return parse(std::move(data));
+}
+
+template <class TNodeType>
+bool TXmlParser<TNodeType>::parse(std::vector<char> &&buffer) {
+    if (hasRoot()) {
+        clear();
+    }
+
+    mData = std::move(buffer);
+    if (mData.empty()) {
+        mData.push_back('\0');
+    }
 
     mDoc = new pugi::xml_document();
     // load_string assumes native encoding (aka always utf-8 per build options)
     //pugi::xml_parse_result parse_result = mDoc->load_string(&mData[0], pugi::parse_full);
-    pugi::xml_parse_result parse_result = mDoc->load_buffer(&mData[0], mData.size(), pugi::parse_full);
+    // Parse in place: the document points into mData instead of keeping a second copy of
+    // the file, and node texts can be read without copying them (see getValueAsText()).
+    pugi::xml_parse_result parse_result = mDoc->load_buffer_inplace(&mData[0], mData.size(), pugi::parse_full);
     if (parse_result.status == pugi::status_ok) {
         return true;
     }
@@ -481,6 +515,25 @@ inline bool TXmlParser<TNodeType>::getValueAsString(XmlNode &node, std::string &
     return true;
 }
 
+template <class TNodeType>
+inline bool TXmlParser<TNodeType>::getValueAsText(XmlNode &node, const char *&begin, const char *&end) {
+    begin = end = nullptr;
+    if (node.empty()) {
+        return false;
+    }
+
+    begin = node.text().get();
+    end = begin + strlen(begin);
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin))) {
+        ++begin;
+    }
+    while (end != begin && std::isspace(static_cast<unsigned char>(end[-1]))) {
+        --end;
+    }
+
+    return true;
+}
+
 template <class TNodeType>
 inline bool TXmlParser<TNodeType>::getValueAsReal(XmlNode& node, ai_real& v) {
     if (node.empty()) {
@@ -528,6 +581,307 @@ inline bool TXmlParser<TNodeType>::getValueAsBool(XmlNode &node, bool &v) {
 
 using XmlParser = TXmlParser<pugi::xml_node>;
 
+///	@brief  This class reads an xml-file from a stream piece by piece and reports it as
+///         a sequence of events, instead of building a document of the whole file.
+///
+/// Use it for files which may be too large to hold in memory as a whole. Only a window of
+/// the file is buffered. Long texts are reported in several pieces, a piece always ends
+/// at a whitespace, a tag or the end of the file, so it never splits a token. Comments,
+/// processing instructions, CDATA sections and the doctype are reported as markup.
+/// Entities are not expanded, neither in texts nor in attribute values.
+///
+/// An example:
+/// @code
+/// XmlPullReader reader(fileStream);
+/// for (auto event = reader.next(); event != XmlPullReader::EndOfDocument; event = reader.next()) {
+///     if (event == XmlPullReader::StartElement && reader.getName() == "float_array") {
+///         // The following Text events hold the values
+///     }
+/// }
+/// @endcode
+class XmlPullReader {
+public:
+    /// @brief The events reported by next().
+    enum Event {
+        StartElement, ///< A start tag, an empty element is followed by an EndElement without text.
+        EndElement, ///< An end tag.
+        Text, ///< A piece of the text between two tags.
+        Markup, ///< A comment, processing instruction, CDATA section or doctype.
+        EndOfDocument ///< The end of the stream.
+    };
+
+    ///	@brief  The class constructor.
+    /// @param  stream      [in] The stream to read, it has to outlive the reader.
+    /// @param  chunkSize   [in] The number of bytes read from the stream at once.
+    explicit XmlPullReader(IOStream *stream, size_t chunkSize = 64 * 1024) :
+            mStream(stream),
+            mChunkSize(std::max(chunkSize, static_cast<size_t>(16))),
+            mBuffer(),
+            mBegin(0),
+            mEnd(0),
+            mEof(nullptr == stream),
+            mRawBegin(0),
+            mRawEnd(0),
+            mName(),
+            mEmptyElement(false),
+            mPendingEnd(false) {
+        // empty
+    }
+
+    ///	@brief  The class destructor, default implementation.
+    ~XmlPullReader() = default;
+
+    ///	@brief  Will check whether the stream is UTF-8 or plain ASCII, the reader can not
+    ///         handle UTF-16 or UTF-32 files. Call it before the first next().
+    /// @return true, if the stream can be read.
+    bool isUtf8() {
+        if (mBegin == mEnd) {
+            fill();
+        }
+        const size_t size = mEnd - mBegin;
+        const unsigned char *data = reinterpret_cast<const unsigned char *>(mBuffer.data() + mBegin);
+        if (size >= 2 && ((data[0] == 0xFE && data[1] == 0xFF) || (data[0] == 0xFF && data[1] == 0xFE))) {
+            return false;
+        }
+        return !((size >= 1 && data[0] == 0) || (size >= 2 && data[1] == 0));
+    }
+
+    ///	@brief  Will read the next event.
+    /// @return The event, EndOfDocument once the stream is exhausted.
+    Event next() {
+        if (mPendingEnd) {
+            mPendingEnd = false;
+            mRawBegin = mRawEnd = mBegin;
+            return EndElement;
+        }
+        if (mBegin == mEnd && !fill()) {
+            mRawBegin = mRawEnd = mBegin;
+            return EndOfDocument;
+        }
+        return mBuffer[mBegin] == '<' ? readMarkup() : readText();
+    }
+
+    ///	@brief  Will return the name of the element of a StartElement or EndElement event.
+    /// @return The element name.
+    const std::string &getName() const {
+        return mName;
+    }
+
+    ///	@brief  Will return true, if the StartElement event is an empty element like <p/>.
+    /// @return true for an empty element.
+    bool isEmptyElement() const {
+        return mEmptyElement;
+    }
+
+    ///	@brief  Gives access to the current event as it is written in the file: the whole
+    ///         tag or markup, or the piece of text. The range is valid until the next call
+    ///         of next().
+    /// @param  begin   [out] The first character.
+    /// @param  end     [out] Behind the last character.
+    void getRaw(const char *&begin, const char *&end) const {
+        begin = mBuffer.data() + mRawBegin;
+        end = mBuffer.data() + mRawEnd;
+    }
+
+    ///	@brief  Will try to get an attribute of the current StartElement.
+    /// @param  name    [in] The attribute name to look for.
+    /// @param  value   [out] The attribute value.
+    /// @return true, if the element has the attribute.
+    bool getAttribute(const char *name, std::string &value) const {
+        const char *c = mBuffer.data() + mRawBegin + 1 + mName.size();
+        const char *end = mBuffer.data() + mRawEnd - 1;
+        while (c < end) {
+            while (c != end && (IsSpaceOrNewLine(*c) || *c == '/')) {
+                ++c;
+            }
+            const char *key = c;
+            while (c != end && *c != '=' && !IsSpaceOrNewLine(*c)) {
+                ++c;
+            }
+            const char *keyEnd = c;
+            while (c != end && (*c == '=' || IsSpaceOrNewLine(*c))) {
+                ++c;
+            }
+            if (c == end || (*c != '"' && *c != '\'')) {
+                return false;
+            }
+            const char quote = *c++;
+            const char *valueBegin = c;
+            while (c != end && *c != quote) {
+                ++c;
+            }
+            if (static_cast<size_t>(keyEnd - key) == strlen(name) && 0 == strncmp(key, name, keyEnd - key)) {
+                value.assign(valueBegin, c);
+                return true;
+            }
+            if (c != end) {
+                ++c;
+            }
+        }
+        return false;
+    }
+
+private:
+    // Appends the next chunk of the stream to the unread data, returns false at the end
+    bool fill() {
+        if (mEof) {
+            return false;
+        }
+        if (mBegin > 0) {
+            std::copy(mBuffer.begin() + mBegin, mBuffer.begin() + mEnd, mBuffer.begin());
+            mEnd -= mBegin;
+            mBegin = 0;
+        }
+        if (mBuffer.size() < mEnd + mChunkSize + 1) {
+            mBuffer.resize(mEnd + mChunkSize + 1);
+        }
+        const size_t read = mStream->Read(&mBuffer[mEnd], 1, mChunkSize);
+        mEnd += read;
+        mBuffer[mEnd] = '\0';
+        if (0 == read) {
+            mEof = true;
+        }
+        return 0 != read;
+    }
+
+    Event emit(Event event, size_t length) {
+        mRawBegin = mBegin;
+        mRawEnd = mBegin + length;
+        mBegin += length;
+        return event;
+    }
+
+    Event readText() {
+        size_t scanned = 0;
+        for (;;) {
+            const char *first = mBuffer.data() + mBegin;
+            const char *last = mBuffer.data() + mEnd;
+            const char *tag = std::find(first + scanned, last, '<');
+            if (tag != last) {
+                return emit(Text, tag - first);
+            }
+            if (!mEof) {
+                // hand out everything up to the last whitespace, the rest may continue in the next chunk
+                const char *split = last;
+                while (split != first && !IsSpaceOrNewLine(split[-1])) {
+                    --split;
+                }
+                if (split != first) {
+                    return emit(Text, split - first);
+                }
+                scanned = last - first;
+                if (fill()) {
+                    continue;
+                }
+            }
+            return emit(Text, mEnd - mBegin);
+        }
+    }
+
+    Event readMarkup() {
+        size_t length = 0;
+        while (!findMarkupEnd(length)) {
+            if (!fill()) {
+                throw DeadlyImportError("Unexpected end of file in an xml tag.");
+            }
+        }
+
+        const char *first = mBuffer.data() + mBegin;
+        if (first[1] == '!' || first[1] == '?') {
+            return emit(Markup, length);
+        }
+
+        const bool endTag = first[1] == '/';
+        const char *name = first + (endTag ? 2 : 1);
+        const char *nameEnd = name;
+        while (*nameEnd != '>' && *nameEnd != '/' && !IsSpaceOrNewLine(*nameEnd)) {
+            ++nameEnd;
+        }
+        mName.assign(name, nameEnd);
+        if (endTag) {
+            mEmptyElement = false;
+            return emit(EndElement, length);
+        }
+        mEmptyElement = mPendingEnd = first[length - 2] == '/';
+        return emit(StartElement, length);
+    }
+
+    // Finds the end of the tag or markup at mBegin, returns false if more data is needed
+    bool findMarkupEnd(size_t &length) const {
+        const char *first = mBuffer.data() + mBegin;
+        const char *last = mBuffer.data() + mEnd;
+        const size_t size = mEnd - mBegin;
+        if (size < 2) {
+            return false;
+        }
+
+        const char *terminator = nullptr;
+        size_t skip = 0;
+        if (first[1] == '?') {
+            terminator = "?>";
+            skip = 2;
+        } else if (first[1] == '!') {
+            static const char comment[] = "<!--";
+            static const char cdata[] = "<![CDATA[";
+            if (0 == strncmp(first, comment, std::min(size, sizeof(comment) - 1))) {
+                if (size < sizeof(comment) - 1) {
+                    return false;
+                }
+                terminator = "-->";
+                skip = sizeof(comment) - 1;
+            } else if (0 == strncmp(first, cdata, std::min(size, sizeof(cdata) - 1))) {
+                if (size < sizeof(cdata) - 1) {
+                    return false;
+                }
+                terminator = "]]>";
+                skip = sizeof(cdata) - 1;
+            }
+        }
+        if (nullptr != terminator) {
+            const char *found = std::search(first + skip, last, terminator, terminator + strlen(terminator));
+            if (found == last) {
+                return false;
+            }
+            length = found + strlen(terminator) - first;
+            return true;
+        }
+
+        // a tag or the doctype, a '>' may be part of an attribute value or the internal subset
+        const bool doctype = first[1] == '!';
+        char quote = 0;
+        int brackets = 0;
+        for (const char *c = first + 1; c != last; ++c) {
+            if (0 != quote) {
+                if (*c == quote) {
+                    quote = 0;
+                }
+            } else if (*c == '"' || *c == '\'') {
+                quote = *c;
+            } else if (doctype && *c == '[') {
+                ++brackets;
+            } else if (doctype && *c == ']') {
+                --brackets;
+            } else if (*c == '>' && brackets <= 0) {
+                length = c + 1 - first;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    IOStream *mStream;
+    size_t mChunkSize;
+    std::vector<char> mBuffer;
+    size_t mBegin;
+    size_t mEnd;
+    bool mEof;
+    size_t mRawBegin;
+    size_t mRawEnd;
+    std::string mName;
+    bool mEmptyElement;
+    bool mPendingEnd;
+};
+
 ///	@brief  This class declares an iterator to loop through all children of the root node.
 class XmlNodeIterator {
 public:
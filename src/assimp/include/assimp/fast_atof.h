@@ -21,7 +21,9 @@
 #   pragma GCC system_header
 #endif
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <stdint.h>
 #include <assimp/defs.h>
@@ -37,6 +39,15 @@
 #  include <assimp/Compiler/pstdint.h>
 #endif
 
+// SSE2 is part of every x86-64 target, so the separator scan needs no runtime dispatch
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define AI_FAST_ATOF_SSE2
+#  include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#  include <intrin.h>
+#endif
+
 namespace Assimp {
 
 static constexpr size_t NumItems = 16;
@@ -373,6 +384,298 @@ inline ai_real fast_atof( const char** inout) {
     return ret;
 }
 
+// ------------------------------------------------------------------------------------
+// Batch conversion for the text formats. Numbers in OBJ, PLY or Collada files come in
+// long blank-separated runs. With SSE2, each token is classified with one 16-byte load
+// that yields its length, its sign and the position of the dot, so the next token is
+// found without waiting for the conversion. Digits are converted 8 at a time in a 64-bit
+// register (one test finds the end of the run, three multiplications convert it), which
+// is also what the scalar path uses. The functions never read outside [in, end), so they
+// work on buffers that are not zero terminated, and the results are identical to
+// fast_atoreal_move().
+// ------------------------------------------------------------------------------------
+
+constexpr uint32_t fast_atoi_pow10[9] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u
+};
+
+// Index of the lowest set bit, mask must not be 0
+inline unsigned int fast_atof_lowest_bit(uint64_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+#   ifdef _WIN64
+    _BitScanForward64(&index, mask);
+#   else
+    if (!_BitScanForward(&index, static_cast<unsigned long>(mask))) {
+        _BitScanForward(&index, static_cast<unsigned long>(mask >> 32));
+        index += 32;
+    }
+#   endif
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctzll(mask));
+#endif
+}
+
+#ifndef AI_BUILD_BIG_ENDIAN
+// ------------------------------------------------------------------------------------
+// Number of leading digits in 8 characters loaded little endian, 0 to 8.
+// ------------------------------------------------------------------------------------
+inline unsigned int fast_atoi_digit_count(uint64_t chunk) {
+    // Characters outside '0'..'9' get their top bit set. Borrows and carries only move
+    // towards later characters, so the first non-digit is always found exactly.
+    const uint64_t d = chunk - 0x3030303030303030ull;
+    const uint64_t nonDigit = (d | (d + 0x7676767676767676ull)) & 0x8080808080808080ull;
+    return 0 == nonDigit ? 8u : fast_atof_lowest_bit(nonDigit) / 8;
+}
+
+// ------------------------------------------------------------------------------------
+// Value of the first count (1 to 8) digits of 8 characters loaded little endian.
+// ------------------------------------------------------------------------------------
+inline uint32_t fast_atoi_convert8(uint64_t chunk, unsigned int count) {
+    // shifting the digits to the top leaves zeros in front of them
+    uint64_t d = (chunk - 0x3030303030303030ull) << (8 * (8 - count));
+    d = d * 10 + (d >> 8);
+    d = (((d & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+         (((d >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+    return static_cast<uint32_t>(d);
+}
+#endif
+
+// ------------------------------------------------------------------------------------
+// Convert the run of decimal digits at in, but at most max_digits (<= 19) of them.
+// Returns the number of digits converted, 0 if in does not point at a digit.
+// ------------------------------------------------------------------------------------
+inline unsigned int strtoul10_run(const char *in, const char *end, uint64_t &value, unsigned int max_digits = 19) {
+    unsigned int cur = 0;
+    uint64_t v = 0;
+#ifndef AI_BUILD_BIG_ENDIAN
+    if (end - in >= 8) {
+        // the common case, a run of less than 8 digits, takes a single step
+        uint64_t chunk;
+        ::memcpy(&chunk, in, sizeof(chunk));
+        const unsigned int count = fast_atoi_digit_count(chunk);
+        if (count < 8 && count <= max_digits) {
+            value = 0 != count ? fast_atoi_convert8(chunk, count) : 0;
+            return count;
+        }
+    }
+    while (end - in >= 8 && cur < max_digits) {
+        uint64_t chunk;
+        ::memcpy(&chunk, in, sizeof(chunk));
+        const unsigned int count = std::min(fast_atoi_digit_count(chunk), max_digits - cur);
+        if (0 != count) {
+            v = v * fast_atoi_pow10[count] + fast_atoi_convert8(chunk, count);
+        }
+        cur += count;
+        in += count;
+        if (count < 8) {
+            value = v;
+            return cur;
+        }
+    }
+#endif
+    while (cur < max_digits && in != end && *in >= '0' && *in <= '9') {
+        v = v * 10 + static_cast<uint64_t>(*in - '0');
+        ++in;
+        ++cur;
+    }
+    value = v;
+    return cur;
+}
+
+// ------------------------------------------------------------------------------------
+// Skip blanks, and line breaks as well if multi_line is set.
+// ------------------------------------------------------------------------------------
+inline bool fast_atof_is_separator(char c, bool multi_line) {
+    return c == ' ' || c == '\t' || (multi_line && (c == '\r' || c == '\n'));
+}
+
+inline const char *fast_atof_skip_separators(const char *in, const char *end, bool multi_line) {
+    // numbers are mostly separated by a single blank, which is not worth a vector load
+    if (in != end && fast_atof_is_separator(*in, multi_line)) {
+        ++in;
+    }
+    if (in == end || !fast_atof_is_separator(*in, multi_line)) {
+        return in;
+    }
+#ifdef AI_FAST_ATOF_SSE2
+    while (end - in >= 16) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+        __m128i separator = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t')));
+        if (multi_line) {
+            separator = _mm_or_si128(separator, _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\r')),
+                    _mm_cmpeq_epi8(chars, _mm_set1_epi8('\n'))));
+        }
+        const unsigned int other = ~static_cast<unsigned int>(_mm_movemask_epi8(separator)) & 0xffffu;
+        if (0 != other) {
+            return in + fast_atof_lowest_bit(other);
+        }
+        in += 16;
+    }
+#endif
+    while (in != end && fast_atof_is_separator(*in, multi_line)) {
+        ++in;
+    }
+    return in;
+}
+
+#ifdef AI_FAST_ATOF_SSE2
+// ------------------------------------------------------------------------------------
+// Converts the token at in if it is a plain number with at most 8 integer and 8 decimal
+// digits that ends within 16 bytes; end - in must be at least 24. Returns the length of
+// the token, 0 if it was not converted. The token is classified with a single load, so
+// finding the next token does not have to wait for the digits to be converted.
+// ------------------------------------------------------------------------------------
+template<typename Real>
+inline unsigned int fast_atoreal_window(const char *in, Real &out, bool multi_line) {
+    const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+    const __m128i d = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const unsigned int digit = static_cast<unsigned int>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpgt_epi8(d, _mm_set1_epi8(-1)), _mm_cmplt_epi8(d, _mm_set1_epi8(10)))));
+    __m128i end = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\n'))));
+    end = _mm_or_si128(end, _mm_cmpeq_epi8(chars, _mm_setzero_si128()));
+    if (!multi_line) {
+        end = _mm_or_si128(end, _mm_cmpeq_epi8(chars, _mm_set1_epi8('\f')));
+    }
+    const unsigned int terminator = static_cast<unsigned int>(_mm_movemask_epi8(end));
+    if (0 == terminator) {
+        return 0;
+    }
+
+    const unsigned int length = fast_atof_lowest_bit(terminator);
+    const unsigned int token = (1u << length) - 1;
+    const unsigned int sign = (*in == '-' || *in == '+') ? 1u : 0u;
+    const unsigned int dot = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('.')))) & token;
+    // everything behind the sign is a digit, apart from at most one dot
+    if ((digit & token) != (token & ~dot & ~sign) || 0 != (dot & (dot - 1))) {
+        return 0;
+    }
+    const unsigned int intEnd = 0 != dot ? fast_atof_lowest_bit(dot) : length;
+    const unsigned int digits = intEnd - sign;
+    const unsigned int decimals = 0 != dot ? length - intEnd - 1 : 0;
+    if (0 == digits || digits > 8 || decimals > 8) {
+        return 0;
+    }
+
+    uint64_t chunk;
+    ::memcpy(&chunk, in + sign, sizeof(chunk));
+    Real f = static_cast<Real>(fast_atoi_convert8(chunk, digits));
+    if (0 != decimals) {
+        ::memcpy(&chunk, in + intEnd + 1, sizeof(chunk));
+        f += static_cast<Real>(static_cast<double>(fast_atoi_convert8(chunk, decimals)) * fast_atof_table[decimals]);
+    }
+    out = (*in == '-') ? -f : f;
+    return length;
+}
+#endif
+
+// ------------------------------------------------------------------------------------
+// Converts the plain decimal number at in and returns the end of it, or nullptr if the
+// token is something fast_atoreal_move() has to decide about.
+// ------------------------------------------------------------------------------------
+template<typename Real>
+inline const char *fast_atoreal_plain(const char *in, const char *end, Real &out, bool multi_line) {
+    const char *c = in;
+    const bool inv = (*c == '-');
+    if (inv || *c == '+') {
+        ++c;
+    }
+
+    Real f = 0;
+    uint64_t value = 0;
+    unsigned int digits = 0;
+    if (c != end && *c != '.') {
+        digits = strtoul10_run(c, end, value);
+        c += digits;
+        if (0 == digits || (c != end && *c >= '0' && *c <= '9')) {
+            return nullptr;
+        }
+        f = static_cast<Real>(value);
+    }
+
+    if (c != end && *c == '.') {
+        ++c;
+        const unsigned int decimals = strtoul10_run(c, end, value, AI_FAST_ATOF_RELAVANT_DECIMALS);
+        if (0 != decimals) {
+            c += decimals;
+            while (c != end && *c >= '0' && *c <= '9') {
+                ++c;
+            }
+            f += static_cast<Real>(static_cast<double>(value) * fast_atof_table[decimals]);
+        } else if (0 == digits) {
+            return nullptr;
+        }
+    }
+
+    if (c != end && (*c == 'e' || *c == 'E')) {
+        ++c;
+        const bool einv = (c != end && *c == '-');
+        if (c != end && (einv || *c == '+')) {
+            ++c;
+        }
+        const unsigned int expDigits = strtoul10_run(c, end, value);
+        c += expDigits;
+        if (0 == expDigits || (c != end && *c >= '0' && *c <= '9')) {
+            return nullptr;
+        }
+        Real exp = static_cast<Real>(value);
+        if (einv) {
+            exp = -exp;
+        }
+        f *= std::pow(static_cast<Real>(10.0), exp);
+    }
+
+    // the number has to end here
+    if (c != end && *c != ' ' && *c != '\t' && *c != '\r' && *c != '\n' && *c != '\0' && (multi_line || *c != '\f')) {
+        return nullptr;
+    }
+
+    out = inv ? -f : f;
+    return c;
+}
+
+// ------------------------------------------------------------------------------------
+//! Converts up to count blank-separated numbers from [in, end) into out and returns how
+//! many were converted. With multi_line the numbers may also be separated by line
+//! breaks, otherwise a line break ends the batch. The batch also stops in front of any
+//! token that is not a plain decimal number (nan, inf, decimal commas, more than 19
+//! integer digits, trailing characters, ...), so the caller can hand it to
+//! fast_atoreal_move(), which also reports the errors. in is left behind the last
+//! converted number or at the start of the token that was not converted.
+// ------------------------------------------------------------------------------------
+template<typename Real>
+inline size_t fast_atoreal_n(const char *&in, const char *end, Real *out, size_t count, bool multi_line = true) {
+    const char *c = in;
+    size_t parsed = 0;
+    while (parsed < count) {
+        c = fast_atof_skip_separators(c, end, multi_line);
+        if (c == end) {
+            break;
+        }
+
+#ifdef AI_FAST_ATOF_SSE2
+        if (end - c >= 24) {
+            const unsigned int length = fast_atoreal_window(c, out[parsed], multi_line);
+            if (0 != length) {
+                ++parsed;
+                c += length;
+                continue;
+            }
+        }
+#endif
+        const char *next = fast_atoreal_plain(c, end, out[parsed], multi_line);
+        if (nullptr == next) {
+            break;
+        }
+        ++parsed;
+        c = next;
+    }
+    in = c;
+    return parsed;
+}
+
 } //! namespace Assimp
 
 #endif // FAST_A_TO_F_H_INCLUDED
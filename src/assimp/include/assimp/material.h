@@ -963,6 +963,17 @@ public:
     static void CopyPropertyList(aiMaterial *pcDest,
             const aiMaterial *pcSrc);
 
+    // ------------------------------------------------------------------------------
+    /** @brief Builds a lookup index for the properties, so retrieving one
+     *  no longer scans the whole list.
+     *
+     *  The importer builds the index for all materials of an imported scene.
+     *  All members modifying the property list drop it again. If mProperties
+     *  is modified directly, lookups fall back to scanning as long as the
+     *  array or the number of properties differs; call this again after
+     *  other direct modifications. */
+    void BuildPropertyIndex();
+
 #endif
 
     /** List of all material properties loaded. */
@@ -973,6 +984,13 @@ public:
 
     /** Storage allocated */
     unsigned int mNumAllocated;
+
+    /**  Internal data, do not touch */
+#ifdef __cplusplus
+    void* mPrivate;
+#else
+    char* mPrivate;
+#endif
 };
 
 // Go back to extern "C" again
@@ -59,7 +59,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/types.h>
 
 #ifdef __cplusplus
+#include <algorithm>
+#include <functional>
+#include <memory>
 #include <unordered_set>
+#include <vector>
 
 extern "C" {
 #endif
@@ -141,6 +145,8 @@ struct aiFace {
     unsigned int mNumIndices;
 
     //! Pointer to the indices array. Size of the array is given in numIndices.
+    //! The array may be part of the index pool of the owning mesh,
+    //! see aiMesh::AllocateFaceIndices().
     unsigned int *mIndices;
 
 #ifdef __cplusplus
@@ -616,6 +622,107 @@ enum aiMorphingMethod {
 #endif
 }; //! enum aiMorphingMethod
 
+#ifdef __cplusplus
+// ---------------------------------------------------------------------------
+/** @brief Storage for the index arrays of the faces of a mesh.
+ *
+ *  Index arrays handed out by aiMesh::AllocateFaceIndices() are carved out of
+ *  a few large blocks instead of being allocated one per face. The blocks are
+ *  reference counted, so post-processing steps can move pooled faces to other
+ *  meshes (see aiMesh::ShareFaceIndices()). Used by aiMesh only.
+ */
+class aiFaceIndexPool {
+public:
+    //! @brief Returns room for numIndices indices, which must not be 0.
+    unsigned int *Allocate(size_t numIndices) {
+        if (numIndices > mFree) {
+            // grow geometrically, so a mesh filled face by face ends up in few blocks
+            const size_t size = std::max(numIndices, std::max(mAllocated, static_cast<size_t>(MinBlockSize)));
+            Block block;
+            block.mData.reset(new unsigned int[size], std::default_delete<unsigned int[]>());
+            block.mSize = size;
+            Insert(block);
+
+            mNext = block.mData.get();
+            mFree = size;
+            mAllocated += size;
+        }
+        unsigned int *indices = mNext;
+        mNext += numIndices;
+        mFree -= numIndices;
+        return indices;
+    }
+
+    //! @brief Checks whether an index array lives in one of the blocks.
+    bool Contains(const unsigned int *indices) const {
+        return nullptr != Find(indices);
+    }
+
+    //! @brief Clears the index arrays of those faces which live in one of the
+    //!        blocks, so deleting the faces leaves them to the pool.
+    void DetachFaces(aiFace *faces, unsigned int numFaces) const {
+        const std::less<const unsigned int *> less;
+        const Block *last = nullptr;
+        for (unsigned int i = 0; i < numFaces; ++i) {
+            const unsigned int *indices = faces[i].mIndices;
+            if (nullptr == indices) {
+                continue;
+            }
+            // consecutive faces mostly share a block, only search on a miss
+            if (nullptr == last || less(indices, last->mData.get()) || !less(indices, last->mData.get() + last->mSize)) {
+                const Block *block = Find(indices);
+                if (nullptr == block) {
+                    continue;
+                }
+                last = block;
+            }
+            faces[i].mIndices = nullptr;
+        }
+    }
+
+    //! @brief Adds references to all blocks of another pool.
+    void Share(const aiFaceIndexPool &other) {
+        for (const Block &block : other.mBlocks) {
+            if (!Contains(block.mData.get())) {
+                Insert(block);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t MinBlockSize = 1024;
+
+    struct Block {
+        std::shared_ptr<unsigned int> mData;
+        size_t mSize = 0;
+    };
+
+    // blocks are kept sorted by address for Find()
+    const Block *Find(const unsigned int *indices) const {
+        const std::less<const unsigned int *> less;
+        std::vector<Block>::const_iterator it = std::upper_bound(mBlocks.begin(), mBlocks.end(), indices,
+                [&less](const unsigned int *p, const Block &block) { return less(p, block.mData.get()); });
+        if (it == mBlocks.begin()) {
+            return nullptr;
+        }
+        --it;
+        return less(indices, it->mData.get() + it->mSize) ? &*it : nullptr;
+    }
+
+    void Insert(const Block &block) {
+        const std::less<const unsigned int *> less;
+        std::vector<Block>::iterator it = std::upper_bound(mBlocks.begin(), mBlocks.end(), block,
+                [&less](const Block &a, const Block &b) { return less(a.mData.get(), b.mData.get()); });
+        mBlocks.insert(it, block);
+    }
+
+    std::vector<Block> mBlocks;
+    unsigned int *mNext = nullptr;
+    size_t mFree = 0;
+    size_t mAllocated = 0;
+};
+#endif // __cplusplus
+
 // ---------------------------------------------------------------------------
 /** @brief A mesh represents a geometry or model with a single material.
  *
@@ -826,6 +933,16 @@ struct aiMesh {
      */
     C_STRUCT aiString **mTextureCoordsNames;
 
+    /**
+     * Internal data, do not touch. Holds the pooled face index arrays,
+     * see AllocateFaceIndices().
+     */
+#ifdef __cplusplus
+    void *mPrivate;
+#else
+    char *mPrivate;
+#endif
+
 #ifdef __cplusplus
 
     //! The default class constructor.
@@ -848,7 +965,8 @@ struct aiMesh {
               mAnimMeshes(nullptr),
               mMethod(aiMorphingMethod_UNKNOWN),
               mAABB(),
-              mTextureCoordsNames(nullptr) {
+              mTextureCoordsNames(nullptr),
+              mPrivate(nullptr) {
         // empty
     }
 
@@ -894,9 +1012,66 @@ struct aiMesh {
             delete[] mAnimMeshes;
         }
 
+        // pooled index arrays are owned by the pool, not by their faces
+        if (mPrivate) {
+            if (mFaces) {
+                static_cast<aiFaceIndexPool *>(mPrivate)->DetachFaces(mFaces, mNumFaces);
+            }
+            delete static_cast<aiFaceIndexPool *>(mPrivate);
+        }
+
         delete[] mFaces;
     }
 
+    //! @brief Allocates the index array for one or more faces of this mesh.
+    //!
+    //! The array is carved out of a block owned by the mesh, which saves one
+    //! heap allocation per face. Importers that know all face sizes in advance
+    //! should request the total number of indices at once and hand out
+    //! consecutive ranges of it. A pooled array must not be deleted through
+    //! its face, use ReleaseFaceIndices() to drop single faces.
+    //! @param numIndices Number of indices to allocate.
+    //! @return The index array, nullptr if numIndices is 0.
+    unsigned int *AllocateFaceIndices(size_t numIndices) {
+        if (0 == numIndices) {
+            return nullptr;
+        }
+        if (nullptr == mPrivate) {
+            mPrivate = new aiFaceIndexPool();
+        }
+        return static_cast<aiFaceIndexPool *>(mPrivate)->Allocate(numIndices);
+    }
+
+    //! @brief Checks whether an index array was allocated by AllocateFaceIndices()
+    //!        of this mesh or shared with it by ShareFaceIndices().
+    bool IsPooledFaceIndices(const unsigned int *indices) const {
+        return nullptr != mPrivate && nullptr != indices &&
+               static_cast<const aiFaceIndexPool *>(mPrivate)->Contains(indices);
+    }
+
+    //! @brief Keeps the pooled index arrays of another mesh alive as long as
+    //!        this mesh exists. Call this before moving faces of source into
+    //!        this mesh without copying their index arrays.
+    void ShareFaceIndices(const aiMesh &source) {
+        if (nullptr == source.mPrivate || this == &source) {
+            return;
+        }
+        if (nullptr == mPrivate) {
+            mPrivate = new aiFaceIndexPool();
+        }
+        static_cast<aiFaceIndexPool *>(mPrivate)->Share(*static_cast<const aiFaceIndexPool *>(source.mPrivate));
+    }
+
+    //! @brief Frees the index array of a face of this mesh, pooled or not,
+    //!        and leaves the face empty.
+    void ReleaseFaceIndices(aiFace &face) {
+        if (!IsPooledFaceIndices(face.mIndices)) {
+            delete[] face.mIndices;
+        }
+        face.mIndices = nullptr;
+        face.mNumIndices = 0;
+    }
+
     //! @brief Check whether the mesh contains positions. Provided no special
     //!        scene flags are set, this will always be true
     //! @return true, if positions are stored, false if not.
@@ -540,6 +540,9 @@ class Material(Structure):
 
             # Storage allocated
             ("mNumAllocated", c_uint),
+
+            # Internal data, do not touch
+            ("mPrivate", POINTER(c_char)),
         ]
 
 class Bone(Structure):
@@ -777,7 +780,10 @@ class Mesh(Structure):
             ("mAABB", 2 * Vector3D),
 
             # Vertex UV stream names. Pointer to array of size AI_MAX_NUMBER_OF_TEXTURECOORDS
-            ("mTextureCoordsNames", POINTER(POINTER(String)))
+            ("mTextureCoordsNames", POINTER(POINTER(String))),
+
+            # Internal data, do not touch
+            ("mPrivate", POINTER(c_char)),
 
         ]
 
@@ -0,0 +1,219 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "SceneComparison.h"
+#include "UnitTestFileGenerator.h"
+#include "Common/ScenePrivate.h"
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+using namespace Assimp;
+
+#if !defined(ASSIMP_BUILD_NO_EXPORT) && !defined(ASSIMP_BUILD_NO_ASSBIN_EXPORTER) && !defined(ASSIMP_BUILD_NO_ASSBIN_IMPORTER) && !defined(ASSIMP_BUILD_NO_OBJ_IMPORTER)
+
+namespace {
+
+// Counts how often a file is opened
+class CountingIOSystem : public DefaultIOSystem {
+public:
+    explicit CountingIOSystem(const std::string &file) :
+            mFile(file), mCount(0) {}
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        if (mFile == pFile) {
+            ++mCount;
+        }
+        return DefaultIOSystem::Open(pFile, pMode);
+    }
+
+    std::string mFile;
+    unsigned int mCount;
+};
+
+void WriteFile(const std::string &path, const std::string &text) {
+    std::ofstream file(path.c_str(), std::ios::binary);
+    file << text;
+}
+
+std::string Material(const char *diffuse) {
+    return std::string("newmtl red\nKd ") + diffuse + "\n";
+}
+
+} // namespace
+
+class utImportCache : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // a new source for every run, so entries of earlier runs don't hit
+        mObj = TMP_PATH "importCache.obj";
+        mMtl = TMP_PATH "importCache.mtl";
+        WriteFile(mObj, "# " + std::to_string(std::random_device()()) + " " + std::to_string(std::random_device()()) + "\n"
+                        "mtllib importCache.mtl\n"
+                        "o quad\n"
+                        "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                        "usemtl red\n"
+                        "f 1 2 3 4\n");
+        WriteFile(mMtl, Material("1 0 0"));
+    }
+
+    void TearDown() override {
+        std::remove(mObj.c_str());
+        std::remove(mMtl.c_str());
+        std::error_code error;
+        std::filesystem::remove_all(Store, error);
+    }
+
+    // Imports the file with the cache, opened is set to how often the file was opened
+    static const aiScene *ImportCached(Importer &importer, const std::string &file, unsigned int flags, unsigned int &opened) {
+        CountingIOSystem *io = new CountingIOSystem(file);
+        importer.SetIOHandler(io);
+        importer.SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIR, Store);
+        const aiScene *scene = importer.ReadFile(file, flags);
+        opened = io->mCount;
+        return scene;
+    }
+
+    // Imports the file with the cache and checks it against an import without the cache
+    static void ExpectSameAsUncached(const std::string &file, unsigned int flags) {
+        Importer reference;
+        const aiScene *expected = reference.ReadFile(file, flags);
+        ASSERT_NE(nullptr, expected);
+
+        Importer importer;
+        unsigned int opened;
+        const aiScene *scene = ImportCached(importer, file, flags, opened);
+        ASSERT_NE(nullptr, scene);
+        ExpectSameScene(expected, scene);
+        EXPECT_EQ(ScenePriv(expected)->mPPStepsApplied, ScenePriv(scene)->mPPStepsApplied);
+    }
+
+    // Imports the file with the cache and returns how often it was opened
+    unsigned int Import(unsigned int flags, aiColor3D &diffuse, std::string &meshName) {
+        Importer importer;
+        unsigned int opened;
+        const aiScene *scene = ImportCached(importer, mObj, flags, opened);
+        EXPECT_NE(nullptr, scene);
+        if (nullptr == scene) {
+            return 0;
+        }
+        EXPECT_EQ(1u, scene->mNumMeshes);
+        EXPECT_EQ(4u, scene->mMeshes[0]->mNumVertices);
+        EXPECT_EQ((flags & aiProcess_Triangulate) ? 2u : 1u, scene->mMeshes[0]->mNumFaces);
+        meshName = scene->mMeshes[0]->mName.C_Str();
+        scene->mMaterials[scene->mMeshes[0]->mMaterialIndex]->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);
+        EXPECT_NE(nullptr, scene->mMetaData);
+        return opened;
+    }
+
+    static constexpr const char *Store = TMP_PATH "importCacheStore";
+
+    std::string mObj;
+    std::string mMtl;
+};
+
+TEST_F(utImportCache, hitAfterMissTest) {
+    aiColor3D diffuse;
+    std::string meshName;
+    EXPECT_LT(1u, Import(aiProcess_Triangulate, diffuse, meshName));
+    EXPECT_EQ(aiColor3D(1, 0, 0), diffuse);
+    EXPECT_EQ("quad", meshName);
+
+    // the cached scene is loaded after hashing the source once
+    aiColor3D cachedDiffuse;
+    std::string cachedMeshName;
+    EXPECT_EQ(1u, Import(aiProcess_Triangulate, cachedDiffuse, cachedMeshName));
+    EXPECT_EQ(diffuse, cachedDiffuse);
+    EXPECT_EQ(meshName, cachedMeshName);
+    ExpectSameAsUncached(mObj, aiProcess_Triangulate);
+
+    // other flags are another entry
+    EXPECT_LT(1u, Import(0, diffuse, meshName));
+    EXPECT_EQ(1u, Import(0, diffuse, meshName));
+}
+
+TEST_F(utImportCache, changedDependencyTest) {
+    aiColor3D diffuse;
+    std::string meshName;
+    EXPECT_LT(1u, Import(aiProcess_Triangulate, diffuse, meshName));
+    EXPECT_EQ(1u, Import(aiProcess_Triangulate, diffuse, meshName));
+
+    // a changed material library is imported again
+    WriteFile(mMtl, Material("0 1 0"));
+    EXPECT_LT(1u, Import(aiProcess_Triangulate, diffuse, meshName));
+    EXPECT_EQ(aiColor3D(0, 1, 0), diffuse);
+    EXPECT_EQ(1u, Import(aiProcess_Triangulate, diffuse, meshName));
+    EXPECT_EQ(aiColor3D(0, 1, 0), diffuse);
+}
+
+TEST_F(utImportCache, renamedCopyTest) {
+    aiColor3D diffuse;
+    std::string meshName;
+    EXPECT_LT(1u, Import(aiProcess_Triangulate, diffuse, meshName));
+
+    // the importer names the root node after the file, so a copy under another name is
+    // another entry, even with the same contents and dependencies
+    const std::string copy = TMP_PATH "importCacheRenamed.obj";
+    {
+        std::ifstream source(mObj.c_str(), std::ios::binary);
+        std::ofstream target(copy.c_str(), std::ios::binary);
+        target << source.rdbuf();
+    }
+    Importer importer;
+    unsigned int opened;
+    const aiScene *scene = ImportCached(importer, copy, aiProcess_Triangulate, opened);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_LT(1u, opened);
+    EXPECT_STREQ("importCacheRenamed.obj", scene->mRootNode->mName.C_Str());
+    ExpectSameAsUncached(copy, aiProcess_Triangulate);
+    std::remove(copy.c_str());
+}
+
+#endif
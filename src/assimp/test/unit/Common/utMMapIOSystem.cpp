@@ -0,0 +1,149 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+#include "SceneComparison.h"
+
+#include <assimp/BaseImporter.h>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/Importer.hpp>
+#include <assimp/MMapIOSystem.h>
+#include <assimp/scene.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Assimp;
+
+class utMMapIOSystem : public ::testing::Test {
+protected:
+    // Imports the file once through the default IOSystem and once through the mapped one
+    // and checks that both produce the same scene.
+    void ExpectSameImport(const char *file) {
+        Importer reference;
+        const aiScene *expected = reference.ReadFile(file, 0);
+        ASSERT_NE(nullptr, expected) << file;
+
+        Importer mapped;
+        mapped.SetIOHandler(new MMapIOSystem);
+        const aiScene *scene = mapped.ReadFile(file, 0);
+        ASSERT_NE(nullptr, scene) << file;
+
+        SCOPED_TRACE(file);
+        ExpectSameScene(expected, scene);
+    }
+};
+
+TEST_F(utMMapIOSystem, mappedStreamMatchesDefaultStreamTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl";
+    DefaultIOSystem defaultIO;
+    MMapIOSystem mappedIO;
+    std::unique_ptr<IOStream> reference(defaultIO.Open(file, "rb"));
+    std::unique_ptr<IOStream> stream(mappedIO.Open(file, "rb"));
+    ASSERT_NE(nullptr, reference);
+    ASSERT_NE(nullptr, stream);
+
+    const size_t size = reference->FileSize();
+    ASSERT_EQ(size, stream->FileSize());
+    ASSERT_NE(nullptr, stream->GetMappedData());
+    EXPECT_EQ(nullptr, reference->GetMappedData());
+
+    std::vector<uint8_t> expected(size), actual(size);
+    ASSERT_EQ(size, reference->Read(expected.data(), 1, size));
+    EXPECT_EQ(0, std::memcmp(expected.data(), stream->GetMappedData(), size));
+
+    // element-wise reads stop at the end of the file, like DefaultIOStream
+    ASSERT_EQ(aiReturn_SUCCESS, stream->Seek(80, aiOrigin_SET));
+    EXPECT_EQ(80u, stream->Tell());
+    EXPECT_EQ((size - 80) / 50, stream->Read(actual.data(), 50, size));
+    EXPECT_EQ(0, std::memcmp(expected.data() + 80, actual.data(), (size - 80) / 50 * 50));
+    EXPECT_EQ(aiReturn_FAILURE, stream->Seek(size + 1, aiOrigin_SET));
+    EXPECT_EQ(0u, stream->Write(expected.data(), 1, 1));
+}
+
+TEST_F(utMMapIOSystem, writeModeFallsBackToDefaultStreamTest) {
+    MMapIOSystem io;
+    const char *file = "utMMapIOSystem_out.txt";
+    std::unique_ptr<IOStream> out(io.Open(file, "wb"));
+    ASSERT_NE(nullptr, out);
+    EXPECT_EQ(nullptr, out->GetMappedData());
+    EXPECT_EQ(4u, out->Write("test", 1, 4));
+    out.reset();
+
+    std::unique_ptr<IOStream> in(io.Open(file, "rb"));
+    ASSERT_NE(nullptr, in);
+    EXPECT_EQ(4u, in->FileSize());
+    in.reset();
+    io.DeleteFile(file);
+
+    EXPECT_EQ(nullptr, io.Open(ASSIMP_TEST_MODELS_DIR "/does_not_exist.stl", "rb"));
+}
+
+TEST_F(utMMapIOSystem, textFileToBufferStartsAtStreamPositionTest) {
+    const char *file = ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj";
+    MMapIOSystem io;
+    std::unique_ptr<IOStream> stream(io.Open(file, "rb"));
+    ASSERT_NE(nullptr, stream);
+    ASSERT_NE(nullptr, stream->GetMappedData());
+
+    const size_t size = stream->FileSize();
+    const std::string expected(reinterpret_cast<const char *>(stream->GetMappedData()) + 16, size - 16);
+    ASSERT_EQ(aiReturn_SUCCESS, stream->Seek(16, aiOrigin_SET));
+
+    std::vector<char> buffer;
+    BaseImporter::TextFileToBuffer(stream.get(), buffer);
+    ASSERT_EQ(size - 16 + 1, buffer.size());
+    EXPECT_EQ(expected, std::string(buffer.data()));
+    EXPECT_EQ(size, stream->Tell());
+}
+
+TEST_F(utMMapIOSystem, importsMatchDefaultIOSystemTest) {
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/PLY/cube_binary.ply");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/PLY/cube.ply");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/FBX/box.fbx");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj");
+    ExpectSameImport(ASSIMP_TEST_MODELS_DIR "/3DS/RotatingCube.3DS");
+}
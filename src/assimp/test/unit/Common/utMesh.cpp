@@ -95,3 +95,76 @@ TEST_F(utMesh, setTextureCoordsName) {
   EXPECT_EQ(nullptr, mesh->GetTextureCoordsName(0));
 }
 
+
+TEST_F(utMesh, pooledFaceIndices) {
+  EXPECT_EQ(nullptr, mesh->AllocateFaceIndices(0));
+
+  static const unsigned int NumFaces = 1000;
+  mesh->mNumFaces = NumFaces;
+  mesh->mFaces = new aiFace[NumFaces];
+  for (unsigned int i = 0; i < NumFaces; ++i) {
+    aiFace &face = mesh->mFaces[i];
+    face.mNumIndices = 3;
+    face.mIndices = mesh->AllocateFaceIndices(3);
+    for (unsigned int j = 0; j < 3; ++j) {
+      face.mIndices[j] = 3 * i + j;
+    }
+  }
+  for (unsigned int i = 0; i < NumFaces; ++i) {
+    EXPECT_TRUE(mesh->IsPooledFaceIndices(mesh->mFaces[i].mIndices));
+    EXPECT_EQ(3 * i + 2, mesh->mFaces[i].mIndices[2]);
+  }
+
+  // faces of the same mesh may mix pooled and own arrays
+  mesh->ReleaseFaceIndices(mesh->mFaces[0]);
+  EXPECT_EQ(nullptr, mesh->mFaces[0].mIndices);
+  EXPECT_EQ(0u, mesh->mFaces[0].mNumIndices);
+  mesh->mFaces[0].mNumIndices = 3;
+  mesh->mFaces[0].mIndices = new unsigned int[3]{ 0, 1, 2 };
+  EXPECT_FALSE(mesh->IsPooledFaceIndices(mesh->mFaces[0].mIndices));
+
+  // a copy of a pooled face owns its indices
+  const aiFace copy(mesh->mFaces[1]);
+  EXPECT_FALSE(mesh->IsPooledFaceIndices(copy.mIndices));
+  EXPECT_TRUE(copy == mesh->mFaces[1]);
+}
+
+TEST_F(utMesh, sharedFaceIndicesOutliveTheirMesh) {
+  aiMesh *source = new aiMesh;
+  unsigned int *indices = source->AllocateFaceIndices(3);
+  for (unsigned int j = 0; j < 3; ++j) {
+    indices[j] = j;
+  }
+
+  mesh->ShareFaceIndices(*source);
+  delete source;
+
+  mesh->mNumFaces = 1;
+  mesh->mFaces = new aiFace[1];
+  mesh->mFaces[0].mNumIndices = 3;
+  mesh->mFaces[0].mIndices = indices;
+  EXPECT_TRUE(mesh->IsPooledFaceIndices(indices));
+  EXPECT_EQ(2u, mesh->mFaces[0].mIndices[2]);
+}
+
+TEST_F(utMesh, detachFacesKeepsOwnArrays) {
+  aiFaceIndexPool pool;
+  unsigned int *first = pool.Allocate(3);
+  // does not fit into the first block
+  unsigned int *second = pool.Allocate(4096);
+  unsigned int *own = new unsigned int[3]{ 0, 1, 2 };
+
+  aiFace *faces = new aiFace[4];
+  faces[0].mIndices = first;
+  faces[1].mIndices = own;
+  faces[2].mIndices = second;
+  faces[3].mIndices = first + 1;
+  pool.DetachFaces(faces, 4);
+  EXPECT_EQ(nullptr, faces[0].mIndices);
+  EXPECT_EQ(own, faces[1].mIndices);
+  EXPECT_EQ(nullptr, faces[2].mIndices);
+  EXPECT_EQ(nullptr, faces[3].mIndices);
+
+  // only the own array is deleted with the faces
+  delete[] faces;
+}
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 
+#include <assimp/SGSpatialSort.h>
 #include <assimp/SpatialSort.h>
 
 using namespace Assimp;
@@ -118,3 +119,92 @@ TEST_F(utSpatialSort, highlyDisplacedPositionsTest) {
     }
     delete[] positions;
 }
+
+TEST_F(utSpatialSort, smallSetsStayOnPlaneTest) {
+    SpatialSort sSort;
+    sSort.Fill(vecs, 100, sizeof(aiVector3D));
+    EXPECT_EQ(SpatialSortBackend::Plane, sSort.GetBackend());
+}
+
+// A floor plan: a 64x64 lattice in the z=0 plane, every position used by three faces
+static std::vector<aiVector3D> MakeLattice() {
+    std::vector<aiVector3D> positions;
+    for (unsigned int copy = 0; copy < 3; ++copy) {
+        for (unsigned int y = 0; y < 64; ++y) {
+            for (unsigned int x = 0; x < 64; ++x) {
+                positions.emplace_back(x * 0.25f, y * 0.25f, 0.f);
+            }
+        }
+    }
+    return positions;
+}
+
+TEST_F(utSpatialSort, gridMatchesPlaneTest) {
+    const std::vector<aiVector3D> positions = MakeLattice();
+    const unsigned int numPositions = static_cast<unsigned int>(positions.size());
+
+    SpatialSort plane, grid, automatic;
+    plane.SetBackend(SpatialSortBackend::Plane);
+    plane.Fill(positions.data(), numPositions, sizeof(aiVector3D));
+    grid.SetBackend(SpatialSortBackend::Grid);
+    grid.Fill(positions.data(), numPositions, sizeof(aiVector3D));
+    automatic.Fill(positions.data(), numPositions, sizeof(aiVector3D));
+    EXPECT_EQ(SpatialSortBackend::Plane, plane.GetBackend());
+    EXPECT_EQ(SpatialSortBackend::Grid, grid.GetBackend());
+    EXPECT_EQ(SpatialSortBackend::Grid, automatic.GetBackend());
+
+    std::vector<unsigned int> expected, found;
+    for (unsigned int i = 0; i < numPositions; i += 7) {
+        // the copies, then the copies and four neighbours
+        for (const ai_real radius : { 0.01f, 0.3f }) {
+            plane.FindPositions(positions[i], radius, expected);
+            grid.FindPositions(positions[i], radius, found);
+            ASSERT_EQ(expected, found);
+        }
+        EXPECT_EQ(15u, expected.size() + (positions[i].x == 0.f || positions[i].x == 15.75f ? 3u : 0u) +
+                               (positions[i].y == 0.f || positions[i].y == 15.75f ? 3u : 0u));
+
+        plane.FindIdenticalPositions(positions[i], expected);
+        grid.FindIdenticalPositions(positions[i], found);
+        ASSERT_EQ(3u, expected.size());
+        ASSERT_EQ(expected, found);
+    }
+
+    // a radius spanning most of the grid falls back to the plane
+    plane.FindPositions(positions[0], 10.f, expected);
+    grid.FindPositions(positions[0], 10.f, found);
+    EXPECT_EQ(expected, found);
+
+    // positions away from all others
+    grid.FindPositions(aiVector3D(-5.f, 0.f, 0.f), 0.3f, found);
+    EXPECT_TRUE(found.empty());
+}
+
+TEST_F(utSpatialSort, sgGridMatchesPlaneTest) {
+    const std::vector<aiVector3D> positions = MakeLattice();
+
+    SGSpatialSort plane, grid;
+    plane.SetBackend(SpatialSortBackend::Plane);
+    grid.SetBackend(SpatialSortBackend::Grid);
+    for (unsigned int i = 0; i < positions.size(); ++i) {
+        // each copy in its own smoothing group, some in none
+        const unsigned int smoothGroup = (i % 5 == 0) ? 0u : 1u << (i / 4096);
+        plane.Add(positions[i], i, smoothGroup);
+        grid.Add(positions[i], i, smoothGroup);
+    }
+    plane.Prepare();
+    grid.Prepare();
+    EXPECT_EQ(SpatialSortBackend::Plane, plane.GetBackend());
+    EXPECT_EQ(SpatialSortBackend::Grid, grid.GetBackend());
+
+    std::vector<unsigned int> expected, found;
+    for (unsigned int i = 0; i < positions.size(); i += 5) {
+        for (const uint32_t smoothGroup : { 0u, 1u, 2u, 3u }) {
+            for (const bool exactMatch : { false, true }) {
+                plane.FindPositions(positions[i], smoothGroup, 0.3f, expected, exactMatch);
+                grid.FindPositions(positions[i], smoothGroup, 0.3f, found, exactMatch);
+                ASSERT_EQ(expected, found);
+            }
+        }
+    }
+}
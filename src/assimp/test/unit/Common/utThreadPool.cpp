@@ -0,0 +1,143 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "UnitTestPCH.h"
+
+#include "Common/ThreadPool.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace Assimp;
+
+class utThreadPool : public ::testing::Test {};
+
+TEST_F(utThreadPool, parallelForVisitsEveryItemOnceTest) {
+    ThreadPool pool(4);
+    EXPECT_EQ(4u, pool.GetNumThreads());
+
+    std::vector<std::atomic<int>> visits(1000);
+    for (auto &v : visits) {
+        v = 0;
+    }
+    pool.ParallelFor(visits.size(), [&](size_t i) { ++visits[i]; });
+    for (size_t i = 0; i < visits.size(); ++i) {
+        EXPECT_EQ(1, visits[i].load());
+    }
+
+    // the pool is reusable
+    std::atomic<size_t> sum(0);
+    pool.ParallelFor(100, [&](size_t i) { sum += i; });
+    EXPECT_EQ(4950u, sum.load());
+}
+
+TEST_F(utThreadPool, exceptionIsRethrownTest) {
+    ThreadPool pool(3);
+    EXPECT_THROW(pool.ParallelFor(64, [](size_t i) {
+        if (i == 17) {
+            throw std::runtime_error("item failed");
+        }
+    }), std::runtime_error);
+
+    // and the pool still works afterwards
+    std::atomic<int> count(0);
+    pool.ParallelFor(10, [&](size_t) { ++count; });
+    EXPECT_EQ(10, count.load());
+}
+
+TEST_F(utThreadPool, nestedParallelForRunsInlineTest) {
+    ThreadPool pool(4);
+    std::atomic<int> count(0);
+    pool.ParallelFor(8, [&](size_t) {
+        pool.ParallelFor(8, [&](size_t) { ++count; });
+    });
+    EXPECT_EQ(64, count.load());
+}
+
+TEST_F(utThreadPool, resolveNumThreadsTest) {
+    EXPECT_EQ(3u, ThreadPool::ResolveNumThreads(3));
+    EXPECT_GE(ThreadPool::ResolveNumThreads(0), 1u);
+    EXPECT_GE(ThreadPool::ResolveNumThreads(-1), 1u);
+}
+
+static const unsigned int MeshLocalFlags = aiProcess_Triangulate | aiProcess_GenSmoothNormals |
+        aiProcess_CalcTangentSpace | aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality;
+
+TEST_F(utThreadPool, parallelPostProcessingMatchesSerialTest) {
+    Importer serial;
+    const aiScene *expected = serial.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", MeshLocalFlags);
+    ASSERT_NE(nullptr, expected);
+    ASSERT_GT(expected->mNumMeshes, 1u);
+
+    Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 4);
+    const aiScene *actual = parallel.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", MeshLocalFlags | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, actual);
+    ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+
+    for (unsigned int m = 0; m < expected->mNumMeshes; ++m) {
+        const aiMesh *a = expected->mMeshes[m];
+        const aiMesh *b = actual->mMeshes[m];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        ASSERT_EQ(a->HasTangentsAndBitangents(), b->HasTangentsAndBitangents());
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+            EXPECT_EQ(a->mNormals[v], b->mNormals[v]);
+            if (a->HasTangentsAndBitangents()) {
+                EXPECT_EQ(a->mTangents[v], b->mTangents[v]);
+            }
+        }
+        for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+            ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+            for (unsigned int i = 0; i < a->mFaces[f].mNumIndices; ++i) {
+                EXPECT_EQ(a->mFaces[f].mIndices[i], b->mFaces[f].mIndices[i]);
+            }
+        }
+    }
+}
@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/XmlParser.h>
 #include <assimp/DefaultIOStream.h>
 #include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryIOWrapper.h>
 
 using namespace Assimp;
 
@@ -84,3 +85,80 @@ TEST_F(utXmlParser, parse_xml_and_traverse_test) {
         EXPECT_FALSE(nodeName.empty());
     }
 }
+
+TEST_F(utXmlParser, getValueAsText_test) {
+    static const char xml[] = "<root><float_array count=\"3\">\n  1 2.5 -3\n</float_array><p/></root>";
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml), sizeof(xml) - 1);
+    XmlParser parser;
+    ASSERT_TRUE(parser.parse(&stream));
+    XmlNode root = parser.getRootNode().child("root");
+
+    // the text is trimmed and points into the parsed document
+    XmlNode floatArray = root.child("float_array");
+    const char *begin = nullptr, *end = nullptr;
+    ASSERT_TRUE(XmlParser::getValueAsText(floatArray, begin, end));
+    EXPECT_EQ("1 2.5 -3", std::string(begin, end));
+    std::string copy;
+    ASSERT_TRUE(XmlParser::getValueAsString(floatArray, copy));
+    EXPECT_EQ(copy, std::string(begin, end));
+
+    XmlNode empty = root.child("p");
+    ASSERT_TRUE(XmlParser::getValueAsText(empty, begin, end));
+    EXPECT_EQ(begin, end);
+
+    XmlNode missing = root.child("source");
+    EXPECT_FALSE(XmlParser::getValueAsText(missing, begin, end));
+}
+
+TEST_F(utXmlParser, pullReader_test) {
+    static const char xml[] = "<?xml version=\"1.0\"?>\n<!-- <a> -->"
+                              "<root a=\"x>y\" b='2'><float_array count=\"6\">0.5 1 2 3 4 12345.678</float_array>"
+                              "<p/><![CDATA[<c>]]></root>";
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml), sizeof(xml) - 1);
+    // a tiny window, so texts and tags span several chunks
+    XmlPullReader reader(&stream, 16);
+    ASSERT_TRUE(reader.isUtf8());
+
+    std::string events, values, raw;
+    bool inArray = false;
+    const char *begin = nullptr, *end = nullptr;
+    for (XmlPullReader::Event event = reader.next(); event != XmlPullReader::EndOfDocument; event = reader.next()) {
+        reader.getRaw(begin, end);
+        raw.append(begin, end);
+        switch (event) {
+        case XmlPullReader::StartElement:
+            events += "<" + reader.getName() + (reader.isEmptyElement() ? "/" : "") + ">";
+            inArray = reader.getName() == "float_array";
+            if (reader.getName() == "root") {
+                std::string value;
+                EXPECT_TRUE(reader.getAttribute("a", value));
+                EXPECT_EQ("x>y", value);
+                EXPECT_TRUE(reader.getAttribute("b", value));
+                EXPECT_EQ("2", value);
+                EXPECT_FALSE(reader.getAttribute("c", value));
+            }
+            break;
+        case XmlPullReader::EndElement:
+            events += "</" + reader.getName() + ">";
+            inArray = false;
+            break;
+        case XmlPullReader::Text:
+            if (inArray) {
+                // a piece never splits a number
+                EXPECT_TRUE(end[-1] == ' ' || *end == '<');
+                values.append(begin, end);
+            } else {
+                events += "T";
+            }
+            break;
+        default:
+            events += "M";
+            break;
+        }
+    }
+
+    EXPECT_EQ("MTM<root><float_array></float_array><p/></p>M</root>", events);
+    EXPECT_EQ("0.5 1 2 3 4 12345.678", values);
+    // the raw ranges add up to the whole file
+    EXPECT_EQ(std::string(xml), raw);
+}
@@ -0,0 +1,211 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#pragma once
+
+#include "UnitTestPCH.h"
+
+#include <assimp/metadata.h>
+#include <assimp/scene.h>
+
+#include <cstring>
+
+namespace Assimp {
+
+// ------------------------------------------------------------------------------------------------
+// Expects both meshes to carry the same vertex streams and faces, bit for bit. Names are
+// left to ExpectSameScene(), not every format stores them.
+inline void ExpectSameMesh(const aiMesh *expected, const aiMesh *mesh) {
+    ASSERT_NE(nullptr, expected);
+    ASSERT_NE(nullptr, mesh);
+    EXPECT_EQ(expected->mPrimitiveTypes, mesh->mPrimitiveTypes);
+    EXPECT_EQ(expected->mMaterialIndex, mesh->mMaterialIndex);
+    EXPECT_EQ(expected->mNumBones, mesh->mNumBones);
+
+    const unsigned int numVertices = expected->mNumVertices;
+    ASSERT_EQ(numVertices, mesh->mNumVertices);
+    ASSERT_EQ(expected->HasPositions(), mesh->HasPositions());
+    ASSERT_EQ(expected->HasNormals(), mesh->HasNormals());
+    ASSERT_EQ(expected->HasTangentsAndBitangents(), mesh->HasTangentsAndBitangents());
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        if (expected->HasPositions()) {
+            EXPECT_EQ(expected->mVertices[i], mesh->mVertices[i]) << "vertex " << i;
+        }
+        if (expected->HasNormals()) {
+            EXPECT_EQ(expected->mNormals[i], mesh->mNormals[i]) << "vertex " << i;
+        }
+        if (expected->HasTangentsAndBitangents()) {
+            EXPECT_EQ(expected->mTangents[i], mesh->mTangents[i]) << "vertex " << i;
+            EXPECT_EQ(expected->mBitangents[i], mesh->mBitangents[i]) << "vertex " << i;
+        }
+    }
+    for (unsigned int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        ASSERT_EQ(expected->HasVertexColors(c), mesh->HasVertexColors(c)) << "color set " << c;
+        for (unsigned int i = 0; expected->HasVertexColors(c) && i < numVertices; ++i) {
+            EXPECT_EQ(expected->mColors[c][i], mesh->mColors[c][i]) << "color set " << c << ", vertex " << i;
+        }
+    }
+    for (unsigned int t = 0; t < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++t) {
+        ASSERT_EQ(expected->HasTextureCoords(t), mesh->HasTextureCoords(t)) << "uv set " << t;
+        EXPECT_EQ(expected->mNumUVComponents[t], mesh->mNumUVComponents[t]) << "uv set " << t;
+        for (unsigned int i = 0; expected->HasTextureCoords(t) && i < numVertices; ++i) {
+            EXPECT_EQ(expected->mTextureCoords[t][i], mesh->mTextureCoords[t][i]) << "uv set " << t << ", vertex " << i;
+        }
+    }
+
+    ASSERT_EQ(expected->mNumFaces, mesh->mNumFaces);
+    for (unsigned int i = 0; i < expected->mNumFaces; ++i) {
+        const aiFace &a = expected->mFaces[i], &b = mesh->mFaces[i];
+        ASSERT_EQ(a.mNumIndices, b.mNumIndices) << "face " << i;
+        for (unsigned int j = 0; j < a.mNumIndices; ++j) {
+            EXPECT_EQ(a.mIndices[j], b.mIndices[j]) << "face " << i;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Expects the faces of both meshes to have the same corner positions, regardless of how the
+// vertices are shared between the faces.
+inline void ExpectSameFacePositions(const aiMesh *expected, const aiMesh *mesh) {
+    ASSERT_NE(nullptr, expected);
+    ASSERT_NE(nullptr, mesh);
+    ASSERT_EQ(expected->mNumFaces, mesh->mNumFaces);
+    for (unsigned int i = 0; i < expected->mNumFaces; ++i) {
+        const aiFace &a = expected->mFaces[i], &b = mesh->mFaces[i];
+        ASSERT_EQ(a.mNumIndices, b.mNumIndices) << "face " << i;
+        for (unsigned int j = 0; j < a.mNumIndices; ++j) {
+            EXPECT_EQ(expected->mVertices[a.mIndices[j]], mesh->mVertices[b.mIndices[j]]) << "face " << i;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void ExpectSameMetadata(const aiMetadata *expected, const aiMetadata *metadata) {
+    if (nullptr == expected || nullptr == metadata) {
+        EXPECT_EQ(expected ? expected->mNumProperties : 0u, metadata ? metadata->mNumProperties : 0u);
+        return;
+    }
+
+    ASSERT_EQ(expected->mNumProperties, metadata->mNumProperties);
+    for (unsigned int i = 0; i < expected->mNumProperties; ++i) {
+        const aiMetadataEntry &a = expected->mValues[i], &b = metadata->mValues[i];
+        EXPECT_STREQ(expected->mKeys[i].C_Str(), metadata->mKeys[i].C_Str());
+        ASSERT_EQ(a.mType, b.mType) << expected->mKeys[i].C_Str();
+        switch (a.mType) {
+        case AI_AISTRING:
+            EXPECT_STREQ(static_cast<const aiString *>(a.mData)->C_Str(), static_cast<const aiString *>(b.mData)->C_Str()) << expected->mKeys[i].C_Str();
+            break;
+        case AI_AIMETADATA:
+            ExpectSameMetadata(static_cast<const aiMetadata *>(a.mData), static_cast<const aiMetadata *>(b.mData));
+            break;
+        default: {
+            // plain values, compare their bytes
+            size_t size = 0;
+            switch (a.mType) {
+            case AI_BOOL: size = sizeof(bool); break;
+            case AI_INT32: size = sizeof(int32_t); break;
+            case AI_UINT64: size = sizeof(uint64_t); break;
+            case AI_FLOAT: size = sizeof(float); break;
+            case AI_DOUBLE: size = sizeof(double); break;
+            case AI_AIVECTOR3D: size = sizeof(aiVector3D); break;
+            case AI_INT64: size = sizeof(int64_t); break;
+            case AI_UINT32: size = sizeof(uint32_t); break;
+            default: break;
+            }
+            EXPECT_EQ(0, std::memcmp(a.mData, b.mData, size)) << expected->mKeys[i].C_Str();
+            break;
+        }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void ExpectSameNodes(const aiNode *expected, const aiNode *node) {
+    ASSERT_NE(nullptr, expected);
+    ASSERT_NE(nullptr, node);
+    EXPECT_STREQ(expected->mName.C_Str(), node->mName.C_Str());
+    EXPECT_EQ(expected->mTransformation, node->mTransformation) << expected->mName.C_Str();
+    ASSERT_EQ(expected->mNumMeshes, node->mNumMeshes) << expected->mName.C_Str();
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        EXPECT_EQ(expected->mMeshes[i], node->mMeshes[i]) << expected->mName.C_Str();
+    }
+    ExpectSameMetadata(expected->mMetaData, node->mMetaData);
+
+    ASSERT_EQ(expected->mNumChildren, node->mNumChildren) << expected->mName.C_Str();
+    for (unsigned int i = 0; i < expected->mNumChildren; ++i) {
+        EXPECT_EQ(node, node->mChildren[i]->mParent);
+        ExpectSameNodes(expected->mChildren[i], node->mChildren[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Expects the mesh lists to match, see ExpectSameMesh().
+inline void ExpectSameMeshes(const aiScene *expected, const aiScene *scene) {
+    ASSERT_NE(nullptr, expected);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+    for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+        SCOPED_TRACE(testing::Message() << "mesh " << i);
+        ExpectSameMesh(expected->mMeshes[i], scene->mMeshes[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Expects the meshes, the node graph, the scene metadata and the number of the
+// remaining scene objects to match.
+inline void ExpectSameScene(const aiScene *expected, const aiScene *scene) {
+    ASSERT_NE(nullptr, expected);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_STREQ(expected->mName.C_Str(), scene->mName.C_Str());
+    EXPECT_EQ(expected->mFlags, scene->mFlags);
+    EXPECT_EQ(expected->mNumMaterials, scene->mNumMaterials);
+    EXPECT_EQ(expected->mNumTextures, scene->mNumTextures);
+    EXPECT_EQ(expected->mNumAnimations, scene->mNumAnimations);
+    EXPECT_EQ(expected->mNumLights, scene->mNumLights);
+    EXPECT_EQ(expected->mNumCameras, scene->mNumCameras);
+    ExpectSameMeshes(expected, scene);
+    for (unsigned int i = 0; i < expected->mNumMeshes && i < scene->mNumMeshes; ++i) {
+        EXPECT_STREQ(expected->mMeshes[i]->mName.C_Str(), scene->mMeshes[i]->mName.C_Str());
+    }
+    ExpectSameMetadata(expected->mMetaData, scene->mMetaData);
+    ExpectSameNodes(expected->mRootNode, scene->mRootNode);
+}
+
+} // namespace Assimp
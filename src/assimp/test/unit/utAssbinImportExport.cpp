@@ -39,11 +39,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
 #include "UnitTestPCH.h"
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
+#include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <algorithm>
+#include <vector>
+
 using namespace Assimp;
 
 #ifndef ASSIMP_BUILD_NO_EXPORT
@@ -66,4 +72,65 @@ TEST_F(utAssbinImportExport, import3ExportAssbinDFromFileTest) {
     EXPECT_TRUE(importerTest());
 }
 
+TEST_F(utAssbinImportExport, exportCompressedTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    size_t sizes[2] = { 0, 0 };
+    for (int level : { 0, 1 }) {
+        Exporter exporter;
+        ExportProperties properties;
+        properties.SetPropertyInteger(AI_CONFIG_EXPORT_ASSBIN_COMPRESSION, level);
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin", 0, &properties);
+        ASSERT_NE(nullptr, blob);
+        sizes[level] = blob->size;
+
+        Importer reimporter;
+        const aiScene *newScene = reimporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "assbin");
+        ASSERT_NE(nullptr, newScene);
+        ExpectSameMeshes(scene, newScene);
+        ExpectSameNodes(scene->mRootNode, newScene->mRootNode);
+    }
+    EXPECT_LT(sizes[1], sizes[0]);
+}
+
+TEST_F(utAssbinImportExport, exportClampsCompressionLevelTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    // out of range levels fall back to the nearest zlib level instead of failing the export
+    for (int level : { -5, 42 }) {
+        Exporter exporter;
+        ExportProperties properties;
+        properties.SetPropertyInteger(AI_CONFIG_EXPORT_ASSBIN_COMPRESSION, level);
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin", 0, &properties);
+        ASSERT_NE(nullptr, blob) << level;
+
+        Importer reimporter;
+        const aiScene *newScene = reimporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "assbin");
+        ASSERT_NE(nullptr, newScene) << level;
+        ExpectSameMeshes(scene, newScene);
+        ExpectSameNodes(scene->mRootNode, newScene->mRootNode);
+    }
+}
+
+TEST_F(utAssbinImportExport, importOtherByteOrderTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+
+    Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin");
+    ASSERT_NE(nullptr, blob);
+
+    // the byte order mark follows the file name and the command line
+    std::vector<uint8_t> data(static_cast<const uint8_t *>(blob->data), static_cast<const uint8_t *>(blob->data) + blob->size);
+    std::reverse(data.begin() + 448, data.begin() + 452);
+
+    Importer reimporter;
+    EXPECT_EQ(nullptr, reimporter.ReadFileFromMemory(data.data(), data.size(), 0, "assbin"));
+}
+
 #endif // #ifndef ASSIMP_BUILD_NO_EXPORT
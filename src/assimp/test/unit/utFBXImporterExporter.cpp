@@ -41,8 +41,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AbstractImportExportBase.h"
 #include "UnitTestPCH.h"
+#include "SceneComparison.h"
 
 #include <assimp/commonMetaData.h>
+#include <assimp/config.h>
 #include <assimp/material.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
@@ -461,3 +463,17 @@ TEST_F(utFBXImporterExporter, importSkeletonTest) {
     ASSERT_NE(nullptr, scene);
     ASSERT_TRUE(scene->mRootNode);
 }
+
+TEST_F(utFBXImporterExporter, importBinaryWithParallelInflate) {
+    // the arrays of a binary file are inflated up front when several threads may be used
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, serial);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 4);
+    const aiScene *parallel = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, parallel);
+
+    Assimp::ExpectSameScene(serial, parallel);
+}
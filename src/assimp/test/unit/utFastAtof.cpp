@@ -41,6 +41,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/fast_atof.h>
+#include <assimp/ParsingUtils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -187,3 +194,129 @@ TEST_F(FastAtofTest, FastAtof)
 {
     RunTest<ai_real>(FastAtofWrapper());
 }
+
+struct FastAtofBatchWrapper {
+    ai_real operator()(const char* str) {
+        // tokens the batch does not take go through the scalar parser, as in the importers
+        ai_real value = 0;
+        const char* in = str;
+        if (0 == Assimp::fast_atoreal_n<ai_real>(in, str + strlen(str), &value, 1)) {
+            Assimp::fast_atoreal_move<ai_real>(in, value);
+        }
+        return value;
+    }
+};
+
+TEST_F(FastAtofTest, FastAtofBatch)
+{
+    RunTest<ai_real>(FastAtofBatchWrapper());
+}
+
+namespace {
+
+// Numbers of every digit count, so both the 16-byte windows and the tails are covered
+std::string MakeNumberText(size_t count, char separator) {
+    std::mt19937 rng(42);
+    std::string text;
+    char number[64];
+    for (size_t i = 0; i < count; ++i) {
+        const int intDigits = static_cast<int>(rng() % 12);
+        const int decimals = static_cast<int>(rng() % 19);
+        std::string digits;
+        for (int d = 0; d < intDigits + decimals; ++d) {
+            digits += static_cast<char>('0' + rng() % 10);
+        }
+        snprintf(number, sizeof(number), "%s%s%s%s%s", (rng() % 2) ? "-" : "",
+                intDigits ? digits.substr(0, intDigits).c_str() : "0", decimals ? "." : "",
+                digits.substr(intDigits).c_str(), (rng() % 8) ? "" : "e-7");
+        text += number;
+        text += (i % 7 == 6) ? '\n' : separator;
+    }
+    return text;
+}
+
+} // Namespace
+
+TEST_F(FastAtofTest, FastAtofBatchMatchesScalar)
+{
+    const size_t count = 5000;
+    const std::string text = MakeNumberText(count, ' ');
+
+    std::vector<ai_real> expected;
+    for (const char* c = text.c_str(); *c;) {
+        ai_real value;
+        c = Assimp::fast_atoreal_move<ai_real>(c, value);
+        expected.push_back(value);
+        Assimp::SkipSpacesAndLineEnd(&c, text.c_str() + text.size());
+    }
+    ASSERT_EQ(count, expected.size());
+
+    std::vector<ai_real> values(count + 1);
+    const char* in = text.c_str();
+    EXPECT_EQ(count, Assimp::fast_atoreal_n<ai_real>(in, text.c_str() + text.size(), values.data(), values.size()));
+    EXPECT_EQ(text.c_str() + text.size(), in);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(expected[i], values[i]) << i;
+    }
+
+    // single-line mode stops at the first line break
+    in = text.c_str();
+    EXPECT_EQ(7u, Assimp::fast_atoreal_n<ai_real>(in, text.c_str() + text.size(), values.data(), count, false));
+    EXPECT_EQ('\n', *in);
+
+    // the batch stops in front of tokens it leaves to the scalar parser, with and without
+    // enough room behind them for the 16-byte windows
+    const char mixed[] = "1.5 2,5 nan                             ";
+    for (const char* end : { mixed + 11, mixed + sizeof(mixed) - 1 }) {
+        in = mixed;
+        EXPECT_EQ(1u, Assimp::fast_atoreal_n<ai_real>(in, end, values.data(), 3));
+        EXPECT_EQ(mixed + 4, in);
+    }
+}
+
+TEST_F(FastAtofTest, strtoul10_run)
+{
+    const char digits[] = "12345678901234567890123 42";
+    const char* end = digits + sizeof(digits) - 1;
+    uint64_t value = 0;
+    EXPECT_EQ(19u, Assimp::strtoul10_run(digits, end, value));
+    EXPECT_EQ(1234567890123456789u, value);
+    EXPECT_EQ(7u, Assimp::strtoul10_run(digits, end, value, 7));
+    EXPECT_EQ(1234567u, value);
+    EXPECT_EQ(2u, Assimp::strtoul10_run(digits + 24, end, value));
+    EXPECT_EQ(42u, value);
+    EXPECT_EQ(0u, Assimp::strtoul10_run(digits + 23, end, value));
+    // never reads past end
+    EXPECT_EQ(3u, Assimp::strtoul10_run(digits, digits + 3, value));
+    EXPECT_EQ(123u, value);
+}
+
+TEST_F(FastAtofTest, FastAtofBatchResumesLargeInput)
+{
+    const size_t count = 200000;
+    const std::string text = MakeNumberText(count, ' ');
+    const char* end = text.c_str() + text.size();
+
+    std::vector<ai_real> expected(count);
+    size_t i = 0;
+    for (const char* c = text.c_str(); *c; ++i) {
+        c = Assimp::fast_atoreal_move<ai_real>(c, expected[i]);
+        Assimp::SkipSpacesAndLineEnd(&c, end);
+    }
+    ASSERT_EQ(count, i);
+
+    // callers with a fixed output capacity continue where the previous batch stopped
+    std::vector<ai_real> values(count);
+    const char* in = text.c_str();
+    size_t parsed = 0;
+    while (parsed < count) {
+        const size_t n = Assimp::fast_atoreal_n<ai_real>(in, end, values.data() + parsed, std::min<size_t>(4093, count - parsed));
+        ASSERT_NE(0u, n);
+        parsed += n;
+    }
+    Assimp::SkipSpacesAndLineEnd(&in, end);
+    EXPECT_EQ(end, in);
+    for (i = 0; i < count; ++i) {
+        ASSERT_EQ(expected[i], values[i]) << i;
+    }
+}
@@ -0,0 +1,184 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+#include "UnitTestPCH.h"
+
+#include <assimp/scene.h>
+
+#include "PostProcessing/FindInstancesProcess.h"
+
+using namespace Assimp;
+
+class utFindInstances : public ::testing::Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    // Adds a copy of the reference tetrahedron to the scene and a node referencing it
+    void AddMesh(const aiMatrix4x4 &transform, unsigned int materialIndex = 0);
+
+    aiScene *mScene = nullptr;
+    std::vector<aiMesh *> mMeshes;
+    std::vector<aiNode *> mNodes;
+};
+
+// ------------------------------------------------------------------------------------------------
+void utFindInstances::SetUp() {
+    mScene = new aiScene();
+    mScene->mRootNode = new aiNode("root");
+}
+
+// ------------------------------------------------------------------------------------------------
+void utFindInstances::TearDown() {
+    delete mScene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void utFindInstances::AddMesh(const aiMatrix4x4 &transform, unsigned int materialIndex) {
+    static const aiVector3D positions[] = {
+        aiVector3D(0, 0, 0), aiVector3D(2, 0, 0), aiVector3D(0, 1, 0), aiVector3D(0, 0, 3)
+    };
+    static const unsigned int indices[] = { 0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3 };
+
+    aiMesh *mesh = new aiMesh();
+    mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mesh->mMaterialIndex = materialIndex;
+    mesh->mNumVertices = 12;
+    mesh->mVertices = new aiVector3D[12];
+    mesh->mNormals = new aiVector3D[12];
+    mesh->mNumFaces = 4;
+    mesh->mFaces = new aiFace[4];
+    const aiMatrix3x3 rotation(transform);
+    for (unsigned int f = 0; f < 4; ++f) {
+        aiFace &face = mesh->mFaces[f];
+        face.mNumIndices = 3;
+        face.mIndices = new unsigned int[3];
+        const aiVector3D &p0 = positions[indices[f * 3]], &p1 = positions[indices[f * 3 + 1]], &p2 = positions[indices[f * 3 + 2]];
+        const aiVector3D normal = ((p1 - p0) ^ (p2 - p0)).Normalize();
+        for (unsigned int i = 0; i < 3; ++i) {
+            const unsigned int v = f * 3 + i;
+            face.mIndices[i] = v;
+            mesh->mVertices[v] = transform * positions[indices[v]];
+            mesh->mNormals[v] = rotation * normal;
+        }
+    }
+    mMeshes.push_back(mesh);
+
+    aiNode *node = new aiNode("node" + std::to_string(mNodes.size()));
+    node->mNumMeshes = 1;
+    node->mMeshes = new unsigned int[1];
+    node->mMeshes[0] = static_cast<unsigned int>(mMeshes.size() - 1);
+    mNodes.push_back(node);
+}
+
+// ------------------------------------------------------------------------------------------------
+static void finishScene(aiScene *scene, std::vector<aiMesh *> &meshes, std::vector<aiNode *> &nodes) {
+    scene->mNumMeshes = static_cast<unsigned int>(meshes.size());
+    scene->mMeshes = new aiMesh *[meshes.size()];
+    std::copy(meshes.begin(), meshes.end(), scene->mMeshes);
+    scene->mRootNode->addChildren(static_cast<unsigned int>(nodes.size()), nodes.data());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utFindInstances, identicalMeshesAreShared) {
+    for (unsigned int i = 0; i < 200; ++i) {
+        AddMesh(aiMatrix4x4(), i % 4);
+    }
+    finishScene(mScene, mMeshes, mNodes);
+
+    FindInstancesProcess process;
+    process.Execute(mScene);
+
+    // one mesh per material
+    ASSERT_EQ(4u, mScene->mNumMeshes);
+    for (unsigned int i = 0; i < 200; ++i) {
+        const aiNode *node = mScene->mRootNode->mChildren[i];
+        ASSERT_EQ(1u, node->mNumMeshes);
+        EXPECT_EQ(i % 4, node->mMeshes[0]);
+        EXPECT_EQ(0u, node->mNumChildren);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utFindInstances, rigidInstancesOnlyWhenEnabled) {
+    aiMatrix4x4 rotation, translation;
+    aiMatrix4x4::Rotation(0.7f, aiVector3D(1, 2, 3).Normalize(), rotation);
+    aiMatrix4x4::Translation(aiVector3D(10, -4, 2), translation);
+    const aiMatrix4x4 rigid = translation * rotation;
+
+    AddMesh(aiMatrix4x4());
+    AddMesh(rigid);
+    finishScene(mScene, mMeshes, mNodes);
+
+    FindInstancesProcess process;
+    process.Execute(mScene);
+    EXPECT_EQ(2u, mScene->mNumMeshes);
+
+    process.EnableRigidInstances(true);
+    process.Execute(mScene);
+    ASSERT_EQ(1u, mScene->mNumMeshes);
+
+    // the instance moved to a child node which carries the transformation
+    const aiNode *node = mScene->mRootNode->mChildren[1];
+    EXPECT_EQ(0u, node->mNumMeshes);
+    ASSERT_EQ(1u, node->mNumChildren);
+    const aiNode *child = node->mChildren[0];
+    ASSERT_EQ(1u, child->mNumMeshes);
+    EXPECT_EQ(0u, child->mMeshes[0]);
+    EXPECT_TRUE(child->mTransformation.Equal(rigid, 1e-4f));
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utFindInstances, mirroredAndScaledMeshesAreNotRigid) {
+    aiMatrix4x4 mirror, scale;
+    mirror.a1 = -1;
+    aiMatrix4x4::Scaling(aiVector3D(2, 2, 2), scale);
+
+    AddMesh(aiMatrix4x4());
+    AddMesh(mirror);
+    AddMesh(scale);
+    finishScene(mScene, mMeshes, mNodes);
+
+    FindInstancesProcess process;
+    process.EnableRigidInstances(true);
+    process.Execute(mScene);
+    EXPECT_EQ(3u, mScene->mNumMeshes);
+}
@@ -40,3 +40,199 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+
+#include <assimp/scene.h>
+
+#include "PostProcessing/ImproveCacheLocality.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+using namespace Assimp;
+
+class utImproveCacheLocality : public ::testing::Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    // Average cache miss ratio for a FIFO cache of the default size
+    float Acmr() const;
+
+    // The faces, given as the original indices of their vertices
+    std::vector<std::array<unsigned int, 3>> OriginalFaces() const;
+
+    static constexpr unsigned int Size = 40;
+
+    aiScene *mScene = nullptr;
+    aiMesh *mMesh = nullptr;
+    std::vector<aiVector3D> mPositions;
+    std::vector<std::array<unsigned int, 3>> mFaces;
+};
+
+// ------------------------------------------------------------------------------------------------
+void utImproveCacheLocality::SetUp() {
+    mFaces.clear();
+
+    // A bumpy grid whose triangles come in random order. The normal of each vertex stores
+    // its original index, and a bone weights every vertex by it
+    mMesh = new aiMesh();
+    mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    mMesh->mNumVertices = Size * Size;
+    mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+    mMesh->mNormals = new aiVector3D[mMesh->mNumVertices];
+    for (unsigned int y = 0; y < Size; ++y) {
+        for (unsigned int x = 0; x < Size; ++x) {
+            const unsigned int i = y * Size + x;
+            mMesh->mVertices[i] = aiVector3D(ai_real(x), ai_real(y), std::sin(x * ai_real(0.3)) * std::cos(y * ai_real(0.3)) * 3);
+            mMesh->mNormals[i] = aiVector3D(ai_real(i), 0, 0);
+        }
+    }
+    mPositions.assign(mMesh->mVertices, mMesh->mVertices + mMesh->mNumVertices);
+
+    for (unsigned int y = 0; y + 1 < Size; ++y) {
+        for (unsigned int x = 0; x + 1 < Size; ++x) {
+            const unsigned int i = y * Size + x;
+            mFaces.push_back({ i, i + 1, i + Size });
+            mFaces.push_back({ i + 1, i + Size + 1, i + Size });
+        }
+    }
+    std::mt19937 rng(42);
+    std::shuffle(mFaces.begin(), mFaces.end(), rng);
+
+    mMesh->mNumFaces = static_cast<unsigned int>(mFaces.size());
+    mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+    for (unsigned int a = 0; a < mMesh->mNumFaces; ++a) {
+        aiFace &face = mMesh->mFaces[a];
+        face.mNumIndices = 3;
+        face.mIndices = new unsigned int[3];
+        std::copy(mFaces[a].begin(), mFaces[a].end(), face.mIndices);
+    }
+    std::sort(mFaces.begin(), mFaces.end());
+
+    mMesh->mNumBones = 1;
+    mMesh->mBones = new aiBone *[1];
+    aiBone *bone = mMesh->mBones[0] = new aiBone();
+    bone->mNumWeights = mMesh->mNumVertices;
+    bone->mWeights = new aiVertexWeight[bone->mNumWeights];
+    for (unsigned int i = 0; i < bone->mNumWeights; ++i) {
+        bone->mWeights[i] = aiVertexWeight(i, static_cast<ai_real>(i) / mMesh->mNumVertices);
+    }
+
+    mScene = new aiScene();
+    mScene->mNumMeshes = 1;
+    mScene->mMeshes = new aiMesh *[1];
+    mScene->mMeshes[0] = mMesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+void utImproveCacheLocality::TearDown() {
+    delete mScene;
+}
+
+// ------------------------------------------------------------------------------------------------
+float utImproveCacheLocality::Acmr() const {
+    std::vector<unsigned int> fifo(PP_ICL_PTCACHE_SIZE, UINT_MAX);
+    size_t cursor = 0;
+    unsigned int misses = 0;
+    for (unsigned int a = 0; a < mMesh->mNumFaces; ++a) {
+        for (unsigned int qq = 0; qq < 3; ++qq) {
+            const unsigned int idx = mMesh->mFaces[a].mIndices[qq];
+            if (std::find(fifo.begin(), fifo.end(), idx) == fifo.end()) {
+                fifo[cursor] = idx;
+                cursor = (cursor + 1) % fifo.size();
+                ++misses;
+            }
+        }
+    }
+    return static_cast<float>(misses) / mMesh->mNumFaces;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::vector<std::array<unsigned int, 3>> utImproveCacheLocality::OriginalFaces() const {
+    std::vector<std::array<unsigned int, 3>> faces;
+    for (unsigned int a = 0; a < mMesh->mNumFaces; ++a) {
+        std::array<unsigned int, 3> face;
+        for (unsigned int qq = 0; qq < 3; ++qq) {
+            face[qq] = static_cast<unsigned int>(mMesh->mNormals[mMesh->mFaces[a].mIndices[qq]].x);
+        }
+        faces.push_back(face);
+    }
+    std::sort(faces.begin(), faces.end());
+    return faces;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, reorderImprovesAcmr) {
+    const float before = Acmr();
+
+    ImproveCacheLocalityProcess process;
+    process.Execute(mScene);
+
+    const float after = Acmr();
+    EXPECT_LT(after, before);
+    EXPECT_LT(after, 1.f);
+
+    // same triangles with the same winding, and every vertex kept its data
+    EXPECT_EQ(mFaces, OriginalFaces());
+    const aiBone *bone = mMesh->mBones[0];
+    ASSERT_EQ(mMesh->mNumVertices, bone->mNumWeights);
+    for (unsigned int i = 0; i < mMesh->mNumVertices; ++i) {
+        const unsigned int original = static_cast<unsigned int>(mMesh->mNormals[i].x);
+        EXPECT_EQ(mPositions[original], mMesh->mVertices[i]);
+
+        // weight i still belongs to the vertex originally at i
+        EXPECT_EQ(i, static_cast<unsigned int>(mMesh->mNormals[bone->mWeights[i].mVertexId].x));
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, verticesInFirstUseOrder) {
+    ImproveCacheLocalityProcess process;
+    process.Execute(mScene);
+
+    unsigned int next = 0;
+    for (unsigned int a = 0; a < mMesh->mNumFaces; ++a) {
+        for (unsigned int qq = 0; qq < 3; ++qq) {
+            const unsigned int idx = mMesh->mFaces[a].mIndices[qq];
+            ASSERT_LE(idx, next);
+            if (idx == next) {
+                ++next;
+            }
+        }
+    }
+    EXPECT_EQ(mMesh->mNumVertices, next);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, reorderFacesOnly) {
+    ImproveCacheLocalityProcess process;
+    process.SetOverdrawThreshold(0.f);
+    process.EnableFetchOptimization(false);
+    const float before = Acmr();
+    process.Execute(mScene);
+    EXPECT_LT(Acmr(), before);
+
+    // the vertices are untouched
+    for (unsigned int i = 0; i < mMesh->mNumVertices; ++i) {
+        EXPECT_EQ(mPositions[i], mMesh->mVertices[i]);
+        EXPECT_EQ(i, mMesh->mBones[0]->mWeights[i].mVertexId);
+    }
+    EXPECT_EQ(mFaces, OriginalFaces());
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, overdrawSortKeepsCacheEfficiency) {
+    ImproveCacheLocalityProcess tipsify;
+    tipsify.SetOverdrawThreshold(0.f);
+    tipsify.Execute(mScene);
+    const float tipsifyAcmr = Acmr();
+
+    TearDown();
+    SetUp();
+    ImproveCacheLocalityProcess process;
+    process.Execute(mScene);
+    EXPECT_EQ(mFaces, OriginalFaces());
+    EXPECT_LE(Acmr(), tipsifyAcmr * PP_ICL_OVERDRAW_THRESHOLD * 1.1f);
+}
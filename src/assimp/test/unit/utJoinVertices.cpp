@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "UnitTestPCH.h"
 
+#include <assimp/SceneCombiner.h>
 #include <assimp/scene.h>
 
 #include "PostProcessing/JoinVerticesProcess.h"
@@ -140,3 +141,91 @@ TEST_F(utJoinVertices, testProcess) {
     }
     EXPECT_EQ(150.f * 299.f * 3.f, fSum); // gaussian sum equation
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, testProcessExactHash) {
+    piProcess->EnableExactHash(true);
+    EXPECT_TRUE(piProcess->IsExactHash());
+    piProcess->ProcessMesh(pcMesh, 0);
+
+    ASSERT_EQ(300U, pcMesh->mNumFaces);
+    ASSERT_EQ(300U, pcMesh->mNumVertices);
+
+    // the unique vertices keep the order of their first use
+    for (unsigned int i = 0; i < 300; ++i) {
+        EXPECT_EQ(aiVector3D((float)i), pcMesh->mVertices[i]);
+    }
+    for (unsigned int i = 0, p = 0; i < 300; ++i) {
+        for (unsigned int a = 0; a < 3; ++a, ++p) {
+            EXPECT_EQ(p % 300, pcMesh->mFaces[i].mIndices[a]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, testExactHashComparesCompleteVertex) {
+    // vertices 300..449 get different tangents, 600..749 differ in their skinning
+    for (unsigned int i = 300; i < 450; ++i) {
+        pcMesh->mTangents[i] = aiVector3D(1.f, 0.f, 0.f);
+    }
+    pcMesh->mNumBones = 1;
+    pcMesh->mBones = new aiBone *[1];
+    pcMesh->mBones[0] = new aiBone();
+    pcMesh->mBones[0]->mNumWeights = 150;
+    pcMesh->mBones[0]->mWeights = new aiVertexWeight[150];
+    for (unsigned int i = 0; i < 150; ++i) {
+        pcMesh->mBones[0]->mWeights[i] = aiVertexWeight(600 + i, 1.f);
+    }
+    // 0 and -0 are the same value
+    for (unsigned int i = 450; i < 600; ++i) {
+        pcMesh->mNormals[i] = aiVector3D(-0.f, 0.f, -0.f);
+    }
+
+    piProcess->EnableExactHash(true);
+    piProcess->ProcessMesh(pcMesh, 0);
+    EXPECT_EQ(600U, pcMesh->mNumVertices);
+    EXPECT_EQ(150U, pcMesh->mBones[0]->mNumWeights);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utJoinVertices, testExactHashMatchesMap) {
+    // without tangents and bones both searches find the same vertices
+    aiMesh *mesh = new aiMesh();
+    mesh->mNumVertices = 3000;
+    mesh->mVertices = new aiVector3D[3000];
+    mesh->mTextureCoords[0] = new aiVector3D[3000];
+    mesh->mNumUVComponents[0] = 2;
+    for (unsigned int i = 0; i < 3000; ++i) {
+        mesh->mVertices[i] = aiVector3D((float)(i % 37), 1.f, 0.f);
+        mesh->mTextureCoords[0][i] = aiVector3D((float)(i % 4), 0.f, 0.f);
+    }
+    mesh->mNumFaces = 1000;
+    mesh->mFaces = new aiFace[1000];
+    for (unsigned int i = 0; i < 1000; ++i) {
+        aiFace &face = mesh->mFaces[i];
+        face.mIndices = new unsigned int[face.mNumIndices = 3];
+        for (unsigned int a = 0; a < 3; ++a) {
+            face.mIndices[a] = i * 3 + a;
+        }
+    }
+    aiMesh *copy = nullptr;
+    SceneCombiner::Copy(&copy, mesh);
+
+    piProcess->ProcessMesh(mesh, 0);
+    piProcess->EnableExactHash(true);
+    piProcess->ProcessMesh(copy, 0);
+
+    ASSERT_EQ(mesh->mNumVertices, copy->mNumVertices);
+    EXPECT_LT(mesh->mNumVertices, 3000U);
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        EXPECT_EQ(mesh->mVertices[i], copy->mVertices[i]);
+        EXPECT_EQ(mesh->mTextureCoords[0][i], copy->mTextureCoords[0][i]);
+    }
+    for (unsigned int i = 0; i < 1000; ++i) {
+        for (unsigned int a = 0; a < 3; ++a) {
+            EXPECT_EQ(mesh->mFaces[i].mIndices[a], copy->mFaces[i].mIndices[a]);
+        }
+    }
+    delete mesh;
+    delete copy;
+}
@@ -279,6 +279,78 @@ TEST_F(MaterialSystemTest, testMaterialTextureTypeEnum) {
     EXPECT_EQ(maxTextureType, AI_TEXTURE_TYPE_MAX) << "AI_TEXTURE_TYPE_MAX macro must be equal to the largest valid aiTextureType_XXX";
 }
 
+// ------------------------------------------------------------------------------------------------
+static void fillIndexTestMaterial(aiMaterial *mat) {
+    // keys which are prefixes of others come after them, so prefix matches are found first
+    int value = 0;
+    for (unsigned int k = 40; k-- > 0;) {
+        const std::string key = "key" + std::to_string(k);
+        for (unsigned int semantic = 0; semantic < 3; ++semantic) {
+            ++value;
+            mat->AddProperty(&value, 1, key.c_str(), semantic, k % 2);
+        }
+    }
+    ++value;
+    mat->AddProperty(&value, 1, "$tex.file.strength", aiTextureType_DIFFUSE, 0);
+    ++value;
+    mat->AddProperty(&value, 1, "$tex.file", aiTextureType_DIFFUSE, 0);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testPropertyIndexMatchesScan) {
+    aiMaterial scanned;
+    fillIndexTestMaterial(&scanned);
+    fillIndexTestMaterial(pcMat);
+    pcMat->BuildPropertyIndex();
+    EXPECT_NE(nullptr, pcMat->mPrivate);
+    EXPECT_EQ(nullptr, scanned.mPrivate);
+
+    const char *keys[] = { "key0", "key1", "key13", "key39", "key4", "key", "", "$tex.file", "$tex", "missing", "key400" };
+    for (const char *key : keys) {
+        for (unsigned int semantic : { 0u, 1u, 2u, 3u, UINT_MAX }) {
+            for (unsigned int index : { 0u, 1u, UINT_MAX }) {
+                const aiMaterialProperty *expected = nullptr, *found = nullptr;
+                const aiReturn expectedResult = aiGetMaterialProperty(&scanned, key, semantic, index, &expected);
+                EXPECT_EQ(expectedResult, aiGetMaterialProperty(pcMat, key, semantic, index, &found)) << key;
+                if (nullptr == expected) {
+                    EXPECT_EQ(nullptr, found) << key;
+                    continue;
+                }
+                ASSERT_NE(nullptr, found) << key;
+                EXPECT_EQ(expected->mKey, found->mKey);
+                EXPECT_EQ(expected->mSemantic, found->mSemantic);
+                EXPECT_EQ(expected->mIndex, found->mIndex);
+                EXPECT_EQ(*reinterpret_cast<const int *>(expected->mData), *reinterpret_cast<const int *>(found->mData));
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testPropertyIndexFollowsChanges) {
+    fillIndexTestMaterial(pcMat);
+    pcMat->BuildPropertyIndex();
+
+    int pf = 15039263;
+    pcMat->AddProperty(&pf, 1, "added");
+    EXPECT_EQ(nullptr, pcMat->mPrivate);
+    pcMat->BuildPropertyIndex();
+    pf = 0;
+    EXPECT_EQ(AI_SUCCESS, pcMat->Get("added", 0, 0, pf));
+    EXPECT_EQ(15039263, pf);
+
+    EXPECT_EQ(AI_SUCCESS, pcMat->RemoveProperty("added", 0, 0));
+    EXPECT_EQ(AI_FAILURE, pcMat->Get("added", 0, 0, pf));
+
+    // direct modifications of the list make lookups scan again
+    pcMat->AddProperty(&pf, 1, "last");
+    pcMat->BuildPropertyIndex();
+    --pcMat->mNumProperties;
+    EXPECT_EQ(AI_FAILURE, pcMat->Get("last", 0, 0, pf));
+    ++pcMat->mNumProperties;
+    EXPECT_EQ(AI_SUCCESS, pcMat->Get("last", 0, 0, pf));
+}
+
 #if defined(_MSC_VER)
 __pragma (warning(pop))
 #endif
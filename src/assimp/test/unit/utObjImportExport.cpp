@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
 #include "SceneDiffer.h"
 #include "UnitTestPCH.h"
 #include <assimp/postprocess.h>
@@ -526,6 +527,48 @@ TEST_F(utObjImportExport, import_with_line_continuations) {
     EXPECT_NEAR(vertices[2].z, -0.5f, threshold);
 }
 
+TEST_F(utObjImportExport, parallel_parse_matches_serial) {
+    // Large enough to be split into several chunks, with statements that depend on what came before
+    std::string objModel;
+    char line[256];
+    for (int object = 0; object < 40; ++object) {
+        snprintf(line, sizeof(line), "o object%d\ng group%d\nusemtl material%d\n", object, object % 3, object % 5);
+        objModel += line;
+        for (int v = 0; v < 400; ++v) {
+            const float x = object + v * 0.25f, y = v * 0.5f, z = object * 0.125f;
+            if (object % 7 == 3) {
+                snprintf(line, sizeof(line), "v %f %f %f %f 0.5 0.25\n", x, y, z, v / 400.f);
+            } else {
+                snprintf(line, sizeof(line), "v %f \\\n  %f %f\n", x, y, z);
+            }
+            objModel += line;
+            snprintf(line, sizeof(line), "vt %f %f\nvn 0 %f 1\n", v / 400.f, object / 40.f, v / 400.f);
+            objModel += line;
+        }
+        for (int f = 0; f + 2 < 400; f += 2) {
+            if (f % 4 == 0) {
+                const int base = object * 400 + f + 1;
+                snprintf(line, sizeof(line), "f %d/%d/%d %d/%d/%d %d/%d/%d\n", base, base, base, base + 1, base + 1, base + 1, base + 2, base + 2, base + 2);
+            } else {
+                const int rel = f - 400;
+                snprintf(line, sizeof(line), "f %d/%d/%d %d/%d/%d %d/%d/%d\n", rel, rel, rel, rel + 1, rel + 1, rel + 1, rel + 2, rel + 2, rel + 2);
+            }
+            objModel += line;
+        }
+    }
+
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFileFromMemory(objModel.c_str(), objModel.size(), aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, serial);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 4);
+    const aiScene *parallel = parallelImporter.ReadFileFromMemory(objModel.c_str(), objModel.size(), aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, parallel);
+
+    ExpectSameScene(serial, parallel);
+}
+
 TEST_F(utObjImportExport, issue2355_mtl_texture_prefix) {
     ::Assimp::Importer importer;
     const aiScene *const scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/mtl_different_folder.obj", aiProcess_ValidateDataStructure);
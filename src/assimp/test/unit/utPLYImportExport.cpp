@@ -41,10 +41,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
+#include "UnitTestFileGenerator.h"
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 
 using namespace ::Assimp;
 
@@ -141,6 +151,224 @@ TEST_F(utPLYImportExport, importBinaryPLYWithRNNewline) {
     EXPECT_EQ(2u, scene->mMeshes[0]->mFaces[0].mIndices[2]);
 }
 
+template <class T>
+static void AppendBinary(std::string &out, T value, bool bigEndian) {
+    char bytes[sizeof(T)];
+    ::memcpy(bytes, &value, sizeof(T));
+    const uint16_t one = 1;
+    if (bigEndian == (1 == *reinterpret_cast<const char *>(&one))) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    out.append(bytes, sizeof(T));
+}
+
+// A grid of size * size vertices with normals, colors and an unused property. The
+// first cell is a quad, all others are split into two triangles.
+static std::string CreateGridPLY(unsigned int size, const char *format) {
+    const bool ascii = 0 == strcmp(format, "ascii");
+    const bool bigEndian = 0 == strcmp(format, "binary_big_endian");
+
+    std::ostringstream header;
+    header << "ply\nformat " << format << " 1.0\n"
+           << "element vertex " << size * size << "\n"
+           << "property float x\nproperty float y\nproperty float z\n"
+           << "property float confidence\n"
+           << "property float nx\nproperty float ny\nproperty float nz\n"
+           << "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+           << "element face " << 2 * (size - 1) * (size - 1) - 1 << "\n"
+           << "property list uchar int vertex_indices\n"
+           << "end_header\n";
+
+    std::string out = header.str();
+    std::ostringstream text;
+    for (unsigned int y = 0; y < size; ++y) {
+        for (unsigned int x = 0; x < size; ++x) {
+            const float values[7] = { x * 0.25f, y * 0.5f, ((x + y) % 7) * 0.125f, 1.5f, 0.f, 0.f, 1.f };
+            const unsigned char color[3] = { static_cast<unsigned char>(x), static_cast<unsigned char>(y),
+                static_cast<unsigned char>(x + y) };
+            if (ascii) {
+                for (float value : values) {
+                    text << value << " ";
+                }
+                text << unsigned(color[0]) << " " << unsigned(color[1]) << " " << unsigned(color[2]) << "\n";
+            } else {
+                for (float value : values) {
+                    AppendBinary(out, value, bigEndian);
+                }
+                out.append(reinterpret_cast<const char *>(color), 3);
+            }
+        }
+    }
+
+    for (unsigned int y = 0; y + 1 < size; ++y) {
+        for (unsigned int x = 0; x + 1 < size; ++x) {
+            const int corner = static_cast<int>(y * size + x), right = corner + 1;
+            const int above = corner + static_cast<int>(size), aboveRight = above + 1;
+            std::vector<std::vector<int>> faces;
+            if (0 == corner) {
+                faces.push_back({ corner, right, aboveRight, above });
+            } else {
+                faces.push_back({ corner, right, aboveRight });
+                faces.push_back({ corner, aboveRight, above });
+            }
+            for (const std::vector<int> &face : faces) {
+                if (ascii) {
+                    text << face.size();
+                    for (int index : face) {
+                        text << " " << index;
+                    }
+                    text << "\n";
+                } else {
+                    out.push_back(static_cast<char>(face.size()));
+                    for (int index : face) {
+                        AppendBinary(out, index, bigEndian);
+                    }
+                }
+            }
+        }
+    }
+    return out + text.str();
+}
+
+// Expects the grid read from a binary file to match the one read from text.
+static void ExpectSameGrid(const aiMesh *expected, const aiMesh *mesh) {
+    ASSERT_TRUE(mesh->HasNormals());
+    ASSERT_TRUE(mesh->HasVertexColors(0));
+    EXPECT_FALSE(mesh->HasTextureCoords(0));
+    ExpectSameMesh(expected, mesh);
+}
+
+TEST_F(utPLYImportExport, importBinaryPLYMatchesAscii) {
+    // large enough to span several blocks of the stream buffer
+    const unsigned int size = 300;
+    const std::string ascii = CreateGridPLY(size, "ascii");
+    Assimp::Importer asciiImporter;
+    const aiScene *expected = asciiImporter.ReadFileFromMemory(ascii.data(), ascii.size(), aiProcess_ValidateDataStructure, "ply");
+    ASSERT_NE(nullptr, expected);
+    ASSERT_EQ(1u, expected->mNumMeshes);
+    EXPECT_EQ(size * size, expected->mMeshes[0]->mNumVertices);
+    EXPECT_EQ(4u, expected->mMeshes[0]->mFaces[0].mNumIndices);
+
+    const std::string bigEndian = CreateGridPLY(size, "binary_big_endian");
+    Assimp::Importer bigEndianImporter;
+    const aiScene *scene = bigEndianImporter.ReadFileFromMemory(bigEndian.data(), bigEndian.size(), aiProcess_ValidateDataStructure, "ply");
+    ASSERT_NE(nullptr, scene);
+    ExpectSameGrid(expected->mMeshes[0], scene->mMeshes[0]);
+
+    // read a file from disk as well, which is parsed block by block
+    const char *fileName = TMP_PATH "gridBinary.ply";
+    {
+        const std::string littleEndian = CreateGridPLY(size, "binary_little_endian");
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(littleEndian.data(), littleEndian.size());
+    }
+    Assimp::Importer littleEndianImporter;
+    scene = littleEndianImporter.ReadFile(fileName, aiProcess_ValidateDataStructure);
+    std::remove(fileName);
+    ASSERT_NE(nullptr, scene);
+    ExpectSameGrid(expected->mMeshes[0], scene->mMeshes[0]);
+}
+
+// A mapped file which claims to be larger than it is. Only the real contents are read, the
+// rest of the claimed size is never touched by the parser.
+class OversizedMappedStream : public IOStream {
+public:
+    OversizedMappedStream(const std::string &data, size_t fileSize) :
+            mData(data), mFileSize(fileSize), mPos(0) {}
+
+    size_t Read(void *buffer, size_t size, size_t count) override {
+        const size_t available = mPos < mData.size() && 0 != size ? (mData.size() - mPos) / size : 0;
+        count = std::min(count, available);
+        ::memcpy(buffer, mData.data() + mPos, size * count);
+        mPos += size * count;
+        return count;
+    }
+
+    size_t Write(const void *, size_t, size_t) override {
+        return 0;
+    }
+
+    aiReturn Seek(size_t offset, aiOrigin origin) override {
+        const size_t base = aiOrigin_SET == origin ? 0 : (aiOrigin_CUR == origin ? mPos : mFileSize);
+        if (base + offset > mFileSize) {
+            return aiReturn_FAILURE;
+        }
+        mPos = base + offset;
+        return aiReturn_SUCCESS;
+    }
+
+    size_t Tell() const override {
+        return mPos;
+    }
+
+    size_t FileSize() const override {
+        return mFileSize;
+    }
+
+    void Flush() override {}
+
+    const uint8_t *GetMappedData() const override {
+        return reinterpret_cast<const uint8_t *>(mData.data());
+    }
+
+private:
+    const std::string &mData;
+    size_t mFileSize;
+    size_t mPos;
+};
+
+class OversizedMappedIOSystem : public IOSystem {
+public:
+    OversizedMappedIOSystem(const char *fileName, const std::string &data, size_t fileSize) :
+            mFileName(fileName), mData(data), mFileSize(fileSize) {}
+
+    bool Exists(const char *file) const override {
+        return mFileName == file;
+    }
+
+    char getOsSeparator() const override {
+        return '/';
+    }
+
+    IOStream *Open(const char *file, const char *) override {
+        return Exists(file) ? new OversizedMappedStream(mData, mFileSize) : nullptr;
+    }
+
+    void Close(IOStream *stream) override {
+        delete stream;
+    }
+
+private:
+    std::string mFileName;
+    const std::string &mData;
+    size_t mFileSize;
+};
+
+TEST_F(utPLYImportExport, importBinaryPLYWithMoreThan4GiBRemaining) {
+    if (sizeof(size_t) <= 4) {
+        GTEST_SKIP() << "A mapping larger than 4 GiB needs a 64 bit size_t";
+    }
+
+    const unsigned int size = 8;
+    std::string data = CreateGridPLY(size, "binary_little_endian");
+    Assimp::Importer expectedImporter;
+    const aiScene *expected = expectedImporter.ReadFileFromMemory(data.data(), data.size(), aiProcess_ValidateDataStructure, "ply");
+    ASSERT_NE(nullptr, expected);
+
+    // the body remains 4 GiB and one byte long, truncated to 32 bit it would be a single byte.
+    // The real data is padded to cover every block the stream buffer hands out.
+    const size_t bodyStart = data.find("end_header\n") + strlen("end_header\n");
+    const size_t fileSize = bodyStart + (static_cast<size_t>(1) << 32) + 1;
+    data.resize(std::max(data.size(), static_cast<size_t>(2 * 1024 * 1024)), '\0');
+
+    Assimp::Importer importer;
+    importer.SetIOHandler(new OversizedMappedIOSystem("oversized.ply", data, fileSize));
+    const aiScene *scene = importer.ReadFile("oversized.ply", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    ExpectSameGrid(expected->mMeshes[0], scene->mMeshes[0]);
+}
+
 TEST_F(utPLYImportExport, vertexColorTest) {
     Assimp::Importer importer;
     const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/PLY/float-color.ply", aiProcess_ValidateDataStructure);
@@ -44,6 +44,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UTLogStream.h"
 #include <assimp/Profiler.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
 
 using namespace ::Assimp;
 using namespace ::Assimp::Profiling;
@@ -75,3 +79,88 @@ TEST_F( utProfiler, addRegion_success ) {
     //UTLogStream *stream( (UTLogStream*) m_stream );
     //EXPECT_FALSE( stream->m_messages.empty() );
 }
+
+TEST_F(utProfiler, nestedRegionsTest) {
+    Profiler profiler;
+    profiler.BeginRegion("total");
+    profiler.BeginRegion("parse");
+    profiler.EndRegion("parse");
+    profiler.BeginRegion("parse");
+    profiler.EndRegion("parse");
+    profiler.BeginRegion("convert");
+    profiler.EndRegion("total"); // closes "convert" as well
+    profiler.EndRegion("unknown");
+
+    const ProfileReport &report = profiler.GetReport();
+    ASSERT_EQ(1u, report.mRegions.size());
+    const ProfileRegion &total = report.mRegions[0];
+    EXPECT_EQ("total", total.mName);
+    EXPECT_EQ(1u, total.mCalls);
+    ASSERT_EQ(2u, total.mChildren.size());
+    EXPECT_EQ(2u, total.mChildren[0].mCalls);
+    EXPECT_EQ(1u, total.mChildren[1].mCalls);
+    EXPECT_GE(total.mSeconds, total.mChildren[0].mSeconds);
+    EXPECT_EQ(&total.mChildren[1], report.Find("total/convert"));
+    EXPECT_EQ(nullptr, report.Find("total/read"));
+    EXPECT_EQ(nullptr, report.Find("parse"));
+
+    profiler.Reset();
+    EXPECT_TRUE(profiler.GetReport().Empty());
+}
+
+TEST_F(utProfiler, jsonTest) {
+    Profiler profiler;
+    profiler.BeginRegion("a \"quoted\" name");
+    profiler.BeginRegion("child");
+    profiler.EndRegion("child");
+    profiler.EndRegion("a \"quoted\" name");
+
+    const std::string json = profiler.GetReport().ToJson();
+    EXPECT_EQ('[', json.front());
+    EXPECT_EQ(']', json.back());
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"a \\\"quoted\\\" name\""));
+    EXPECT_NE(std::string::npos, json.find("\"children\":[{\"name\":\"child\",\"calls\":1,"));
+    EXPECT_NE(std::string::npos, json.find("\"facesOut\":0,\"children\":[]}"));
+}
+
+TEST_F(utProfiler, importerReportTest) {
+    Importer importer;
+    importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", aiProcess_Triangulate);
+    EXPECT_TRUE(importer.GetProfileReport().Empty());
+
+    importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
+    ASSERT_NE(nullptr, scene);
+    const ProfileReport &report = importer.GetProfileReport();
+
+    EXPECT_NE(nullptr, report.Find("total/import/parse"));
+    EXPECT_NE(nullptr, report.Find("total/import/convert"));
+    EXPECT_NE(nullptr, report.Find("total/preprocess"));
+
+    // box.obj has six quads, which Triangulate splits and JoinIdenticalVertices then welds
+    const ProfileRegion *triangulate = report.Find("total/postprocess/Triangulate");
+    ASSERT_NE(nullptr, triangulate);
+    EXPECT_EQ(1u, triangulate->mCalls);
+    EXPECT_EQ(6u, triangulate->mFacesIn);
+    EXPECT_EQ(12u, triangulate->mFacesOut);
+
+    const ProfileRegion *join = report.Find("total/postprocess/JoinIdenticalVertices");
+    ASSERT_NE(nullptr, join);
+    EXPECT_EQ(12u, join->mFacesIn);
+    EXPECT_LT(join->mVerticesOut, join->mVerticesIn);
+    EXPECT_EQ(scene->mMeshes[0]->mNumVertices, join->mVerticesOut);
+
+    const ProfileRegion *total = report.Find("total");
+    ASSERT_NE(nullptr, total);
+    EXPECT_EQ(join->mVerticesOut, total->mVerticesOut);
+
+    // Steps applied later on are added to the same report
+    importer.ApplyPostProcessing(aiProcess_GenBoundingBoxes);
+    EXPECT_NE(nullptr, importer.GetProfileReport().Find("postprocess/GenBoundingBoxes"));
+    EXPECT_NE(nullptr, importer.GetProfileReport().Find("total/postprocess/Triangulate"));
+    EXPECT_NE(std::string::npos, importer.GetProfileReport().ToJson().find("\"name\":\"GenBoundingBoxes\""));
+
+    importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, false);
+    importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj", 0);
+    EXPECT_TRUE(importer.GetProfileReport().Empty());
+}
@@ -40,13 +40,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
 #include "UnitTestPCH.h"
 
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <cstring>
 #include <vector>
 
 using namespace Assimp;
@@ -99,6 +102,62 @@ TEST_F(utSTLImporterExporter, test_with_empty_solid) {
     EXPECT_EQ(nullptr, scene2);
 }
 
+TEST_F(utSTLImporterExporter, importBinaryWelded) {
+    Assimp::Importer plainImporter;
+    const aiScene *plain = plainImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, plain);
+
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD, true);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+
+    const aiMesh *mesh = scene->mMeshes[0];
+    EXPECT_LT(mesh->mNumVertices, plain->mMeshes[0]->mNumVertices);
+    ExpectSameFacePositions(plain->mMeshes[0], mesh);
+}
+
+TEST_F(utSTLImporterExporter, importBinaryWeldedWithThreads) {
+    // A binary STL of a grid large enough to be welded in chunks
+    const unsigned int size = 320;
+    std::vector<unsigned char> file(84 + 50 * 2 * size * size, 0);
+    const uint32_t numFacets = 2 * size * size;
+    ::memcpy(&file[80], &numFacets, sizeof(uint32_t));
+    unsigned char *facet = &file[84];
+    for (unsigned int y = 0; y < size; ++y) {
+        for (unsigned int x = 0; x < size; ++x) {
+            const float corners[2][9] = {
+                { float(x), float(y), 0.f, float(x + 1), float(y), 0.f, float(x + 1), float(y + 1), 0.f },
+                { float(x), float(y), 0.f, float(x + 1), float(y + 1), 0.f, float(x), float(y + 1), -0.f }
+            };
+            for (const float *corner : corners) {
+                const float normal[3] = { 0.f, 0.f, 1.f };
+                ::memcpy(facet, normal, sizeof(normal));
+                ::memcpy(facet + 12, corner, 9 * sizeof(float));
+                facet += 50;
+            }
+        }
+    }
+
+    Assimp::Importer serialImporter;
+    serialImporter.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD, true);
+    const aiScene *serial = serialImporter.ReadFileFromMemory(file.data(), file.size(), aiProcess_ValidateDataStructure, "stl");
+    ASSERT_NE(nullptr, serial);
+    const aiMesh *serialMesh = serial->mMeshes[0];
+    EXPECT_EQ((size + 1) * (size + 1), serialMesh->mNumVertices);
+
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD, true);
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 4);
+    const aiScene *scene = importer.ReadFileFromMemory(file.data(), file.size(), aiProcess_ValidateDataStructure, "stl");
+    ASSERT_NE(nullptr, scene);
+    const aiMesh *mesh = scene->mMeshes[0];
+
+    // the chunked weld numbers the vertices exactly like the serial one
+    ExpectSameMesh(serialMesh, mesh);
+}
+
 #ifndef ASSIMP_BUILD_NO_EXPORT
 
 TEST_F(utSTLImporterExporter, exporterTest) {
@@ -75,3 +75,39 @@ TEST_F(utSceneCombiner, CopySceneWithNullptr_AI_NO_EXCEPTion) {
     EXPECT_NO_THROW(SceneCombiner::CopyScene(nullptr, nullptr));
     EXPECT_NO_THROW(SceneCombiner::CopySceneFlat(nullptr, nullptr));
 }
+
+TEST_F(utSceneCombiner, MergeMeshes_PooledFaceIndices_Test) {
+    std::vector<aiMesh *> merge_list;
+    for (unsigned int i = 0; i < 3; ++i) {
+        aiMesh *mesh = new aiMesh;
+        mesh->mNumVertices = 3;
+        mesh->mVertices = new aiVector3D[3];
+        mesh->mNumFaces = 1;
+        mesh->mFaces = new aiFace[1];
+        mesh->mFaces[0].mNumIndices = 3;
+        mesh->mFaces[0].mIndices = mesh->AllocateFaceIndices(3);
+        for (unsigned int j = 0; j < 3; ++j) {
+            mesh->mFaces[0].mIndices[j] = j;
+        }
+        merge_list.push_back(mesh);
+    }
+
+    // the inputs are deleted, their pooled index arrays have to stay alive
+    aiMesh *ptr = nullptr;
+    SceneCombiner::MergeMeshes(&ptr, 0, merge_list.begin(), merge_list.end());
+    std::unique_ptr<aiMesh> out(ptr);
+    ASSERT_EQ(3u, out->mNumFaces);
+    for (unsigned int i = 0; i < out->mNumFaces; ++i) {
+        EXPECT_TRUE(out->IsPooledFaceIndices(out->mFaces[i].mIndices));
+        for (unsigned int j = 0; j < 3; ++j) {
+            EXPECT_EQ(3 * i + j, out->mFaces[i].mIndices[j]);
+        }
+    }
+
+    // copies own their index arrays
+    aiMesh *copy = nullptr;
+    SceneCombiner::Copy(&copy, out.get());
+    std::unique_ptr<aiMesh> copyPtr(copy);
+    EXPECT_EQ(nullptr, copy->mPrivate);
+    EXPECT_EQ(5u, copy->mFaces[1].mIndices[2]);
+}
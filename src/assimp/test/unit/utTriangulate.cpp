@@ -135,3 +135,36 @@ TEST_F(TriangulateProcessTest, testTriangulation) {
     // we should have no valid normal vectors now because we aren't a pure polygon mesh
     EXPECT_TRUE(pcMesh->mNormals == nullptr);
 }
+
+TEST_F(TriangulateProcessTest, testTriangulationOfPooledFaces) {
+    // move all index arrays into the pool of the mesh
+    size_t numIndices = 0;
+    for (unsigned int m = 0; m < pcMesh->mNumFaces; ++m) {
+        numIndices += pcMesh->mFaces[m].mNumIndices;
+    }
+    unsigned int *indices = pcMesh->AllocateFaceIndices(numIndices);
+    for (unsigned int m = 0; m < pcMesh->mNumFaces; ++m) {
+        aiFace &face = pcMesh->mFaces[m];
+        std::copy(face.mIndices, face.mIndices + face.mNumIndices, indices);
+        delete[] face.mIndices;
+        face.mIndices = indices;
+        indices += face.mNumIndices;
+    }
+
+    const unsigned int numFaces = pcMesh->mNumFaces;
+    piProcess->TriangulateMesh(pcMesh);
+    EXPECT_LT(numFaces, pcMesh->mNumFaces);
+
+    // quads keep their pooled array for the first triangle
+    unsigned int numPooled = 0;
+    for (unsigned int m = 0; m < pcMesh->mNumFaces; ++m) {
+        const aiFace &face = pcMesh->mFaces[m];
+        EXPECT_GE(3u, face.mNumIndices);
+        ASSERT_NE(nullptr, face.mIndices);
+        if (pcMesh->IsPooledFaceIndices(face.mIndices)) {
+            ++numPooled;
+        }
+    }
+    EXPECT_LT(0u, numPooled);
+    EXPECT_GT(pcMesh->mNumFaces, numPooled);
+}
@@ -39,6 +39,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ---------------------------------------------------------------------------
 */
 #include "AbstractImportExportBase.h"
+#include "SceneComparison.h"
 #include "UnitTestPCH.h"
 
 #include <assimp/commonMetaData.h>
@@ -693,6 +694,35 @@ TEST_F(utglTF2ImportExport, crash_in_anim_mesh_destructor) {
     ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/glTF-Sample-Models/AnimatedMorphCube-glTF/AnimatedMorphCube_out.glTF"));
 }
 
+TEST_F(utglTF2ImportExport, sparseMorphTargetsRoundtrip) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/glTF-Sample-Models/AnimatedMorphCube-glTF/AnimatedMorphCube.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_LT(0u, scene->mNumMeshes);
+    ASSERT_LT(0u, scene->mMeshes[0]->mNumAnimMeshes);
+
+    // the targets are written as sparse accessors, which the importer patches on first access
+    Assimp::Exporter exporter;
+    ExportProperties props;
+    props.SetPropertyBool("GLTF2_SPARSE_ACCESSOR_EXP", true);
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "glb2", ASSIMP_TEST_MODELS_DIR "/glTF2/glTF-Sample-Models/AnimatedMorphCube-glTF/AnimatedMorphCube_sparse_out.glb", 0, &props));
+
+    Assimp::Importer sparseImporter;
+    const aiScene *sparse = sparseImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/glTF-Sample-Models/AnimatedMorphCube-glTF/AnimatedMorphCube_sparse_out.glb", 0);
+    ASSERT_NE(nullptr, sparse);
+    ASSERT_EQ(scene->mNumMeshes, sparse->mNumMeshes);
+    const aiMesh *expected = scene->mMeshes[0];
+    const aiMesh *actual = sparse->mMeshes[0];
+    ASSERT_EQ(expected->mNumAnimMeshes, actual->mNumAnimMeshes);
+    for (unsigned int a = 0; a < expected->mNumAnimMeshes; ++a) {
+        ASSERT_EQ(expected->mAnimMeshes[a]->mNumVertices, actual->mAnimMeshes[a]->mNumVertices);
+        for (unsigned int v = 0; v < expected->mAnimMeshes[a]->mNumVertices; ++v) {
+            EXPECT_TRUE(expected->mAnimMeshes[a]->mVertices[v].Equal(actual->mAnimMeshes[a]->mVertices[v], 1e-5f));
+        }
+    }
+}
+
 TEST_F(utglTF2ImportExport, error_string_preserved) {
     Assimp::Importer importer;
     const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MissingBin/BoxTextured.gltf",
@@ -920,6 +950,25 @@ TEST_F(utglTF2ImportExport, import_dracoEncoded) {
 #endif
 }
 
+TEST_F(utglTF2ImportExport, import_dracoEncodedWithThreads) {
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_GLOB_NUM_THREADS, 4);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/draco/2CylinderEngine.gltf",
+            aiProcess_ValidateDataStructure);
+#ifndef ASSIMP_ENABLE_DRACO
+    // No draco support, scene should not load
+    ASSERT_EQ(scene, nullptr);
+#else
+    // the primitives are decoded up front on the thread pool, the result must not change
+    ASSERT_NE(scene, nullptr);
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/draco/2CylinderEngine.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(serial, nullptr);
+    ExpectSameScene(serial, scene);
+#endif
+}
+
 TEST_F(utglTF2ImportExport, wrongTypes) {
     // Deliberately broken version of the BoxTextured.gltf asset.
     using tup_T = std::tuple<std::string, std::string, std::string, std::string>;
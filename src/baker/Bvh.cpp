@@ -0,0 +1,147 @@
+#include "Bvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static const int MAX_LEAF_TRIANGLES = 4;
+static const float RAY_EPSILON = 1e-7f;
+
+void Bvh::build(std::vector<BvhTriangle> tris) {
+    nodes.clear();
+    triangles.clear();
+    if (tris.empty()) return;
+
+    std::vector<BuildPrimitive> prims(tris.size());
+    for (size_t i = 0; i < tris.size(); i++) {
+        prims[i].centroid = (tris[i].v0 + tris[i].v1 + tris[i].v2) / 3.0f;
+        prims[i].index = static_cast<int>(i);
+    }
+
+    nodes.reserve(tris.size() * 2 / MAX_LEAF_TRIANGLES + 1);
+    buildNode(tris, prims, 0, static_cast<int>(prims.size()));
+
+    // Store triangles in leaf order so each leaf references a contiguous range
+    triangles.reserve(tris.size());
+    for (const BuildPrimitive& prim : prims)
+        triangles.push_back(tris[prim.index]);
+}
+
+int Bvh::buildNode(const std::vector<BvhTriangle>& tris, std::vector<BuildPrimitive>& prims, int first, int count) {
+    int nodeIndex = static_cast<int>(nodes.size());
+    nodes.push_back(Node());
+
+    glm::vec3 bmin(std::numeric_limits<float>::max());
+    glm::vec3 bmax(-std::numeric_limits<float>::max());
+    glm::vec3 cmin = bmin, cmax = bmax;
+    for (int i = first; i < first + count; i++) {
+        const BvhTriangle& t = tris[prims[i].index];
+        bmin = glm::min(bmin, glm::min(t.v0, glm::min(t.v1, t.v2)));
+        bmax = glm::max(bmax, glm::max(t.v0, glm::max(t.v1, t.v2)));
+        cmin = glm::min(cmin, prims[i].centroid);
+        cmax = glm::max(cmax, prims[i].centroid);
+    }
+    nodes[nodeIndex].boundsMin = bmin;
+    nodes[nodeIndex].boundsMax = bmax;
+
+    if (count <= MAX_LEAF_TRIANGLES) {
+        nodes[nodeIndex].first = first;
+        nodes[nodeIndex].count = count;
+        return nodeIndex;
+    }
+
+    glm::vec3 extent = cmax - cmin;
+    int axis = 0;
+    if (extent.y > extent[axis]) axis = 1;
+    if (extent.z > extent[axis]) axis = 2;
+
+    // Object median split on the widest centroid axis: keeps the tree balanced (depth ~log2 n)
+    // even for the stacked, coplanar geometry the architectural models are full of
+    int mid = first + count / 2;
+    std::nth_element(prims.begin() + first, prims.begin() + mid, prims.begin() + first + count,
+                     [axis](const BuildPrimitive& a, const BuildPrimitive& b) { return a.centroid[axis] < b.centroid[axis]; });
+
+    buildNode(tris, prims, first, mid - first);
+    int right = buildNode(tris, prims, mid, first + count - mid);
+    nodes[nodeIndex].first = right;
+    nodes[nodeIndex].count = 0;
+    return nodeIndex;
+}
+
+static inline bool rayBox(const glm::vec3& origin, const glm::vec3& invDir,
+                          const glm::vec3& bmin, const glm::vec3& bmax, float maxT) {
+    glm::vec3 t0 = (bmin - origin) * invDir;
+    glm::vec3 t1 = (bmax - origin) * invDir;
+    glm::vec3 tmin = glm::min(t0, t1);
+    glm::vec3 tmax = glm::max(t0, t1);
+    float enter = std::max(std::max(tmin.x, tmin.y), std::max(tmin.z, 0.0f));
+    float exit = std::min(std::min(tmax.x, tmax.y), std::min(tmax.z, maxT));
+    return enter <= exit;
+}
+
+// Moller-Trumbore, two sided so back faces of thin walls still block light
+static inline bool rayTriangle(const glm::vec3& origin, const glm::vec3& dir, const BvhTriangle& tri,
+                               float maxT, float& t, float& u, float& v) {
+    glm::vec3 e1 = tri.v1 - tri.v0;
+    glm::vec3 e2 = tri.v2 - tri.v0;
+    glm::vec3 p = glm::cross(dir, e2);
+    float det = glm::dot(e1, p);
+    if (std::fabs(det) < RAY_EPSILON) return false;
+    float invDet = 1.0f / det;
+    glm::vec3 s = origin - tri.v0;
+    u = glm::dot(s, p) * invDet;
+    if (u < 0.0f || u > 1.0f) return false;
+    glm::vec3 q = glm::cross(s, e1);
+    v = glm::dot(dir, q) * invDet;
+    if (v < 0.0f || u + v > 1.0f) return false;
+    t = glm::dot(e2, q) * invDet;
+    return t > 0.0f && t < maxT;
+}
+
+template <bool AnyHit>
+bool Bvh::traverse(const glm::vec3& origin, const glm::vec3& dir, float maxT, BvhHit& hit) const {
+    if (nodes.empty()) return false;
+
+    // Nudge zero components so the slab test never computes 0 * inf
+    glm::vec3 invDir;
+    for (int i = 0; i < 3; i++)
+        invDir[i] = 1.0f / (std::fabs(dir[i]) > 1e-12f ? dir[i] : std::copysign(1e-12f, dir[i]));
+    int stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    bool found = false;
+    hit.t = maxT;
+
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+        if (!rayBox(origin, invDir, node.boundsMin, node.boundsMax, hit.t)) continue;
+
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++) {
+                float t, u, v;
+                if (rayTriangle(origin, dir, triangles[i], hit.t, t, u, v)) {
+                    hit.t = t;
+                    hit.u = u;
+                    hit.v = v;
+                    hit.triangle = i;
+                    found = true;
+                    if (AnyHit) return true;
+                }
+            }
+        } else {
+            int left = static_cast<int>(&node - nodes.data()) + 1;
+            stack[stackSize++] = node.first;
+            stack[stackSize++] = left;
+        }
+    }
+    return found;
+}
+
+bool Bvh::intersect(const glm::vec3& origin, const glm::vec3& dir, float maxT, BvhHit& hit) const {
+    return traverse<false>(origin, dir, maxT, hit);
+}
+
+bool Bvh::occluded(const glm::vec3& origin, const glm::vec3& dir, float maxT) const {
+    BvhHit hit;
+    return traverse<true>(origin, dir, maxT, hit);
+}
@@ -0,0 +1,52 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <glm/glm.hpp>
+#include <vector>
+
+struct BvhTriangle {
+    glm::vec3 v0, v1, v2;
+    glm::vec3 n0, n1, n2;   // smooth vertex normals for shading hit points
+    glm::vec3 albedo;       // diffuse reflectance used for bounce light
+};
+
+struct BvhHit {
+    float t;
+    float u, v;             // barycentrics of v1 and v2
+    int triangle;
+};
+
+// Bounding volume hierarchy over the static scene triangles. Built once, then
+// queried read-only from every baker thread, so traversal must stay const.
+class Bvh {
+public:
+    void build(std::vector<BvhTriangle> tris);
+
+    bool intersect(const glm::vec3& origin, const glm::vec3& dir, float maxT, BvhHit& hit) const;
+    bool occluded(const glm::vec3& origin, const glm::vec3& dir, float maxT) const;
+
+    const BvhTriangle& triangle(int i) const { return triangles[i]; }
+    size_t triangleCount() const { return triangles.size(); }
+
+private:
+    struct Node {
+        glm::vec3 boundsMin;
+        glm::vec3 boundsMax;
+        int first;   // first triangle for leaves, right child for interior nodes (left child is this + 1)
+        int count;   // 0 for interior nodes
+    };
+
+    struct BuildPrimitive {
+        glm::vec3 centroid;
+        int index;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<BvhTriangle> triangles;
+
+    int buildNode(const std::vector<BvhTriangle>& tris, std::vector<BuildPrimitive>& prims, int first, int count);
+    template <bool AnyHit>
+    bool traverse(const glm::vec3& origin, const glm::vec3& dir, float maxT, BvhHit& hit) const;
+};
+
+#endif
@@ -0,0 +1,514 @@
+// Offline lightmap baker for the static point lights in SceneData.h.
+//
+// Every opaque scene model is imported with the same post-processing as the renderer,
+// each triangle gets its own chart in a per-model atlas, and every texel is path traced
+// on all cores against a BVH of the whole scene: direct light from the point lights with
+// shadows, plus diffuse bounce light. Results go to models/lightmaps/ (see LightmapFormat.h).
+//
+// Usage: lightmap_baker [--samples N] [--bounces N] [--density TEXELS_PER_UNIT]
+//                       [--atlas SIZE] [--threads N] [ModelName ...]
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../SceneData.h"
+#include "../LightmapFormat.h"
+#include "Bvh.h"
+
+static const int CHART_PADDING = 1;        // texels around each triangle so bilinear filtering never reads a neighbour
+static const float RAY_OFFSET = 0.01f;     // scene units, keeps secondary rays off their own surface
+static const float MAX_ALBEDO = 0.9f;      // energy conserving bounce
+static const float DENSITY_FALLBACK = 0.8f; // shrink factor when a model does not fit its atlas
+
+struct BakeOptions {
+    int samples = 64;
+    int bounces = 2;
+    float texelsPerUnit = 4.0f;
+    int atlasSize = 2048;
+    unsigned int threads = 0; // 0 = all hardware threads
+    std::string modelDirectory = "models";
+    std::vector<std::string> models;
+};
+
+// One triangle's chart: the triangle laid flat with its longest edge on the u axis
+struct Chart {
+    int mesh;
+    int corner;          // offset of the triangle's first corner in the mesh's corner list
+    int order[3];        // original corner index for local corners A, B, C
+    glm::vec2 local[3];  // A, B, C in world units, A at the origin
+    int x, y, w, h;      // texel rectangle in the atlas, padding included
+    float density;
+};
+
+struct BakeMesh {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<unsigned int> corners;      // vertex index per face corner, in face order
+    std::vector<unsigned int> triangleStarts; // corner offset of each triangle face
+    glm::vec3 albedo;
+};
+
+struct BakeModel {
+    std::string name;
+    std::vector<BakeMesh> meshes;
+};
+
+// --- Loading ---
+
+static void collectMeshes(const aiNode* node, const aiScene* scene, BakeModel& model) {
+    // Same traversal order as Model::processNode so mesh indices line up at runtime
+    for (unsigned int i = 0; i < node->mNumMeshes; i++) {
+        const aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
+        BakeMesh bakeMesh;
+        bakeMesh.positions.resize(mesh->mNumVertices);
+        bakeMesh.normals.resize(mesh->mNumVertices, glm::vec3(0.0f));
+        for (unsigned int v = 0; v < mesh->mNumVertices; v++) {
+            bakeMesh.positions[v] = glm::vec3(mesh->mVertices[v].x, mesh->mVertices[v].y, mesh->mVertices[v].z);
+            if (mesh->HasNormals())
+                bakeMesh.normals[v] = glm::vec3(mesh->mNormals[v].x, mesh->mNormals[v].y, mesh->mNormals[v].z);
+        }
+        for (unsigned int f = 0; f < mesh->mNumFaces; f++) {
+            const aiFace& face = mesh->mFaces[f];
+            if (face.mNumIndices == 3)
+                bakeMesh.triangleStarts.push_back(static_cast<unsigned int>(bakeMesh.corners.size()));
+            for (unsigned int j = 0; j < face.mNumIndices; j++)
+                bakeMesh.corners.push_back(face.mIndices[j]);
+        }
+
+        aiColor3D diffuse(0.8f, 0.8f, 0.8f);
+        scene->mMaterials[mesh->mMaterialIndex]->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);
+        // Matches the fragment shader's fallback for black albedo
+        if (diffuse.r + diffuse.g + diffuse.b < 0.01f) diffuse = aiColor3D(0.8f, 0.8f, 0.8f);
+        bakeMesh.albedo = glm::min(glm::vec3(diffuse.r, diffuse.g, diffuse.b), glm::vec3(MAX_ALBEDO));
+
+        model.meshes.push_back(std::move(bakeMesh));
+    }
+    for (unsigned int i = 0; i < node->mNumChildren; i++)
+        collectMeshes(node->mChildren[i], scene, model);
+}
+
+static bool loadModel(const std::string& directory, const std::string& name, BakeModel& model) {
+    Assimp::Importer importer;
+    std::string path = directory + "/" + name + ".obj";
+    const aiScene* scene = importer.ReadFile(path, SCENE_IMPORT_FLAGS);
+    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+        std::cerr << "ERROR::ASSIMP:: " << path << ": " << importer.GetErrorString() << std::endl;
+        return false;
+    }
+    model.name = name;
+    collectMeshes(scene->mRootNode, scene, model);
+    return true;
+}
+
+// --- Unwrapping and packing ---
+
+static std::vector<Chart> buildCharts(const BakeModel& model) {
+    std::vector<Chart> charts;
+    for (size_t m = 0; m < model.meshes.size(); m++) {
+        const BakeMesh& mesh = model.meshes[m];
+        for (unsigned int start : mesh.triangleStarts) {
+            glm::vec3 p[3];
+            for (int k = 0; k < 3; k++) p[k] = mesh.positions[mesh.corners[start + k]];
+
+            // Longest edge becomes the base so the third corner projects inside it
+            int base = 0;
+            float longest = -1.0f;
+            for (int k = 0; k < 3; k++) {
+                float len = glm::length(p[(k + 1) % 3] - p[k]);
+                if (len > longest) { longest = len; base = k; }
+            }
+
+            Chart chart;
+            chart.mesh = static_cast<int>(m);
+            chart.corner = static_cast<int>(start);
+            for (int k = 0; k < 3; k++) chart.order[k] = (base + k) % 3;
+
+            glm::vec3 a = p[chart.order[0]], b = p[chart.order[1]], c = p[chart.order[2]];
+            glm::vec3 uAxis = longest > 0.0f ? (b - a) / longest : glm::vec3(1.0f, 0.0f, 0.0f);
+            float cu = glm::dot(c - a, uAxis);
+            float cv = glm::length((c - a) - uAxis * cu);
+            chart.local[0] = glm::vec2(0.0f, 0.0f);
+            chart.local[1] = glm::vec2(longest, 0.0f);
+            chart.local[2] = glm::vec2(cu, cv);
+            chart.x = chart.y = chart.w = chart.h = 0;
+            chart.density = 0.0f;
+            charts.push_back(chart);
+        }
+    }
+    return charts;
+}
+
+// Shelf packer, tallest charts first. Returns the used height, or -1 if the charts do not fit.
+static int packCharts(std::vector<Chart>& charts, int atlasSize, float density) {
+    for (Chart& chart : charts) {
+        chart.density = density;
+        chart.w = static_cast<int>(std::ceil(chart.local[1].x * density)) + 2 * CHART_PADDING;
+        chart.h = static_cast<int>(std::ceil(chart.local[2].y * density)) + 2 * CHART_PADDING;
+        chart.w = std::max(chart.w, 1 + 2 * CHART_PADDING);
+        chart.h = std::max(chart.h, 1 + 2 * CHART_PADDING);
+        if (chart.w > atlasSize || chart.h > atlasSize) return -1;
+    }
+
+    std::vector<size_t> order(charts.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return charts[a].h > charts[b].h; });
+
+    int shelfX = 0, shelfY = 0, shelfHeight = 0;
+    for (size_t i : order) {
+        Chart& chart = charts[i];
+        if (shelfX + chart.w > atlasSize) {
+            shelfY += shelfHeight;
+            shelfX = 0;
+            shelfHeight = 0;
+        }
+        if (shelfY + chart.h > atlasSize) return -1;
+        chart.x = shelfX;
+        chart.y = shelfY;
+        shelfX += chart.w;
+        shelfHeight = std::max(shelfHeight, chart.h);
+    }
+    return shelfY + shelfHeight;
+}
+
+// Texel-space position of a local chart point (before normalising by the atlas size)
+static glm::vec2 chartToAtlas(const Chart& chart, const glm::vec2& local) {
+    return glm::vec2(chart.x + CHART_PADDING, chart.y + CHART_PADDING) + local * chart.density;
+}
+
+// --- Lighting ---
+
+struct Rng {
+    uint32_t state;
+    explicit Rng(uint32_t seed) : state(seed * 747796405u + 2891336453u) {}
+    float next() {
+        // PCG-style hash step, plenty for Monte Carlo sample directions
+        state = state * 747796405u + 2891336453u;
+        uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+        word = (word >> 22u) ^ word;
+        return (word >> 8) * (1.0f / 16777216.0f);
+    }
+};
+
+static glm::vec3 cosineSampleHemisphere(const glm::vec3& n, Rng& rng) {
+    float r1 = rng.next(), r2 = rng.next();
+    float phi = 6.28318531f * r1;
+    float r = std::sqrt(r2);
+    glm::vec3 tangent = std::fabs(n.x) > 0.5f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+    tangent = glm::normalize(glm::cross(tangent, n));
+    glm::vec3 bitangent = glm::cross(n, tangent);
+    return glm::normalize(tangent * (r * std::cos(phi)) + bitangent * (r * std::sin(phi)) + n * std::sqrt(1.0f - r2));
+}
+
+// Point-light irradiance in the same units as CalcPointLight in fragmentShader.glsl
+// (diffuse * N.L * attenuation, plus the per-light ambient), so baked and dynamic match.
+static glm::vec3 directLight(const Bvh& bvh, const glm::vec3& p, const glm::vec3& n) {
+    glm::vec3 result(0.0f);
+    glm::vec3 origin = p + n * RAY_OFFSET;
+    for (int l = 0; l < SCENE_POINT_LIGHT_COUNT; l++) {
+        const PointLightData& light = SCENE_POINT_LIGHTS[l];
+        glm::vec3 toLight = light.position - p;
+        float distance = glm::length(toLight);
+        float attenuation = 1.0f / (POINT_LIGHT_CONSTANT + light.linear * distance + light.quadratic * distance * distance);
+        result += POINT_LIGHT_AMBIENT * attenuation;
+
+        if (distance <= RAY_OFFSET) continue;
+        glm::vec3 dir = toLight / distance;
+        float ndl = glm::dot(n, dir);
+        if (ndl <= 0.0f) continue;
+        if (bvh.occluded(origin, dir, distance - 2.0f * RAY_OFFSET)) continue;
+        result += POINT_LIGHT_DIFFUSE * ndl * attenuation;
+    }
+    return result;
+}
+
+static glm::vec3 shadingNormal(const BvhTriangle& tri, float u, float v, const glm::vec3& incoming) {
+    glm::vec3 n = tri.n0 * (1.0f - u - v) + tri.n1 * u + tri.n2 * v;
+    if (glm::dot(n, n) < 1e-12f) n = glm::cross(tri.v1 - tri.v0, tri.v2 - tri.v0);
+    n = glm::normalize(n);
+    return glm::dot(n, incoming) > 0.0f ? -n : n; // face the arriving ray
+}
+
+// Cosine-weighted path tracing; with the shader's albedo * irradiance convention the
+// estimator for bounce irradiance is simply the mean incoming radiance.
+static glm::vec3 indirectLight(const Bvh& bvh, const glm::vec3& p, const glm::vec3& n, int samples, int bounces, Rng& rng) {
+    if (samples <= 0 || bounces <= 0) return glm::vec3(0.0f);
+    glm::vec3 sum(0.0f);
+    for (int s = 0; s < samples; s++) {
+        glm::vec3 origin = p + n * RAY_OFFSET;
+        glm::vec3 normal = n;
+        glm::vec3 throughput(1.0f);
+        for (int bounce = 0; bounce < bounces; bounce++) {
+            glm::vec3 dir = cosineSampleHemisphere(normal, rng);
+            BvhHit hit;
+            if (!bvh.intersect(origin, dir, 1e30f, hit)) break;
+            const BvhTriangle& tri = bvh.triangle(hit.triangle);
+            glm::vec3 hitPos = origin + dir * hit.t;
+            normal = shadingNormal(tri, hit.u, hit.v, dir);
+            throughput *= tri.albedo;
+            sum += throughput * directLight(bvh, hitPos, normal);
+            origin = hitPos + normal * RAY_OFFSET;
+        }
+    }
+    return sum / static_cast<float>(samples);
+}
+
+// --- Baking ---
+
+static void bakeChart(const Bvh& bvh, const BakeMesh& mesh, const Chart& chart, const BakeOptions& options,
+                      int atlasWidth, std::vector<glm::vec3>& atlas, uint32_t seed) {
+    glm::vec3 p[3], n[3];
+    for (int k = 0; k < 3; k++) {
+        unsigned int vertex = mesh.corners[chart.corner + chart.order[k]];
+        p[k] = mesh.positions[vertex];
+        n[k] = mesh.normals[vertex];
+    }
+    glm::vec3 faceNormal = glm::cross(p[1] - p[0], p[2] - p[0]);
+    if (glm::dot(faceNormal, faceNormal) < 1e-20f) return; // degenerate, leave black
+    faceNormal = glm::normalize(faceNormal);
+
+    const float baseLength = chart.local[1].x;
+    const glm::vec2 apex = chart.local[2];
+    Rng rng(seed);
+
+    for (int y = chart.y; y < chart.y + chart.h; y++) {
+        for (int x = chart.x; x < chart.x + chart.w; x++) {
+            // Texel centre in the chart's local frame
+            glm::vec2 q = (glm::vec2(x + 0.5f, y + 0.5f) - glm::vec2(chart.x + CHART_PADDING, chart.y + CHART_PADDING)) / chart.density;
+
+            float b2 = apex.y > 1e-8f ? q.y / apex.y : 0.0f;
+            float b1 = baseLength > 1e-8f ? (q.x - b2 * apex.x) / baseLength : 0.0f;
+            float b0 = 1.0f - b1 - b2;
+            // Padding texels fall outside the triangle: clamp onto it so they carry edge lighting
+            b0 = std::max(b0, 0.0f);
+            b1 = std::max(b1, 0.0f);
+            b2 = std::max(b2, 0.0f);
+            float sum = b0 + b1 + b2;
+            b0 /= sum; b1 /= sum; b2 /= sum;
+
+            glm::vec3 pos = p[0] * b0 + p[1] * b1 + p[2] * b2;
+            glm::vec3 normal = n[0] * b0 + n[1] * b1 + n[2] * b2;
+            normal = glm::dot(normal, normal) > 1e-12f ? glm::normalize(normal) : faceNormal;
+
+            glm::vec3 irradiance = directLight(bvh, pos, normal);
+            irradiance += indirectLight(bvh, pos, normal, options.samples, options.bounces, rng);
+            atlas[static_cast<size_t>(y) * atlasWidth + x] = irradiance;
+        }
+    }
+}
+
+static void bakeAtlas(const Bvh& bvh, const BakeModel& model, const std::vector<Chart>& charts,
+                      const BakeOptions& options, int atlasWidth, std::vector<glm::vec3>& atlas) {
+    unsigned int threadCount = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<size_t> nextChart(0);
+    std::atomic<size_t> chartsDone(0);
+
+    // Charts own disjoint texel rectangles, so workers write the atlas without locking
+    auto worker = [&]() {
+        for (;;) {
+            size_t i = nextChart.fetch_add(1);
+            if (i >= charts.size()) break;
+            const Chart& chart = charts[i];
+            bakeChart(bvh, model.meshes[chart.mesh], chart, options, atlasWidth, atlas, static_cast<uint32_t>(i));
+            chartsDone.fetch_add(1);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threadCount; t++)
+        workers.emplace_back(worker);
+
+    size_t lastPercent = 0;
+    while (chartsDone.load() < charts.size()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        size_t percent = chartsDone.load() * 100 / std::max<size_t>(charts.size(), 1);
+        if (percent >= lastPercent + 10) {
+            std::cout << "    " << percent << "%" << std::endl;
+            lastPercent = percent;
+        }
+    }
+    for (std::thread& t : workers) t.join();
+}
+
+// --- Output ---
+
+static bool writeHdr(const std::string& path, int width, int height, const std::vector<glm::vec3>& pixels) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    out << "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y " << height << " +X " << width << "\n";
+
+    // Flat (non run-length) RGBE scanlines, which stb_image reads back directly
+    std::vector<unsigned char> row(static_cast<size_t>(width) * 4);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const glm::vec3& c = pixels[static_cast<size_t>(y) * width + x];
+            float maxComponent = std::max(c.x, std::max(c.y, c.z));
+            unsigned char* rgbe = &row[static_cast<size_t>(x) * 4];
+            if (maxComponent < 1e-32f) {
+                rgbe[0] = rgbe[1] = rgbe[2] = rgbe[3] = 0;
+            } else {
+                int exponent;
+                float scale = std::frexp(maxComponent, &exponent) * 256.0f / maxComponent;
+                rgbe[0] = static_cast<unsigned char>(c.x * scale);
+                rgbe[1] = static_cast<unsigned char>(c.y * scale);
+                rgbe[2] = static_cast<unsigned char>(c.z * scale);
+                rgbe[3] = static_cast<unsigned char>(exponent + 128);
+            }
+        }
+        out.write(reinterpret_cast<const char*>(row.data()), row.size());
+    }
+    return static_cast<bool>(out);
+}
+
+static bool writeLightmapUVs(const std::string& path, const BakeModel& model, const std::vector<Chart>& charts,
+                             int atlasWidth, int atlasHeight) {
+    std::vector<std::vector<glm::vec2>> uvs(model.meshes.size());
+    for (size_t m = 0; m < model.meshes.size(); m++)
+        uvs[m].assign(model.meshes[m].corners.size(), glm::vec2(0.0f)); // non-triangle corners stay at 0,0
+
+    glm::vec2 atlasSize(static_cast<float>(atlasWidth), static_cast<float>(atlasHeight));
+    for (const Chart& chart : charts) {
+        for (int k = 0; k < 3; k++)
+            uvs[chart.mesh][chart.corner + chart.order[k]] = chartToAtlas(chart, chart.local[k]) / atlasSize;
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+    LightmapFileHeader header;
+    header.magic = LIGHTMAP_MAGIC;
+    header.version = LIGHTMAP_VERSION;
+    header.atlasWidth = static_cast<uint32_t>(atlasWidth);
+    header.atlasHeight = static_cast<uint32_t>(atlasHeight);
+    header.meshCount = static_cast<uint32_t>(uvs.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const std::vector<glm::vec2>& meshUVs : uvs) {
+        uint32_t count = static_cast<uint32_t>(meshUVs.size());
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        out.write(reinterpret_cast<const char*>(meshUVs.data()), meshUVs.size() * sizeof(glm::vec2));
+    }
+    return static_cast<bool>(out);
+}
+
+// --- Driver ---
+
+static void appendOccluders(const BakeModel& model, std::vector<BvhTriangle>& triangles) {
+    for (const BakeMesh& mesh : model.meshes) {
+        for (unsigned int start : mesh.triangleStarts) {
+            BvhTriangle tri;
+            unsigned int i0 = mesh.corners[start], i1 = mesh.corners[start + 1], i2 = mesh.corners[start + 2];
+            tri.v0 = mesh.positions[i0]; tri.v1 = mesh.positions[i1]; tri.v2 = mesh.positions[i2];
+            tri.n0 = mesh.normals[i0];   tri.n1 = mesh.normals[i1];   tri.n2 = mesh.normals[i2];
+            tri.albedo = mesh.albedo;
+            triangles.push_back(tri);
+        }
+    }
+}
+
+static bool parseArguments(int argc, char** argv, BakeOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--samples" && hasValue) options.samples = std::atoi(argv[++i]);
+        else if (arg == "--bounces" && hasValue) options.bounces = std::atoi(argv[++i]);
+        else if (arg == "--density" && hasValue) options.texelsPerUnit = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--atlas" && hasValue) options.atlasSize = std::atoi(argv[++i]);
+        else if (arg == "--threads" && hasValue) options.threads = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else if (arg == "--models" && hasValue) options.modelDirectory = argv[++i];
+        else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return false;
+        }
+        else options.models.push_back(arg);
+    }
+    if (options.models.empty()) options.models = SCENE_OPAQUE_MODEL_NAMES;
+    return options.atlasSize > 0 && options.texelsPerUnit > 0.0f;
+}
+
+int main(int argc, char** argv) {
+    BakeOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << "Usage: lightmap_baker [--samples N] [--bounces N] [--density TEXELS_PER_UNIT] "
+                     "[--atlas SIZE] [--threads N] [--models DIR] [ModelName ...]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "=== Lightmap Baker ===" << std::endl;
+    std::cout << SCENE_POINT_LIGHT_COUNT << " point lights, " << options.samples << " samples, "
+              << options.bounces << " bounces" << std::endl;
+
+    // Every opaque model occludes, even the ones we are not re-baking this run
+    std::vector<BakeModel> sceneModels;
+    std::vector<BvhTriangle> occluders;
+    for (const std::string& name : SCENE_OPAQUE_MODEL_NAMES) {
+        BakeModel model;
+        if (!loadModel(options.modelDirectory, name, model)) continue;
+        appendOccluders(model, occluders);
+        sceneModels.push_back(std::move(model));
+    }
+    std::cout << "Building BVH over " << occluders.size() << " triangles..." << std::endl;
+    Bvh bvh;
+    bvh.build(std::move(occluders));
+
+    std::string outputDirectory = lightmapDirectory(options.modelDirectory);
+    std::error_code ec;
+    std::filesystem::create_directories(outputDirectory, ec);
+    int failures = 0;
+    for (const std::string& name : options.models) {
+        auto it = std::find_if(sceneModels.begin(), sceneModels.end(), [&](const BakeModel& m) { return m.name == name; });
+        if (it == sceneModels.end()) {
+            std::cerr << "Skipping " << name << ": not a loaded opaque scene model" << std::endl;
+            failures++;
+            continue;
+        }
+        const BakeModel& model = *it;
+
+        std::vector<Chart> charts = buildCharts(model);
+        if (charts.empty()) continue;
+
+        float density = options.texelsPerUnit;
+        int usedHeight = packCharts(charts, options.atlasSize, density);
+        while (usedHeight < 0 && density > 1e-3f) {
+            density *= DENSITY_FALLBACK;
+            usedHeight = packCharts(charts, options.atlasSize, density);
+        }
+        if (usedHeight < 0) {
+            std::cerr << "ERROR: " << name << " does not fit a " << options.atlasSize << " atlas" << std::endl;
+            failures++;
+            continue;
+        }
+
+        int atlasWidth = options.atlasSize;
+        int atlasHeight = (usedHeight + 3) & ~3;
+        std::cout << "Baking " << name << ": " << charts.size() << " charts, " << atlasWidth << "x" << atlasHeight
+                  << " at " << density << " texels/unit" << std::endl;
+
+        std::vector<glm::vec3> atlas(static_cast<size_t>(atlasWidth) * atlasHeight, glm::vec3(0.0f));
+        bakeAtlas(bvh, model, charts, options, atlasWidth, atlas);
+
+        std::string base = outputDirectory + "/" + name;
+        if (!writeHdr(base + ".hdr", atlasWidth, atlasHeight, atlas) ||
+            !writeLightmapUVs(base + ".lmuv", model, charts, atlasWidth, atlasHeight)) {
+            std::cerr << "ERROR: Failed to write " << base << ".hdr/.lmuv" << std::endl;
+            failures++;
+            continue;
+        }
+        std::cout << "✓ " << name << " baked." << std::endl;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
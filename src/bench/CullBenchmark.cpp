@@ -0,0 +1,137 @@
+// Micro-benchmark for the frustum culling kernels: times the scalar, SSE and AVX2 paths
+// over the same random scene and checks that they produce identical visible lists.
+//
+// Usage: cull_bench [--objects N] [--frames N]
+
+#include "../FrustumCuller.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Column-major perspective * yaw rotation, matching glm::perspective * glm::lookAt for a
+// camera at the origin turning about +Y
+static void makeViewProjection(float yaw, float* m) {
+    const float fovy = 45.0f * 3.14159265f / 180.0f, aspect = 0.75f, zNear = 0.1f, zFar = 200.0f;
+    float f = 1.0f / std::tan(fovy * 0.5f);
+    float proj[16] = {0};
+    proj[0] = f / aspect;
+    proj[5] = f;
+    proj[10] = (zFar + zNear) / (zNear - zFar);
+    proj[11] = -1.0f;
+    proj[14] = 2.0f * zFar * zNear / (zNear - zFar);
+
+    float c = std::cos(yaw), s = std::sin(yaw);
+    float view[16] = {c, 0, s, 0,  0, 1, 0, 0,  -s, 0, c, 0,  0, 0, 0, 1};
+
+    for (int col = 0; col < 4; col++)
+        for (int row = 0; row < 4; row++) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++) sum += proj[k * 4 + row] * view[col * 4 + k];
+            m[col * 4 + row] = sum;
+        }
+}
+
+struct Result {
+    double nsPerObject;
+    size_t visible;
+    bool matches;
+};
+
+template <typename Kernel>
+static Result run(Kernel kernel, const CullingBounds& bounds, const std::vector<FrustumPlanes>& frames,
+                  CullPath path, const std::vector<std::vector<uint32_t>>* reference, std::vector<std::vector<uint32_t>>* record) {
+    std::vector<uint32_t> visible(bounds.size());
+    Result result = {0.0, 0, true};
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; repeat++) {
+        size_t total = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t f = 0; f < frames.size(); f++) {
+            size_t count = kernel(frames[f], bounds, visible.data(), path);
+            total += count;
+            if (repeat == 0) {
+                if (record) record->emplace_back(visible.begin(), visible.begin() + count);
+                if (reference) {
+                    const std::vector<uint32_t>& expected = (*reference)[f];
+                    result.matches = result.matches && expected.size() == count &&
+                                     std::equal(expected.begin(), expected.end(), visible.begin());
+                }
+            }
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, ns);
+        result.visible = total / frames.size();
+    }
+    result.nsPerObject = best / (double(frames.size()) * bounds.size());
+    return result;
+}
+
+template <typename Kernel>
+static void benchmark(const char* name, Kernel kernel, const CullingBounds& bounds, const std::vector<FrustumPlanes>& frames) {
+    std::vector<std::vector<uint32_t>> reference;
+    Result scalar = run(kernel, bounds, frames, CullPath::Scalar, nullptr, &reference);
+
+    std::cout << "\n" << name << " (" << scalar.visible << " of " << bounds.size() << " visible per frame)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  " << std::setw(8) << "scalar" << ": " << scalar.nsPerObject << " ns/object" << std::endl;
+
+    CullPath best = detectCullPath();
+    for (CullPath path : {CullPath::SSE, CullPath::AVX2}) {
+        if (path > best) {
+            std::cout << "  " << std::setw(8) << cullPathName(path) << ": not supported on this CPU" << std::endl;
+            continue;
+        }
+        Result r = run(kernel, bounds, frames, path, &reference, nullptr);
+        std::cout << "  " << std::setw(8) << cullPathName(path) << ": " << r.nsPerObject << " ns/object, "
+                  << std::setprecision(2) << scalar.nsPerObject / r.nsPerObject << "x"
+                  << (r.matches ? "" : "  MISMATCH vs scalar") << std::setprecision(3) << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t objectCount = 50000;
+    int frameCount = 64;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--objects" && i + 1 < argc) objectCount = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--frames" && i + 1 < argc) frameCount = std::atoi(argv[++i]);
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--objects N] [--frames N]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Objects scattered around the camera, sized like furniture meshes
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> position(-150.0f, 150.0f);
+    std::uniform_real_distribution<float> size(0.1f, 4.0f);
+    CullingBounds bounds;
+    for (size_t i = 0; i < objectCount; i++) {
+        float c[3] = {position(rng), position(rng) * 0.1f, position(rng)};
+        float e[3] = {size(rng), size(rng), size(rng)};
+        float mn[3] = {c[0] - e[0], c[1] - e[1], c[2] - e[2]};
+        float mx[3] = {c[0] + e[0], c[1] + e[1], c[2] + e[2]};
+        bounds.add(mn, mx);
+    }
+
+    std::vector<FrustumPlanes> frames;
+    for (int f = 0; f < frameCount; f++) {
+        float m[16];
+        makeViewProjection(6.2831853f * f / frameCount, m);
+        frames.push_back(FrustumPlanes::fromMatrix(m));
+    }
+
+    std::cout << "Culling " << objectCount << " objects over " << frameCount << " camera directions, best of 5 runs" << std::endl;
+    std::cout << "Runtime-selected path: " << cullPathName(detectCullPath()) << std::endl;
+    benchmark("Bounding spheres", cullSpheres, bounds, frames);
+    benchmark("AABBs", cullAabbs, bounds, frames);
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Micro-benchmark for the Assimp number parsers: times the batched fast_atoreal_n() and
+// strtoul10_run() against the one-value-at-a-time fast_atoreal_move() and strtoul10() over
+// the same generated text and checks that they produce identical values.
+//
+// Usage: atof_bench [--numbers N] [--repeats N]
+
+#include <assimp/fast_atof.h>
+#include <assimp/ParsingUtils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Numbers of every digit count with a line break after every seventh, as generated by the
+// FastAtof unit tests, so both the 16-byte windows and the tails are covered
+static std::string makeNumberText(size_t count) {
+    std::mt19937 rng(42);
+    std::string text;
+    char number[64];
+    for (size_t i = 0; i < count; i++) {
+        const int intDigits = static_cast<int>(rng() % 12);
+        const int decimals = static_cast<int>(rng() % 19);
+        std::string digits;
+        for (int d = 0; d < intDigits + decimals; d++) {
+            digits += static_cast<char>('0' + rng() % 10);
+        }
+        snprintf(number, sizeof(number), "%s%s%s%s%s", (rng() % 2) ? "-" : "",
+                 intDigits ? digits.substr(0, intDigits).c_str() : "0", decimals ? "." : "",
+                 digits.substr(intDigits).c_str(), (rng() % 8) ? "" : "e-7");
+        text += number;
+        text += (i % 7 == 6) ? '\n' : ' ';
+    }
+    return text;
+}
+
+// Vertex indices as found in the <p> elements of a Collada file
+static std::string makeIndexText(size_t count) {
+    std::mt19937 rng(42);
+    std::string text;
+    for (size_t i = 0; i < count; i++) {
+        text += std::to_string(rng() % 1000000);
+        text += (i % 7 == 6) ? '\n' : ' ';
+    }
+    return text;
+}
+
+struct Result {
+    double nsPerNumber;
+    size_t count;
+};
+
+// Best of repeats runs of parse(text, values), which returns the number of values read
+template <typename T, typename Parse>
+static Result run(Parse parse, const std::string& text, std::vector<T>& values, int repeats) {
+    Result result = {1e30, 0};
+    for (int repeat = 0; repeat < repeats; repeat++) {
+        values.clear();
+        auto start = std::chrono::steady_clock::now();
+        result.count = parse(text, values);
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        result.nsPerNumber = std::min(result.nsPerNumber, ns / std::max<size_t>(result.count, 1));
+    }
+    return result;
+}
+
+template <typename T>
+static void report(const char* name, const std::string& text, const Result& scalar, const Result& batch,
+                   const std::vector<T>& expected, const std::vector<T>& values) {
+    const bool matches = expected == values;
+    std::cout << "\n" << name << " (" << scalar.count << " numbers, " << text.size() / 1024 << " KiB)" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  " << std::setw(8) << "scalar" << ": " << scalar.nsPerNumber << " ns/number, "
+              << std::setprecision(1) << text.size() / scalar.nsPerNumber / scalar.count * 1000.0 << " MB/s" << std::endl;
+    std::cout << std::setprecision(3);
+    std::cout << "  " << std::setw(8) << "batch" << ": " << batch.nsPerNumber << " ns/number, "
+              << std::setprecision(1) << text.size() / batch.nsPerNumber / batch.count * 1000.0 << " MB/s, "
+              << std::setprecision(2) << scalar.nsPerNumber / batch.nsPerNumber << "x"
+              << (matches ? "" : "  MISMATCH vs scalar") << std::endl;
+}
+
+int main(int argc, char** argv) {
+    size_t numberCount = 1000000;
+    int repeats = 5;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--numbers" && i + 1 < argc) numberCount = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--repeats" && i + 1 < argc) repeats = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--numbers N] [--repeats N]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Parsing " << numberCount << " numbers, best of " << repeats << " runs" << std::endl;
+
+    const std::string reals = makeNumberText(numberCount);
+    std::vector<float> expectedReals, batchReals;
+    Result scalar = run<float>([](const std::string& text, std::vector<float>& values) {
+        const char* end = text.c_str() + text.size();
+        const char* c = text.c_str();
+        Assimp::SkipSpacesAndLineEnd(&c, end);
+        while (c != end) {
+            float value = 0.0f;
+            c = Assimp::fast_atoreal_move<float>(c, value);
+            values.push_back(value);
+            Assimp::SkipSpacesAndLineEnd(&c, end);
+        }
+        return values.size();
+    }, reals, expectedReals, repeats);
+    Result batch = run<float>([](const std::string& text, std::vector<float>& values) {
+        // fixed-size batches like the Collada and OBJ importers, anything the batch leaves
+        // goes through the scalar parser
+        const char* end = text.c_str() + text.size();
+        const char* c = text.c_str();
+        float chunk[256];
+        Assimp::SkipSpacesAndLineEnd(&c, end);
+        while (c != end) {
+            const size_t count = Assimp::fast_atoreal_n<float>(c, end, chunk, 256);
+            values.insert(values.end(), chunk, chunk + count);
+            Assimp::SkipSpacesAndLineEnd(&c, end);
+            if (c != end && count < 256) {
+                float value = 0.0f;
+                c = Assimp::fast_atoreal_move<float>(c, value);
+                values.push_back(value);
+                Assimp::SkipSpacesAndLineEnd(&c, end);
+            }
+        }
+        return values.size();
+    }, reals, batchReals, repeats);
+    report("fast_atoreal_move vs fast_atoreal_n", reals, scalar, batch, expectedReals, batchReals);
+
+    const std::string indices = makeIndexText(numberCount);
+    std::vector<uint64_t> expectedIndices, batchIndices;
+    scalar = run<uint64_t>([](const std::string& text, std::vector<uint64_t>& values) {
+        const char* end = text.c_str() + text.size();
+        const char* c = text.c_str();
+        Assimp::SkipSpacesAndLineEnd(&c, end);
+        while (c != end) {
+            values.push_back(Assimp::strtoul10(c, &c));
+            Assimp::SkipSpacesAndLineEnd(&c, end);
+        }
+        return values.size();
+    }, indices, expectedIndices, repeats);
+    batch = run<uint64_t>([](const std::string& text, std::vector<uint64_t>& values) {
+        const char* end = text.c_str() + text.size();
+        const char* c = text.c_str();
+        Assimp::SkipSpacesAndLineEnd(&c, end);
+        while (c != end) {
+            uint64_t value = 0;
+            const unsigned int digits = Assimp::strtoul10_run(c, end, value, 10);
+            if (0 == digits) {
+                break;
+            }
+            c += digits;
+            values.push_back(value);
+            Assimp::SkipSpacesAndLineEnd(&c, end);
+        }
+        return values.size();
+    }, indices, batchIndices, repeats);
+    report("strtoul10 vs strtoul10_run", indices, scalar, batch, expectedIndices, batchIndices);
+    return 0;
+}
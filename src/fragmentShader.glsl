@@ -4,6 +4,7 @@ out vec4 FragColor;
 in vec3 FragPos_world; // Make sure this is world space position
 in vec3 Normal_world;  // Make sure this is world space normal
 in vec2 TexCoords;
+in vec2 LightmapCoords;
 in vec4 FragPosLightSpace; // Position of fragment in light's clip space
 
 struct Material {
@@ -31,6 +32,8 @@ struct PointLight {
     vec3 diffuse;
     vec3 specular;
     bool enabled;
+    int shadowSlot;   // Tile group in pointShadowAtlas, -1 when the light casts no shadow
+    float shadowFar;  // Light radius the atlas distances are normalised by
 };
 
 uniform vec3 viewPos;
@@ -46,6 +49,23 @@ uniform PointLight pointLights[MAX_POINT_LIGHTS];
 // NEW: Shadow map sampler
 uniform sampler2D shadowMap;
 
+// Baked point-light irradiance (direct + bounce) from the offline lightmap baker
+uniform sampler2D lightmap;
+uniform bool hasLightmap;      // set per mesh
+uniform bool useBakedLighting; // global toggle
+
+// Point light shadows: six tiles per light (one per cube face) in a shared depth atlas
+uniform sampler2D pointShadowAtlas;
+uniform int pointShadowTilesPerRow;
+uniform float pointShadowTileSize; // Tile size in atlas UV
+uniform float pointShadowTexel;    // One atlas texel in UV
+
+// Must match FACE_FORWARD / FACE_UP in PointShadowAtlas.cpp
+const vec3 POINT_SHADOW_FORWARD[6] = vec3[6](vec3(1.0, 0.0, 0.0), vec3(-1.0, 0.0, 0.0), vec3(0.0, 1.0, 0.0),
+                                             vec3(0.0, -1.0, 0.0), vec3(0.0, 0.0, 1.0), vec3(0.0, 0.0, -1.0));
+const vec3 POINT_SHADOW_UP[6] = vec3[6](vec3(0.0, -1.0, 0.0), vec3(0.0, -1.0, 0.0), vec3(0.0, 0.0, 1.0),
+                                        vec3(0.0, 0.0, -1.0), vec3(0.0, -1.0, 0.0), vec3(0.0, -1.0, 0.0));
+
 // Ambient control factors (as before)
 const float generalAmbientBaseFactor = 0.001;
 const float lightAmbientStrengthMultiplier = 1.0; // Assuming C++ ambient values are very low
@@ -75,6 +95,48 @@ float CalculateShadow(vec4 fragPosLightSpace, vec3 normal, vec3 lightDir) {
 }
 
 
+// Point Shadow Calculation Function
+float CalculatePointShadow(PointLight light, vec3 fragPos, vec3 normal) {
+    if (light.shadowSlot < 0) return 0.0;
+    vec3 d = fragPos - light.position;
+    float currentDistance = length(d);
+    if (currentDistance >= light.shadowFar) return 0.0;
+
+    // Cube face from the major axis, then project with the same 90 degree frustum the atlas used
+    vec3 a = abs(d);
+    int face;
+    if (a.x >= a.y && a.x >= a.z) face = d.x > 0.0 ? 0 : 1;
+    else if (a.y >= a.z) face = d.y > 0.0 ? 2 : 3;
+    else face = d.z > 0.0 ? 4 : 5;
+    vec3 f = POINT_SHADOW_FORWARD[face];
+    vec3 s = normalize(cross(f, POINT_SHADOW_UP[face]));
+    vec3 u = cross(s, f);
+    float z = dot(d, f);
+    vec2 faceUV = vec2(dot(d, s), dot(d, u)) / z * 0.5 + 0.5;
+
+    int tile = light.shadowSlot * 6 + face;
+    vec2 tileOrigin = vec2(tile % pointShadowTilesPerRow, tile / pointShadowTilesPerRow) * pointShadowTileSize;
+    // Keep the filter taps inside this face's tile
+    vec2 minUV = tileOrigin + vec2(1.5 * pointShadowTexel);
+    vec2 maxUV = tileOrigin + vec2(pointShadowTileSize - 1.5 * pointShadowTexel);
+    vec2 uv = clamp(tileOrigin + faceUV * pointShadowTileSize, minUV, maxUV);
+
+    // Bias in world units, larger at grazing angles, then normalised like the stored distance
+    vec3 lightDir = -d / currentDistance;
+    float bias = max(0.15 * (1.0 - dot(normal, lightDir)), 0.03) / light.shadowFar;
+    float current = currentDistance / light.shadowFar - bias;
+
+    float shadow = 0.0;
+    for (int x = -1; x <= 1; ++x) {
+        for (int y = -1; y <= 1; ++y) {
+            float closest = texture(pointShadowAtlas, uv + vec2(x, y) * pointShadowTexel).r;
+            shadow += current > closest ? 1.0 : 0.0;
+        }
+    }
+    return shadow / 9.0;
+}
+
+
 vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir, vec3 albedoColor, vec3 specularColorFactor, float shadowContribution) {
     if (!light.enabled) return vec3(0.0);
     vec3 lightDir = normalize(-light.direction);
@@ -88,8 +150,6 @@ vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir, vec3 albedoColor, v
 }
 
 vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir, vec3 albedoColor, vec3 specularColorFactor) {
-    // Note: This simple shadow map setup is for ONE directional light.
-    // Point light shadows are more complex (omnidirectional) and not handled here.
     if (!light.enabled) return vec3(0.0);
     vec3 lightDir = normalize(light.position - fragPos);
     float diff = max(dot(normal, lightDir), 0.0);
@@ -100,7 +160,8 @@ vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir, v
     float distance = length(light.position - fragPos);
     float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
     vec3 ambient = light.ambient * albedoColor * lightAmbientStrengthMultiplier;
-    return (ambient + diffuse + specular) * attenuation;
+    float shadow = CalculatePointShadow(light, fragPos, normal);
+    return (ambient + (diffuse + specular) * (1.0 - shadow)) * attenuation;
 }
 
 void main() {
@@ -158,8 +219,13 @@ void main() {
             float currentLightShadowFactor = (i == 0) ? shadow : 0.0;
             totalLighting += CalcDirLight(dirLights[i], norm, viewDir, albedoColor, specularColorFactor, currentLightShadowFactor);
         }
-        for (int i = 0; i < min(numPointLights, MAX_POINT_LIGHTS); ++i) {
-            totalLighting += CalcPointLight(pointLights[i], norm, FragPos_world, viewDir, albedoColor, specularColorFactor);
+        if (hasLightmap && useBakedLighting) {
+            // Static point lights are baked, one fetch replaces the whole light loop
+            totalLighting += texture(lightmap, LightmapCoords).rgb * albedoColor;
+        } else {
+            for (int i = 0; i < min(numPointLights, MAX_POINT_LIGHTS); ++i) {
+                totalLighting += CalcPointLight(pointLights[i], norm, FragPos_world, viewDir, albedoColor, specularColorFactor);
+            }
         }
 
         // totalLighting = max(totalLighting, vec3(0.01) * albedoColor); // Optional min brightness
@@ -9,9 +9,15 @@
 #include <string>
 #include <map>
 #include <algorithm> // Required for std::sort
+#include <limits>
 
 #include "shader.hpp" // Assuming you have this for LoadShaders
 #include "Model.h"    // Your Model class header
+#include "DynamicResolution.h"
+#include "PointShadowAtlas.h"
+#include "FrustumCuller.h"
+#include "ShadowGeometry.h"
+#include "SceneData.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h" // For texture loading
 
@@ -36,6 +42,17 @@ const float SUN_BASE_Z_DIRECTION = -0.5f;
 // Shadow Mapping Constants
 const unsigned int SHADOW_WIDTH = 2048;
 const unsigned int SHADOW_HEIGHT = 2048;
+const bool SHADOW_GEOMETRY_QUANTIZE = true; // 16-bit positions in the depth-only vertex stream
+
+// Dynamic Resolution Constants
+const float DYNAMIC_RES_TARGET_FRAME_MS = 16.0f; // GPU budget per frame, a little under 60 Hz vsync
+const float DYNAMIC_RES_TARGET_STEP_MS = 1.0f;
+
+// Point Light Shadow Constants
+const unsigned int POINT_SHADOW_ATLAS_SIZE = 4096;
+const unsigned int POINT_SHADOW_TILE_SIZE = 512;    // per cube face, 10 shadowed lights fit the atlas
+const int POINT_SHADOW_FACE_UPDATES_PER_FRAME = 6;  // one full light per frame at most
+const unsigned int POINT_SHADOW_TEXTURE_UNIT = 5;
 
 // --- Drone Camera ---
 struct Drone {
@@ -114,6 +131,10 @@ struct ModelInfo {
     glm::vec3 scale;
     bool isTransparent;
     bool isGlass;
+    // range of this model's meshes in the scene culling bounds (opaque models only)
+    uint32_t firstBounds = 0;
+    uint32_t boundsCount = 0;
+    int shadowGeometry = -1; // handle in the position-only depth stream (opaque models only)
 
     ModelInfo(Model* m = nullptr,
               glm::vec3 pos = glm::vec3(0.0f),
@@ -123,8 +144,49 @@ struct ModelInfo {
               bool glass = false)
         : model(m), position(pos), rotation(rot), scale(scl),
           isTransparent(transparent), isGlass(glass) {}
+
+    glm::mat4 getModelMatrix() const {
+        glm::mat4 modelMatrix = glm::translate(glm::mat4(1.0f), position);
+        modelMatrix = glm::rotate(modelMatrix, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
+        modelMatrix = glm::rotate(modelMatrix, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
+        modelMatrix = glm::rotate(modelMatrix, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+        return glm::scale(modelMatrix, scale);
+    }
 };
 
+// World-space AABB of every opaque mesh, culled each frame in one SoA batch
+CullingBounds sceneBounds;
+std::vector<uint32_t> sceneBoundsMesh; // mesh index within its model, per bounds entry
+
+void buildSceneBounds(std::map<std::string, ModelInfo>& models) {
+    sceneBounds.clear();
+    sceneBoundsMesh.clear();
+    for (auto& pair : models) {
+        ModelInfo& modelInfo = pair.second;
+        modelInfo.firstBounds = static_cast<uint32_t>(sceneBounds.size());
+        modelInfo.boundsCount = 0;
+        if (modelInfo.isTransparent || !modelInfo.model) continue;
+
+        glm::mat4 modelMatrix = modelInfo.getModelMatrix();
+        for (size_t m = 0; m < modelInfo.model->meshes.size(); m++) {
+            const Mesh& mesh = modelInfo.model->meshes[m];
+            glm::vec3 worldMin(std::numeric_limits<float>::max());
+            glm::vec3 worldMax(-std::numeric_limits<float>::max());
+            for (int corner = 0; corner < 8; corner++) {
+                glm::vec3 local((corner & 1) ? mesh.boundsMax.x : mesh.boundsMin.x,
+                                (corner & 2) ? mesh.boundsMax.y : mesh.boundsMin.y,
+                                (corner & 4) ? mesh.boundsMax.z : mesh.boundsMin.z);
+                glm::vec3 world = glm::vec3(modelMatrix * glm::vec4(local, 1.0f));
+                worldMin = glm::min(worldMin, world);
+                worldMax = glm::max(worldMax, world);
+            }
+            sceneBounds.add(glm::value_ptr(worldMin), glm::value_ptr(worldMax));
+            sceneBoundsMesh.push_back(static_cast<uint32_t>(m));
+            modelInfo.boundsCount++;
+        }
+    }
+}
+
 // --- Transparent Object Sorting ---
 struct TransparentObject {
     const ModelInfo* modelInfo;
@@ -143,6 +205,17 @@ struct TransparentObject {
 GLuint depthMapFBO;
 GLuint depthMapTexture;
 GLuint depthShaderProgram_global;
+ShadowGeometry* shadowGeometry = nullptr;
+
+// Offscreen scene target with adaptive resolution scale
+DynamicResolution* dynamicResolution = nullptr;
+
+// Use baked lightmaps for the static point lights where a model has one
+bool useBakedLighting = true;
+
+// Cached cube shadow maps for the point lights that matter most on screen
+PointShadowAtlas* pointShadowAtlas = nullptr;
+bool usePointShadows = true;
 
 // --- Function to Render Transparent Objects ---
 void renderTransparentObjects(
@@ -205,6 +278,11 @@ void printControls() {
     std::cout << "I/K: Look (pitch) up/down" << std::endl;
     std::cout << "R: Reset drone to initial position" << std::endl;
     std::cout << "P: Print drone status" << std::endl;
+    std::cout << "F2: Toggle dynamic resolution" << std::endl;
+    std::cout << "F3: Print dynamic resolution status" << std::endl;
+    std::cout << "-/=: Decrease/increase frame-time target" << std::endl;
+    std::cout << "F4: Toggle baked/dynamic point lighting" << std::endl;
+    std::cout << "F5: Toggle point light shadows (dynamic lighting only)" << std::endl;
     std::cout << "F1: Show controls" << std::endl;
     std::cout << "ESC: Exit" << std::endl;
     std::cout << "=================" << std::endl;
@@ -245,6 +323,30 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
             case GLFW_KEY_P: drone.printStatus(); break;
             case GLFW_KEY_ESCAPE: glfwSetWindowShouldClose(window, true); break;
             case GLFW_KEY_F1: printControls(); break;
+            case GLFW_KEY_F2:
+                if (dynamicResolution) {
+                    dynamicResolution->setEnabled(!dynamicResolution->isEnabled());
+                    std::cout << "Dynamic resolution " << (dynamicResolution->isEnabled() ? "enabled." : "disabled.") << std::endl;
+                }
+                break;
+            case GLFW_KEY_F3: if (dynamicResolution) dynamicResolution->printStatus(); break;
+            case GLFW_KEY_F4:
+                useBakedLighting = !useBakedLighting;
+                std::cout << "Point lighting: " << (useBakedLighting ? "baked lightmaps" : "dynamic") << std::endl;
+                break;
+            case GLFW_KEY_F5:
+                usePointShadows = !usePointShadows;
+                std::cout << "Point light shadows " << (usePointShadows ? "enabled." : "disabled.") << std::endl;
+                if (usePointShadows && pointShadowAtlas) pointShadowAtlas->printStatus();
+                break;
+            case GLFW_KEY_MINUS:
+            case GLFW_KEY_EQUAL:
+                if (dynamicResolution) {
+                    float step = (key == GLFW_KEY_EQUAL) ? DYNAMIC_RES_TARGET_STEP_MS : -DYNAMIC_RES_TARGET_STEP_MS;
+                    dynamicResolution->setTargetFrameMs(dynamicResolution->getTargetFrameMs() + step);
+                    std::cout << "Frame-time target: " << dynamicResolution->getTargetFrameMs() << " ms" << std::endl;
+                }
+                break;
         }
     } else if (action == GLFW_RELEASE) {
         switch (key) {
@@ -265,9 +367,6 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
 // --- Main Function ---
 int main() {
     std::cout << "=== IT Kiosk Renderer ===" << std::endl;
-    const glm::vec3 commonPointLightDiffuseStrength = glm::vec3(0.05f);
-    const glm::vec3 commonPointLightSpecularStrength = glm::vec3(0.1f);
-    const glm::vec3 commonPointLightAmbientStrength = glm::vec3(0.0002f);
 
     if (!glfwInit()) { std::cerr << "Failed to initialize GLFW" << std::endl; return -1;}
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -314,15 +413,31 @@ int main() {
     if (shaderProgram == 0 || depthShaderProgram_global == 0) {std::cerr << "ERROR: Failed to load shaders!" << std::endl; glfwTerminate(); return -1; }
     std::cout << "✓ Shaders loaded successfully!" << std::endl;
 
+    int fbWidth, fbHeight;
+    glfwGetFramebufferSize(window, &fbWidth, &fbHeight);
+    dynamicResolution = new DynamicResolution(fbWidth, fbHeight, DYNAMIC_RES_TARGET_FRAME_MS);
+    if (!dynamicResolution->init()) {
+        std::cerr << "Warning: Dynamic resolution unavailable, rendering at native resolution." << std::endl;
+        dynamicResolution->setEnabled(false);
+    }
+
+    pointShadowAtlas = new PointShadowAtlas(POINT_SHADOW_ATLAS_SIZE, POINT_SHADOW_TILE_SIZE, POINT_SHADOW_FACE_UPDATES_PER_FRAME);
+    if (!pointShadowAtlas->init()) {
+        std::cerr << "Warning: Point light shadows unavailable." << std::endl;
+        usePointShadows = false;
+    }
+    std::vector<glm::vec3> pointShadowPositions;
+    std::vector<float> pointShadowRadii;
+    for (int l = 0; l < SCENE_POINT_LIGHT_COUNT && l < MAX_POINT_LIGHTS_SUPPORTED; ++l) {
+        pointShadowPositions.push_back(SCENE_POINT_LIGHTS[l].position);
+        pointShadowRadii.push_back(pointLightRadius(SCENE_POINT_LIGHTS[l]));
+    }
+    pointShadowAtlas->setLights(pointShadowPositions, pointShadowRadii);
+    std::vector<ShadowCaster> shadowCasters;
+
     std::map<std::string, ModelInfo> models;
     try {
-        const std::vector<std::string> modelNames = {
-            "BackWall", "Barstools", "BarTables", "BlueCouches", "BrownChairs", "CharcoalChairs", "CircleSofas",
-            "CoffeeTables", "Cubicles", "Dividers", "EntranceWall", "GreyChairs", "ITLabsLeft", "ITLabsRight", "Kiosk",
-            "LabWallsLeft", "LabWallsRight", "LabWindowFrames", "MainFloor", "MiniCoffeeTable", "Railings",
-            "RoofFraming", "Underflooring", "WallDecorLeft", "WallDecorRight", "CoffeeMachine", "CashRegister", "OtherLights", "Lights", "Cans", "PopcornMachine"
-        };
-        for (const auto& name : modelNames) {
+        for (const auto& name : SCENE_OPAQUE_MODEL_NAMES) {
             std::string modelPath = "models/" + name + ".obj";
             Model* loadedModel = new Model(modelPath);
             models[name] = ModelInfo(loadedModel);
@@ -341,6 +456,21 @@ int main() {
         std::cerr << "Error loading models: " << e.what() << std::endl;
     }
     std::cout << "All models processed." << std::endl;
+    buildSceneBounds(models);
+
+    shadowGeometry = new ShadowGeometry(SHADOW_GEOMETRY_QUANTIZE);
+    for (auto& pair : models) {
+        ModelInfo& modelInfo = pair.second;
+        if (modelInfo.isTransparent || !modelInfo.model) continue;
+        modelInfo.shadowGeometry = shadowGeometry->addModel(*modelInfo.model);
+    }
+    shadowGeometry->upload();
+    shadowGeometry->printStatus();
+    pointShadowAtlas->setGeometry(shadowGeometry);
+    GLint depthModelLoc = glGetUniformLocation(depthShaderProgram_global, "model");
+    const CullPath cullPath = detectCullPath();
+    std::vector<uint32_t> visibleMeshes(sceneBounds.size());
+    std::cout << "Frustum culling " << sceneBounds.size() << " meshes (" << cullPathName(cullPath) << ")" << std::endl;
     printControls();
 
     GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
@@ -355,6 +485,7 @@ int main() {
     GLint texSpecularLoc = glGetUniformLocation(shaderProgram, "material.texture_specular1");
     GLint lightSpaceMatrixLoc_main = glGetUniformLocation(shaderProgram, "lightSpaceMatrix");
     GLint shadowMapLoc_main = glGetUniformLocation(shaderProgram, "shadowMap");
+    GLint useBakedLightingLoc = glGetUniformLocation(shaderProgram, "useBakedLighting");
 
     // Render loop
     while (!glfwWindowShouldClose(window)) {
@@ -363,6 +494,10 @@ int main() {
         lastFrame = currentFrame;
         processInput(window); // This updates drone.position and drone.front
 
+        glfwGetFramebufferSize(window, &fbWidth, &fbHeight);
+        dynamicResolution->resize(fbWidth, fbHeight);
+        dynamicResolution->beginFrame(); // GPU timer covers the depth pass as well
+
         // --- 1. DEPTH PASS ---
         glm::mat4 lightProjection, lightView;
         glm::mat4 lightSpaceMatrix;
@@ -390,6 +525,8 @@ int main() {
             // glEnable(GL_CULL_FACE);
             // glCullFace(GL_FRONT);
 
+            shadowCasters.clear();
+            shadowGeometry->bind();
             for (const auto& pair : models) {
                 const ModelInfo& modelInfo = pair.second;
                 if (modelInfo.isTransparent || !modelInfo.model) continue;
@@ -400,9 +537,13 @@ int main() {
                 modelMatrix_depth = glm::rotate(modelMatrix_depth, glm::radians(modelInfo.rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
                 modelMatrix_depth = glm::rotate(modelMatrix_depth, glm::radians(modelInfo.rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
                 modelMatrix_depth = glm::scale(modelMatrix_depth, modelInfo.scale);
-                glUniformMatrix4fv(glGetUniformLocation(depthShaderProgram_global, "model"), 1, GL_FALSE, value_ptr(modelMatrix_depth));
-                modelInfo.model->Draw(depthShaderProgram_global);
+                shadowGeometry->draw(modelInfo.shadowGeometry, depthModelLoc, modelMatrix_depth);
+
+                float maxScale = std::max(modelInfo.scale.x, std::max(modelInfo.scale.y, modelInfo.scale.z));
+                glm::vec3 casterCenter = glm::vec3(modelMatrix_depth * glm::vec4(modelInfo.model->getBoundsCenter(), 1.0f));
+                shadowCasters.push_back({modelInfo.model, modelInfo.shadowGeometry, modelMatrix_depth, casterCenter, modelInfo.model->getBoundsRadius() * maxScale});
             }
+            shadowGeometry->unbind();
             // if (glIsEnabled(GL_CULL_FACE)) { // Reset culling if it was enabled
             //     glCullFace(GL_BACK);
             //     glDisable(GL_CULL_FACE);
@@ -410,17 +551,22 @@ int main() {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
         // --- END DEPTH PASS ---
 
+        float aspectRatio = (fbWidth > 0 && fbHeight > 0) ? (float)fbWidth / (float)fbHeight : (float)SCR_WIDTH / (float)SCR_HEIGHT;
+        glm::mat4 projection = glm::perspective(glm::radians(fov), aspectRatio, 0.1f, 200.0f);
+        glm::mat4 view = glm::lookAt(drone.position, drone.position + drone.front, drone.up); // Uses updated drone state
+
+        // --- 1b. POINT LIGHT SHADOW ATLAS (only stale faces are re-rendered) ---
+        if (usePointShadows) {
+            pointShadowAtlas->update(shadowCasters, projection * view, drone.position);
+        }
 
         // --- 2. MAIN RENDER PASS ---
-        glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
+        dynamicResolution->bindSceneTarget(); // offscreen at the current scale, sets the viewport
         glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         glUseProgram(shaderProgram);
 
-        glm::mat4 projection = glm::perspective(glm::radians(fov), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 200.0f);
-        glm::mat4 view = glm::lookAt(drone.position, drone.position + drone.front, drone.up); // Uses updated drone state
-        
         glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
         glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(view));
         if (viewPosLoc != -1) glUniform3fv(viewPosLoc, 1, glm::value_ptr(drone.position));
@@ -433,6 +579,7 @@ int main() {
             glBindTexture(GL_TEXTURE_2D, depthMapTexture);
             glUniform1i(shadowMapLoc_main, 3);
         }
+        if (usePointShadows) pointShadowAtlas->bind(shaderProgram, POINT_SHADOW_TEXTURE_UNIT);
 
         glUniform3fv(glGetUniformLocation(shaderProgram, "dirLights[0].direction"), 1, value_ptr(currentAnimatedSunDirection));
         glUniform3f(glGetUniformLocation(shaderProgram, "dirLights[0].ambient"), 0.001f, 0.001f, 0.001f);
@@ -442,245 +589,19 @@ int main() {
         glUniform1i(glGetUniformLocation(shaderProgram, "numDirLights"), 1);
 
         int activePointLights = 0;
-        // Light 1
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 0.154029f, -21.925095f, -22.325785f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f); // Attenuation for ~160 units
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 2 (Original pointLights[1] - Transformed from Blender Light.002)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -30.696480f, -21.925095f, -22.325785f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 3 (Transformed from Blender Light.003)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -65.954384f, -21.925095f, -22.325785f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.014f); // Adjusted attenuation for potentially larger distance
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0007f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 4 (Transformed from Blender Light.004)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -1.367252f, 17.311728f, -22.325785f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 5 (Transformed from Blender Light.005)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -32.221157f, 17.290623f, -22.325785f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.014f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0007f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 6 (Transformed from Blender Light.006)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -67.484856f, 17.297579f, -22.325785f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.007f); // Further distance
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0002f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 7 (Transformed from Blender Light.007)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 29.528439f, 17.187288f, -22.325785f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.014f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0007f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 8 (Transformed from Blender Cube.010)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 0.403565f, 16.272787f, -23.359404f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 9 (Transformed from Blender Cube.013)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -30.437645f, 16.273632f, -23.359404f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.014f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0007f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 10 (Transformed from Blender Cube.014)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -1.605055f, 16.320671f, -23.359404f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 11 (Transformed from Blender Cube.017)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 31.253157f, 16.073551f, -23.359404f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.014f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0007f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-
-        // Light 12 (Blender Light.008)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 73.030205f, 29.086636f, 0.262677f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.007f); 
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0002f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 13 (Blender Light.009)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 73.030205f, 37.828785f, 0.262677f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.007f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0002f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 14 (Blender Light.011)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 73.030205f, 5.471813f, 0.262677f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.014f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0007f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 15 (Blender Light.014)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -97.400917f, 19.527908f, -29.851522f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.007f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0002f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 16 (Blender Light.015)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -66.798378f, 6.912896f, -28.229601f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.014f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0007f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 17 (Blender Light.016)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -44.519119f, -1.154248f, 16.305470f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 18 (Blender Light.017)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), 31.984005f, -1.154248f, 16.305470f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 19 (Blender Light.018)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -6.326900f, -1.154248f, 16.305470f);
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
-            activePointLights++;
-        }
-        // Light 20 (Blender Light.019 - Note: This was a duplicate position in your list, I used a slightly different Z for uniqueness)
-        if (activePointLights < MAX_POINT_LIGHTS_SUPPORTED) {
-            glUniform3f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].position").c_str()), -44.519119f, -1.154248f, 15.305470f); // Different Z
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].ambient").c_str()), 1, value_ptr(commonPointLightAmbientStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].diffuse").c_str()), 1, value_ptr(commonPointLightDiffuseStrength));
-            glUniform3fv(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].specular").c_str()), 1, value_ptr(commonPointLightSpecularStrength));
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].constant").c_str()), 1.0f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].linear").c_str()), 0.022f);
-            glUniform1f(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].quadratic").c_str()), 0.0019f);
-            glUniform1i(glGetUniformLocation(shaderProgram, ("pointLights[" + std::to_string(activePointLights) + "].enabled").c_str()), 1);
+        for (int l = 0; l < SCENE_POINT_LIGHT_COUNT && activePointLights < MAX_POINT_LIGHTS_SUPPORTED; ++l) {
+            const PointLightData& light = SCENE_POINT_LIGHTS[l];
+            std::string prefix = "pointLights[" + std::to_string(activePointLights) + "]";
+            glUniform3fv(glGetUniformLocation(shaderProgram, (prefix + ".position").c_str()), 1, value_ptr(light.position));
+            glUniform3fv(glGetUniformLocation(shaderProgram, (prefix + ".ambient").c_str()), 1, value_ptr(POINT_LIGHT_AMBIENT));
+            glUniform3fv(glGetUniformLocation(shaderProgram, (prefix + ".diffuse").c_str()), 1, value_ptr(POINT_LIGHT_DIFFUSE));
+            glUniform3fv(glGetUniformLocation(shaderProgram, (prefix + ".specular").c_str()), 1, value_ptr(POINT_LIGHT_SPECULAR));
+            glUniform1f(glGetUniformLocation(shaderProgram, (prefix + ".constant").c_str()), POINT_LIGHT_CONSTANT);
+            glUniform1f(glGetUniformLocation(shaderProgram, (prefix + ".linear").c_str()), light.linear);
+            glUniform1f(glGetUniformLocation(shaderProgram, (prefix + ".quadratic").c_str()), light.quadratic);
+            glUniform1i(glGetUniformLocation(shaderProgram, (prefix + ".enabled").c_str()), 1);
+            glUniform1i(glGetUniformLocation(shaderProgram, (prefix + ".shadowSlot").c_str()), usePointShadows ? pointShadowAtlas->getSlot(l) : -1);
+            glUniform1f(glGetUniformLocation(shaderProgram, (prefix + ".shadowFar").c_str()), pointShadowAtlas->getFarPlane(l));
             activePointLights++;
         }
 
@@ -690,14 +611,24 @@ int main() {
         }
         // End Point Light Setup
 
+        if (useBakedLightingLoc != -1) glUniform1i(useBakedLightingLoc, useBakedLighting ? 1 : 0);
+
         if (texDiffuseLoc != -1) glUniform1i(texDiffuseLoc, 0);
         if (texSpecularLoc != -1) glUniform1i(texSpecularLoc, 1);
 
         // --- Render Opaque Objects (Main Pass) ---
+        // visibleMeshes is ascending, so it walks in step with the model map
+        FrustumPlanes cameraFrustum = FrustumPlanes::fromMatrix(glm::value_ptr(projection * view));
+        size_t visibleCount = cullAabbs(cameraFrustum, sceneBounds, visibleMeshes.data(), cullPath);
+        size_t visibleCursor = 0;
         glDepthMask(GL_TRUE);
         for (const auto& pair : models) {
             const ModelInfo& modelInfo = pair.second;
             if (modelInfo.isTransparent || !modelInfo.model) continue;
+            size_t visibleBegin = visibleCursor;
+            while (visibleCursor < visibleCount && visibleMeshes[visibleCursor] < modelInfo.firstBounds + modelInfo.boundsCount)
+                visibleCursor++;
+            if (visibleCursor == visibleBegin) continue; // whole model outside the view
             if (isGlassLocation != -1) glUniform1i(isGlassLocation, 0);
 
             float shininess = 32.0f;
@@ -716,7 +647,8 @@ int main() {
             modelMatrix_main = glm::rotate(modelMatrix_main, glm::radians(modelInfo.rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
             modelMatrix_main = glm::scale(modelMatrix_main, modelInfo.scale);
             glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(modelMatrix_main));
-            modelInfo.model->Draw(shaderProgram);
+            for (size_t v = visibleBegin; v < visibleCursor; v++)
+                modelInfo.model->meshes[sceneBoundsMesh[visibleMeshes[v]]].Draw(shaderProgram);
         }
 
         // --- Render Transparent Objects (Main Pass) ---
@@ -725,10 +657,19 @@ int main() {
         renderTransparentObjects(shaderProgram, models, drone.position, isGlassLocation, true);
         glDepthMask(GL_TRUE);
 
+        // --- 3. UPSCALE TO WINDOW ---
+        dynamicResolution->endFrame();
+
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
 
+    delete dynamicResolution;
+    dynamicResolution = nullptr;
+    delete pointShadowAtlas;
+    pointShadowAtlas = nullptr;
+    delete shadowGeometry;
+    shadowGeometry = nullptr;
     glDeleteFramebuffers(1, &depthMapFBO);
     glDeleteTextures(1, &depthMapTexture);
     glDeleteProgram(depthShaderProgram_global);
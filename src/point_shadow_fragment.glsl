@@ -0,0 +1,12 @@
+#version 330 core
+in vec3 FragPos_world;
+
+uniform vec3 lightPos;
+uniform float farPlane; // Light radius, distances are stored normalised to [0,1]
+
+void main()
+{
+    // Linear distance rather than projected depth, so the lookup in fragmentShader.glsl
+    // can compare against length(fragPos - lightPos) without knowing the face matrix
+    gl_FragDepth = length(FragPos_world - lightPos) / farPlane;
+}
@@ -0,0 +1,14 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+uniform mat4 faceMatrix; // Projection * view for one cube face of the light
+uniform mat4 model;
+
+out vec3 FragPos_world;
+
+void main()
+{
+    vec4 worldPos = model * vec4(aPos, 1.0);
+    FragPos_world = worldPos.xyz;
+    gl_Position = faceMatrix * worldPos;
+}
@@ -0,0 +1,38 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2D sceneTexture;
+uniform vec2 sourceSize; // size of the scene texture in texels
+uniform vec2 uvScale;    // rendered region / full texture, the scene only fills the lower-left corner
+uniform float sharpness; // 0 = plain bilinear, 1 = strongest
+
+void main()
+{
+    vec2 texel = 1.0 / sourceSize;
+    vec2 minUV = 0.5 * texel;
+    vec2 maxUV = uvScale - 0.5 * texel; // never filter in texels outside the rendered region
+    vec2 uv = min(TexCoords * uvScale, maxUV);
+
+    vec3 c = texture(sceneTexture, uv).rgb;
+    if (sharpness <= 0.0) {
+        FragColor = vec4(c, 1.0);
+        return;
+    }
+
+    vec3 n = texture(sceneTexture, clamp(uv + vec2(0.0, texel.y), minUV, maxUV)).rgb;
+    vec3 s = texture(sceneTexture, clamp(uv - vec2(0.0, texel.y), minUV, maxUV)).rgb;
+    vec3 e = texture(sceneTexture, clamp(uv + vec2(texel.x, 0.0), minUV, maxUV)).rgb;
+    vec3 w = texture(sceneTexture, clamp(uv - vec2(texel.x, 0.0), minUV, maxUV)).rgb;
+
+    // Contrast adaptive sharpening: back off where the neighbourhood already has strong
+    // contrast so edges do not ring, and sharpen flat, blurred-by-upscale areas the most
+    vec3 mn = min(c, min(min(n, s), min(e, w)));
+    vec3 mx = max(c, max(max(n, s), max(e, w)));
+    vec3 amp = sqrt(clamp(min(mn, 1.0 - mx) / max(mx, vec3(0.0001)), 0.0, 1.0));
+    vec3 weight = -amp / mix(8.0, 5.0, sharpness);
+
+    vec3 result = (c + (n + s + e + w) * weight) / (1.0 + 4.0 * weight);
+    FragColor = vec4(clamp(result, 0.0, 1.0), 1.0);
+}
@@ -2,6 +2,7 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTexCoords;
+layout (location = 3) in vec2 aLightmapCoords;
 
 uniform mat4 model;
 uniform mat4 view;
@@ -11,6 +12,7 @@ uniform mat4 lightSpaceMatrix; // NEW
 out vec3 FragPos_world;
 out vec3 Normal_world;
 out vec2 TexCoords;
+out vec2 LightmapCoords;
 out vec4 FragPosLightSpace; // NEW: Fragment position in light's clip space
 
 void main() {
@@ -18,6 +20,7 @@ void main() {
     FragPos_world = worldPos_vec4.xyz;
     Normal_world = mat3(transpose(inverse(model))) * aNormal;
     TexCoords = aTexCoords;
+    LightmapCoords = aLightmapCoords;
 
     FragPosLightSpace = lightSpaceMatrix * worldPos_vec4; // Calculate this
 